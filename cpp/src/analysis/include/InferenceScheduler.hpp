@@ -0,0 +1,106 @@
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <torch/torch.h>
+
+// Multi-stream real-time inference scheduler.
+//
+// Each registered model gets its own input queue; a shared worker pool
+// drains them by priority, so one process serves every subsystem model
+// instead of one process per model. Queues whose models share an
+// architecture are drained together and their inputs stacked into a
+// single batched forward pass. Safety-class streams preempt analytics:
+// workers always take the highest priority class with pending work, and
+// within a class the longest-waiting queue, so an analytics backlog can
+// never starve a safety model.
+class InferenceScheduler : public QObject {
+    Q_OBJECT
+
+public:
+    // Scheduling classes, highest first
+    enum class Priority {
+        Safety = 0,
+        Control,
+        Analytics
+    };
+
+    struct StreamConfig {
+        Priority priority{Priority::Analytics};
+        // Models with the same architecture key are batched together
+        QString architectureKey;
+        int maxQueueDepth{256};
+        int maxBatchSize{32};
+    };
+
+    struct InferenceRequest {
+        quint64 sequence{0};
+        torch::Tensor input;
+    };
+
+    using ResultHandler =
+        std::function<void(const QString& modelId, quint64 sequence,
+                           const torch::Tensor& output)>;
+
+    explicit InferenceScheduler(QObject* parent = nullptr);
+    ~InferenceScheduler();
+
+    // Stream lifecycle; one queue per model
+    bool registerStream(const QString& modelId,
+                        std::shared_ptr<const torch::jit::Module> module,
+                        const StreamConfig& config, ResultHandler onResult);
+    bool unregisterStream(const QString& modelId);
+
+    // Enqueue an input for a registered model; drops the oldest entry
+    // and reports overflow when the queue is at maxQueueDepth
+    bool submit(const QString& modelId, torch::Tensor input);
+
+    void start(int numWorkers = 0);
+    void stop();
+    bool running() const;
+
+    int pendingRequests(const QString& modelId) const;
+
+signals:
+    void resultReady(const QString& modelId, quint64 sequence);
+    void queueOverflow(const QString& modelId, quint64 droppedSequence);
+    void streamError(const QString& modelId, const QString& error);
+
+private:
+    struct Stream {
+        StreamConfig config;
+        std::shared_ptr<const torch::jit::Module> module;
+        ResultHandler onResult;
+        std::deque<InferenceRequest> queue;
+        quint64 nextSequence{0};
+        quint64 oldestEnqueueTick{0};
+        bool inFlight{false};
+    };
+
+    // Picks the next unit of work: the highest priority class with
+    // pending requests, then the longest-waiting stream in that class,
+    // widened to same-architecture peers up to maxBatchSize
+    struct WorkUnit {
+        std::vector<Stream*> streams;
+        std::vector<std::vector<InferenceRequest>> requests;
+    };
+    bool takeWork(WorkUnit& unit);
+    void runWork(WorkUnit& unit);
+    void workerLoop();
+
+    mutable std::mutex mutex_;
+    std::condition_variable workAvailable_;
+    std::map<QString, std::unique_ptr<Stream>> streams_;
+    std::vector<std::thread> workers_;
+    std::atomic<bool> running_{false};
+    quint64 enqueueTick_{0};
+    torch::Device device_{torch::kCPU};
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <torch/torch.h>
+
+// Background mini-batch training with atomic weight publication.
+//
+// Historical data is staged once into pinned, contiguous host tensors
+// sized to the configured batch, then trained incrementally on a worker
+// thread (CUDA when available, CPU otherwise) with async host-to-device
+// copies overlapping compute. Finished weights are published as
+// immutable snapshots swapped in with std::atomic_store, so real-time
+// analysis keeps serving predictions from the previous snapshot for the
+// entire run — startRealtimeAnalysis never blocks on training.
+class MiniBatchTrainer : public QObject {
+    Q_OBJECT
+
+public:
+    struct TrainingConfig {
+        int batchSize{256};
+        int epochs{10};
+        float learningRate{1e-3f};
+        bool pinMemory{true};
+        int prefetchBatches{2};
+        // Publish a snapshot every N batches; 0 publishes per epoch
+        int publishInterval{0};
+    };
+
+    // Immutable published weights; readers hold the shared_ptr for the
+    // duration of an inference and never see a partial update
+    struct WeightSnapshot {
+        std::shared_ptr<const torch::jit::Module> module;
+        quint64 version{0};
+        float loss{0.0f};
+    };
+
+    explicit MiniBatchTrainer(QObject* parent = nullptr);
+    ~MiniBatchTrainer();
+
+    // Stages the dataset into pinned batches and starts the worker;
+    // returns false if a run is already in flight
+    bool start(torch::Tensor features, torch::Tensor targets,
+               torch::jit::Module initialModule,
+               const TrainingConfig& config = TrainingConfig());
+    void stop();
+    bool isTraining() const;
+
+    // Lock-free read of the latest published snapshot
+    std::shared_ptr<const WeightSnapshot> currentWeights() const;
+
+signals:
+    void batchCompleted(int epoch, int batch, float loss);
+    void epochCompleted(int epoch, float meanLoss);
+    void weightsPublished(quint64 version);
+    void trainingFinished(float finalLoss);
+    void trainingFailed(const QString& error);
+
+private:
+    // One staged mini-batch: pinned host storage, contiguous layout
+    struct StagedBatch {
+        torch::Tensor features;
+        torch::Tensor targets;
+    };
+
+    void stageBatches(const torch::Tensor& features,
+                      const torch::Tensor& targets,
+                      const TrainingConfig& config);
+    void trainLoop(torch::jit::Module module, TrainingConfig config);
+    void publishSnapshot(const torch::jit::Module& module, float loss);
+
+    std::vector<StagedBatch> staged_;
+    std::shared_ptr<const WeightSnapshot> published_;
+    std::atomic<quint64> nextVersion_{1};
+    std::atomic<bool> training_{false};
+    std::atomic<bool> stopRequested_{false};
+    std::thread worker_;
+    torch::Device device_{torch::kCPU};
+};
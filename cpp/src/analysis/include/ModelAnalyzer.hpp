@@ -8,6 +8,8 @@
 #include <memory>
 #include <torch/torch.h>
 #include <opencv2/opencv.hpp>
+#include "InferenceScheduler.hpp"
+#include "MiniBatchTrainer.hpp"
 
 class ModelAnalyzer : public QObject {
     Q_OBJECT
@@ -37,9 +39,17 @@ public:
     QFuture<QVector<QString>> findSimilarModels(const QString& modelId, int limit = 10);
     QFuture<QMap<QString, float>> predictPerformanceMetrics(const QString& modelId);
     
-    // Real-time analysis
+    // Real-time analysis. Each model becomes a stream on the shared
+    // inference scheduler, so any number of subsystem models run
+    // concurrently in this process with safety-class streams scheduled
+    // ahead of analytics.
     void startRealtimeAnalysis(const QString& modelId);
+    void startRealtimeAnalysis(
+        const QString& modelId, InferenceScheduler::Priority priority,
+        const QString& architectureKey = QString());
     void stopRealtimeAnalysis();
+    void stopRealtimeAnalysis(const QString& modelId);
+    InferenceScheduler& inferenceScheduler();
 
     // Model optimization
     QFuture<bool> optimizeModel(const QString& modelId);
@@ -50,9 +60,16 @@ public:
     QImage generateComparisonVisualization(const QStringList& modelIds);
     QImage generatePerformanceGraph(const QString& modelId);
 
-    // Training and model management
+    // Training and model management. trainOnHistoricalData stages the
+    // history into pinned mini-batches and runs on the trainer's worker
+    // thread; updateModelWeights swaps in the trainer's latest
+    // immutable snapshot, so real-time analysis keeps predicting from
+    // the previous weights while a run is in flight.
     void trainOnHistoricalData();
+    void trainOnHistoricalDataAsync(
+        const MiniBatchTrainer::TrainingConfig& config = MiniBatchTrainer::TrainingConfig());
     void updateModelWeights(const QString& modelType);
+    MiniBatchTrainer& trainer();
     void saveModelState(const QString& path);
     void loadModelState(const QString& path);
 
@@ -100,4 +117,6 @@ private:
     bool isAnalyzing_{false};
     AnalysisConfig currentConfig_;
     QMap<QString, torch::Tensor> modelCache_;
+    MiniBatchTrainer trainer_;
+    InferenceScheduler scheduler_;
 };
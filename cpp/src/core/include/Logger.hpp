@@ -6,7 +6,13 @@
 #include <QTextStream>
 #include <QDateTime>
 #include <QMutex>
+#include <QDataStream>
+#include <QVariant>
+#include <QHash>
 #include <memory>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 enum class LogLevel {
     Debug,
@@ -32,6 +38,27 @@ public:
     // Configuration
     void setLogFile(const QString& filePath);
     void setLogLevel(LogLevel level);
+
+    // Async mode: callers enqueue into a lock-free MPSC ring buffer and
+    // return immediately; a dedicated drainer thread performs batched file
+    // writes and rotation off the UI thread. When the ring is full, Debug
+    // and Info records are dropped (counted) while Warning and above fall
+    // back to a synchronous write so they are never lost.
+    void setAsyncLogging(bool enabled);
+    bool isAsyncLoggingEnabled() const;
+    quint64 droppedMessageCount() const;
+
+    // Structured binary mode: instead of formatting a full text line at the
+    // call site, records carry a message-template ID plus raw argument
+    // values, written as compact QDataStream records to a sidecar .blog
+    // file. Template strings are emitted once as definition records, so the
+    // file is self-describing and an offline viewer does the formatting.
+    void setBinaryLogFormat(bool enabled);
+    bool isBinaryLogFormatEnabled() const;
+    quint32 registerLogTemplate(const QString& templateString);
+    void logStructured(LogLevel level, quint32 templateId,
+                       const QVariantList& args,
+                       const QString& component = QString());
     void setConsoleOutput(bool enabled);
     void setFileOutput(bool enabled);
     void setMaxFileSize(qint64 bytes);
@@ -54,9 +81,14 @@ private:
     Logger& operator=(const Logger&) = delete;
 
     void log(LogLevel level, const QString& message, const QString& component);
+    void logSync(LogLevel level, const QString& message, const QString& component);
+    bool tryEnqueueAsync(LogLevel level, const QString& message, const QString& component);
+    void drainLoop();
     void checkFileSize();
     void rotateLogFiles();
     QString formatMessage(LogLevel level, const QString& message, const QString& component) const;
+    QString formatMessage(LogLevel level, const QString& message, const QString& component,
+                          qint64 timestampMs, quintptr threadId) const;
     static QString levelToString(LogLevel level);
 
     QFile logFile_;
@@ -68,4 +100,41 @@ private:
     qint64 maxFileSize_;
     int maxBackupCount_;
     QMutex mutex_;
+
+    // Lock-free ring for async mode (Vyukov bounded queue: per-cell
+    // sequence numbers arbitrate between concurrent producers and the
+    // single drainer)
+    struct AsyncRecord {
+        std::atomic<quint64> sequence;
+        LogLevel level;
+        QString message;
+        QString component;
+        qint64 timestampMs;
+        quintptr threadId;
+    };
+
+    static constexpr quint64 kRingCapacity = 4096;  // power of two
+
+    std::vector<AsyncRecord> ring_;
+    std::atomic<quint64> ringHead_{0};   // producers claim slots here
+    std::atomic<quint64> ringTail_{0};   // drainer consumes from here
+    std::atomic<bool> asyncEnabled_{false};
+    std::atomic<bool> drainStop_{false};
+    std::atomic<quint64> droppedCount_{0};
+    std::thread drainThread_;
+
+    // Structured binary sink
+    static constexpr quint32 kBinaryMagic = 0x4556424C;  // 'EVBL'
+    static constexpr quint16 kBinaryVersion = 1;
+    static constexpr quint8 kRecordTemplateDef = 1;
+    static constexpr quint8 kRecordMessage = 2;
+
+    void openBinaryFile();
+    void closeBinaryFile();
+
+    QFile binaryFile_;
+    QDataStream binaryStream_;
+    QHash<QString, quint32> templateIds_;
+    quint32 nextTemplateId_ = 1;
+    bool binaryFormat_ = false;
 };
@@ -4,6 +4,9 @@
 #include <QString>
 #include <QMap>
 #include <QSet>
+#include <QHash>
+#include <QVector>
+#include <QPair>
 #include <QDateTime>
 #include <functional>
 #include <memory>
@@ -42,6 +45,19 @@ public:
     // Get validation report
     QString generateValidationReport() const;
 
+    // Question answering
+    // The answer base is compiled once: entries are tokenized into an
+    // inverted index and registered key phrases into an Aho-Corasick
+    // automaton. Lookups tokenize only the query, score candidates over
+    // its posting lists with top-k selection, and take automaton hits as
+    // exact-phrase boosts — per-query cost follows the query terms, not
+    // the corpus size.
+    void addAnswer(const QString& question, const QString& answer,
+                   const QStringList& keyPhrases = QStringList());
+    void compileAnswerIndex();
+    QString answerQuestion(const QString& question) const;
+    QVector<QPair<QString, double>> topAnswers(const QString& question, int k = 3) const;
+
 signals:
     void validationFailed(const QString& component, const QString& reason);
     void validationPassed(const QString& component);
@@ -64,9 +80,35 @@ private:
         QDateTime lastValidated;
     };
 
+    struct AnswerEntry {
+        QString question;
+        QString answer;
+        QStringList tokens;
+        QStringList keyPhrases;
+    };
+
+    // Aho-Corasick automaton node for keyword-phrase matching
+    struct AcNode {
+        QMap<QChar, int> next;
+        int fail{0};
+        QVector<int> matchedEntries;  // answer entries ending here
+    };
+
     QMap<QString, ComponentInfo> components_;
     QSet<QString> requiredQtModules_;
-    
+
+    // Compiled answer index
+    QVector<AnswerEntry> answerEntries_;
+    QHash<QString, QVector<int>> tokenPostings_;   // token -> entry ids
+    QHash<QString, double> tokenIdf_;              // rarity weight per token
+    QVector<AcNode> acNodes_;
+    bool answerIndexCompiled_{false};
+
+    // Internal answer-index methods
+    static QStringList tokenizeQuestion(const QString& text);
+    void buildAutomaton();
+    QVector<int> automatonMatches(const QString& normalizedQuery) const;
+
     // Internal validation methods
     bool validateQtIntegration();
     bool validateDatabaseSchema();
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Parallel startup orchestration.
+//
+// Subsystems register an init function plus the names they depend on;
+// run() executes the dependency graph with a worker pool, so
+// independent subsystems (Logger, Config, SystemMonitor, tab backends)
+// initialize concurrently instead of serially. Subsystems marked
+// deferred are excluded from run() and started in the background by
+// startDeferred() after first paint — Fusion360Integration and
+// VoiceAssistant no longer stand between the user and a usable window.
+// A failed init marks every transitive dependent as skipped and run()
+// reports the failure.
+class StartupOrchestrator {
+public:
+    using InitFunction = std::function<bool()>;
+
+    enum class Phase {
+        Critical,  // must finish before the window shows
+        Deferred   // starts in the background after first paint
+    };
+
+    void registerSubsystem(const QString& name, InitFunction init,
+                           const QVector<QString>& dependsOn = {},
+                           Phase phase = Phase::Critical);
+
+    // Initializes every critical subsystem, independent ones in
+    // parallel; returns false if any init failed or a dependency was
+    // missing. numThreads 0 uses the hardware concurrency.
+    bool run(int numThreads = 0);
+
+    // Launches deferred subsystems on background threads once their
+    // dependencies are satisfied; returns immediately
+    void startDeferred(int numThreads = 2);
+    // Joins the deferred workers (shutdown path)
+    void waitDeferred();
+
+    QVector<QString> failedSubsystems() const;
+    QVector<QString> skippedSubsystems() const;
+    qint64 elapsedMs(const QString& name) const;
+
+private:
+    enum class State { Pending, Running, Done, Failed, Skipped };
+
+    struct Subsystem {
+        InitFunction init;
+        std::vector<QString> dependsOn;
+        Phase phase{Phase::Critical};
+        State state{State::Pending};
+        qint64 elapsedMs{0};
+    };
+
+    // Executes every subsystem matching the phase with the pool;
+    // shared by run() and the deferred workers
+    bool execute(Phase phase, int numThreads);
+    // True when every dependency is Done; fails the node when a
+    // dependency failed or is unknown
+    bool dependenciesReady(Subsystem& subsystem);
+
+    mutable std::mutex mutex_;
+    std::condition_variable stateChanged_;
+    std::map<QString, Subsystem> subsystems_;
+    std::vector<std::thread> deferredWorkers_;
+};
@@ -6,7 +6,13 @@
 #include <QString>
 #include <QMap>
 #include <QQueue>
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <thread>
+#include <vector>
+
+class QIODevice;
 
 class VoiceAssistant : public QObject {
     Q_OBJECT
@@ -34,7 +40,25 @@ public:
     bool loadVoiceSamples(const QString& voicePath);
     bool setActiveVoice(const QString& voiceId);
 
+    // Speech command pipeline
+    // Capture, recognition and dispatch run as a pipeline instead of one
+    // sequential path: a real-time capture thread feeds a lock-free audio
+    // ring, a recognition thread decodes streaming partials while the user
+    // is still speaking, and the matched intent is dispatched on
+    // completion — so the action fires a few hundred milliseconds after
+    // utterance end rather than seconds.
+    using Recognizer = std::function<QString(const float* samples, size_t count, bool& finalResult)>;
+
+    void setAudioInputDevice(QIODevice* device);
+    void setRecognizer(Recognizer recognizer);
+    void registerCommand(const QString& phrase, const QString& intent);
+    void startListening();
+    void stopListening();
+    bool isListening() const;
+
 signals:
+    void partialTranscription(const QString& text);
+    void commandRecognized(const QString& intent, const QString& transcription);
     void speakingStarted(const QString& messageId);
     void speakingFinished(const QString& messageId);
     void contextChanged(const QString& newContext);
@@ -46,7 +70,7 @@ signals:
 
 private:
     VoiceAssistant(QObject* parent = nullptr);
-    ~VoiceAssistant() = default;
+    ~VoiceAssistant();
     VoiceAssistant(const VoiceAssistant&) = delete;
     VoiceAssistant& operator=(const VoiceAssistant&) = delete;
 
@@ -79,11 +103,35 @@ private:
     QMap<QString, QStringList> contextHints_;
     QQueue<QueuedMessage> messageQueue_;
     
+    // Lock-free SPSC ring between the capture and recognition threads
+    struct AudioRing {
+        std::vector<float> samples;
+        std::atomic<size_t> head{0};  // capture thread writes
+        std::atomic<size_t> tail{0};  // recognition thread reads
+
+        size_t write(const float* data, size_t count);
+        size_t read(float* out, size_t maxCount);
+    };
+
+    static constexpr size_t kAudioRingCapacity = 1 << 16;  // ~4 s at 16 kHz
+
+    // Speech pipeline state
+    QIODevice* audioInput_{nullptr};
+    Recognizer recognizer_;
+    QMap<QString, QString> commandIntents_;  // phrase -> intent
+    AudioRing audioRing_;
+    std::thread captureThread_;
+    std::thread recognitionThread_;
+    std::atomic<bool> listening_{false};
+
     // Internal methods
     void processNextMessage();
     void loadVoiceSample(const QString& sampleId, const QString& path);
     QString findBestMatch(const QString& messageId, const QVariantMap& params);
     void handlePlaybackStatus(QMediaPlayer::MediaStatus status);
+    void captureLoop();
+    void recognitionLoop();
+    void dispatchIntent(const QString& transcription);
     
 private slots:
     void onPlaybackStateChanged(QMediaPlayer::PlaybackState state);
@@ -2,6 +2,7 @@
 
 #include <QObject>
 #include <QVariantMap>
+#include <QVector>
 #include <QString>
 #include <memory>
 
@@ -28,6 +29,64 @@ public:
     void setBool(const QString& key, bool value);
     void setMap(const QString& key, const QVariantMap& value);
 
+    // Hot-path snapshot access
+    // RCU-style reads: snapshot() returns an immutable view with no lock
+    // on the read path; writers rebuild the snapshot under the write lock
+    // and publish it atomically. Loops that read config thousands of times
+    // per second never contend with a settings-dialog save — they simply
+    // keep using the snapshot they grabbed until they fetch a new one.
+    class Snapshot {
+    public:
+        QString getString(const QString& key, const QString& defaultValue = QString()) const;
+        int getInt(const QString& key, int defaultValue = 0) const;
+        double getDouble(const QString& key, double defaultValue = 0.0) const;
+        bool getBool(const QString& key, bool defaultValue = false) const;
+        QVariantMap getMap(const QString& key) const;
+
+        // Indexed access for typed handles; invalid QVariant when the slot
+        // had no value at publish time
+        QVariant slotValue(int slot) const {
+            return slot >= 0 && slot < slots.size() ? slots.at(slot) : QVariant();
+        }
+
+    private:
+        friend class Config;
+        QVariantMap values;
+        QVector<QVariant> slots;  // indexed by handle slot, see resolve()
+    };
+
+    std::shared_ptr<const Snapshot> snapshot() const;
+
+    // Typed handles
+    // resolve() maps a key to a slot once at startup; every read through
+    // the handle is then a single indexed load from the current snapshot —
+    // no hashing or string compares in the physics and monitoring loops.
+    template <typename T>
+    class Handle {
+    public:
+        Handle() = default;
+
+        T get() const {
+            const QVariant v = Config::instance().snapshot()->slotValue(slot_);
+            return v.isValid() ? v.value<T>() : default_;
+        }
+
+        bool isResolved() const { return slot_ >= 0; }
+
+    private:
+        friend class Config;
+        int slot_{-1};
+        T default_{};
+    };
+
+    template <typename T>
+    Handle<T> resolve(const QString& key, const T& defaultValue = T()) {
+        Handle<T> handle;
+        handle.slot_ = resolveSlot(key);
+        handle.default_ = defaultValue;
+        return handle;
+    }
+
 signals:
     void configChanged(const QString& key);
 
@@ -38,6 +97,9 @@ private:
     Config(const Config&) = delete;
     Config& operator=(const Config&) = delete;
 
+    void publishLocked();
+    int resolveSlot(const QString& key);
+
     struct Private;
     std::unique_ptr<Private> d;
 };
@@ -2,12 +2,44 @@
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QHash>
 #include <QDebug>
+#include <atomic>
 
 struct Config::Private {
-    QVariantMap config;
+    QVariantMap config;                        // master copy, writers only
+    QHash<QString, int> slotByKey;             // typed-handle registry
+    QMutex writeMutex;                         // serializes writers
+    std::shared_ptr<const Snapshot> current;   // published for lock-free reads
 };
 
+void Config::publishLocked()
+{
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->values = d->config;
+    snapshot->slots.resize(d->slotByKey.size());
+    for (auto it = d->slotByKey.constBegin(); it != d->slotByKey.constEnd(); ++it) {
+        snapshot->slots[it.value()] = d->config.value(it.key());
+    }
+    std::atomic_store(&d->current,
+                      std::static_pointer_cast<const Snapshot>(snapshot));
+}
+
+int Config::resolveSlot(const QString& key)
+{
+    QMutexLocker locker(&d->writeMutex);
+    auto it = d->slotByKey.find(key);
+    if (it != d->slotByKey.end()) {
+        return it.value();
+    }
+    const int slot = d->slotByKey.size();
+    d->slotByKey.insert(key, slot);
+    publishLocked();  // make the new slot visible to readers immediately
+    return slot;
+}
+
 Config& Config::instance() {
     static Config instance;
     return instance;
@@ -16,7 +48,34 @@ Config& Config::instance() {
 Config::Config(QObject* parent)
     : QObject(parent)
     , d(std::make_unique<Private>())
-{}
+{
+    QMutexLocker locker(&d->writeMutex);
+    publishLocked();
+}
+
+std::shared_ptr<const Config::Snapshot> Config::snapshot() const {
+    return std::atomic_load(&d->current);
+}
+
+QString Config::Snapshot::getString(const QString& key, const QString& defaultValue) const {
+    return values.value(key, defaultValue).toString();
+}
+
+int Config::Snapshot::getInt(const QString& key, int defaultValue) const {
+    return values.value(key, defaultValue).toInt();
+}
+
+double Config::Snapshot::getDouble(const QString& key, double defaultValue) const {
+    return values.value(key, defaultValue).toDouble();
+}
+
+bool Config::Snapshot::getBool(const QString& key, bool defaultValue) const {
+    return values.value(key, defaultValue).toBool();
+}
+
+QVariantMap Config::Snapshot::getMap(const QString& key) const {
+    return values.value(key).toMap();
+}
 
 bool Config::load(const QString& filename) {
     QFile file(filename);
@@ -31,7 +90,9 @@ bool Config::load(const QString& filename) {
         return false;
     }
 
+    QMutexLocker locker(&d->writeMutex);
     d->config = doc.object().toVariantMap();
+    publishLocked();
     return true;
 }
 
@@ -42,51 +103,74 @@ void Config::save(const QString& filename) const {
         return;
     }
 
-    QJsonDocument doc(QJsonObject::fromVariantMap(d->config));
+    // Serialize from the published snapshot so a concurrent writer cannot
+    // tear the map mid-save
+    auto snap = std::atomic_load(&d->current);
+    QJsonDocument doc(QJsonObject::fromVariantMap(snap->values));
     file.write(doc.toJson(QJsonDocument::Indented));
 }
 
 QString Config::getString(const QString& key, const QString& defaultValue) const {
-    return d->config.value(key, defaultValue).toString();
+    return snapshot()->getString(key, defaultValue);
 }
 
 int Config::getInt(const QString& key, int defaultValue) const {
-    return d->config.value(key, defaultValue).toInt();
+    return snapshot()->getInt(key, defaultValue);
 }
 
 double Config::getDouble(const QString& key, double defaultValue) const {
-    return d->config.value(key, defaultValue).toDouble();
+    return snapshot()->getDouble(key, defaultValue);
 }
 
 bool Config::getBool(const QString& key, bool defaultValue) const {
-    return d->config.value(key, defaultValue).toBool();
+    return snapshot()->getBool(key, defaultValue);
 }
 
 QVariantMap Config::getMap(const QString& key) const {
-    return d->config.value(key).toMap();
+    return snapshot()->getMap(key);
 }
 
 void Config::setString(const QString& key, const QString& value) {
-    d->config[key] = value;
+    {
+        QMutexLocker locker(&d->writeMutex);
+        d->config[key] = value;
+        publishLocked();
+    }
     emit configChanged(key);
 }
 
 void Config::setInt(const QString& key, int value) {
-    d->config[key] = value;
+    {
+        QMutexLocker locker(&d->writeMutex);
+        d->config[key] = value;
+        publishLocked();
+    }
     emit configChanged(key);
 }
 
 void Config::setDouble(const QString& key, double value) {
-    d->config[key] = value;
+    {
+        QMutexLocker locker(&d->writeMutex);
+        d->config[key] = value;
+        publishLocked();
+    }
     emit configChanged(key);
 }
 
 void Config::setBool(const QString& key, bool value) {
-    d->config[key] = value;
+    {
+        QMutexLocker locker(&d->writeMutex);
+        d->config[key] = value;
+        publishLocked();
+    }
     emit configChanged(key);
 }
 
 void Config::setMap(const QString& key, const QVariantMap& value) {
-    d->config[key] = value;
+    {
+        QMutexLocker locker(&d->writeMutex);
+        d->config[key] = value;
+        publishLocked();
+    }
     emit configChanged(key);
 }
@@ -19,12 +19,223 @@ Logger::Logger(QObject* parent)
 
 Logger::~Logger()
 {
+    setAsyncLogging(false);
+    closeBinaryFile();
     if (logFile_.isOpen()) {
         fileStream_.flush();
         logFile_.close();
     }
 }
 
+void Logger::setBinaryLogFormat(bool enabled)
+{
+    QMutexLocker locker(&mutex_);
+    if (enabled == binaryFormat_) {
+        return;
+    }
+    binaryFormat_ = enabled;
+    if (enabled) {
+        openBinaryFile();
+    } else {
+        closeBinaryFile();
+    }
+}
+
+bool Logger::isBinaryLogFormatEnabled() const
+{
+    return binaryFormat_;
+}
+
+quint32 Logger::registerLogTemplate(const QString& templateString)
+{
+    QMutexLocker locker(&mutex_);
+
+    auto it = templateIds_.find(templateString);
+    if (it != templateIds_.end()) {
+        return it.value();
+    }
+
+    quint32 id = nextTemplateId_++;
+    templateIds_.insert(templateString, id);
+
+    // Template definitions are written once so the file is self-describing
+    if (binaryFile_.isOpen()) {
+        binaryStream_ << kRecordTemplateDef << id << templateString;
+    }
+    return id;
+}
+
+void Logger::logStructured(LogLevel level, quint32 templateId,
+                           const QVariantList& args,
+                           const QString& component)
+{
+    if (level < logLevel_) {
+        return;
+    }
+
+    QMutexLocker locker(&mutex_);
+    if (!binaryFormat_ || !binaryFile_.isOpen()) {
+        return;
+    }
+
+    binaryStream_ << kRecordMessage
+                  << static_cast<quint8>(level)
+                  << templateId
+                  << QDateTime::currentMSecsSinceEpoch()
+                  << quint64(quintptr(QThread::currentThreadId()))
+                  << component
+                  << args;
+
+    if (binaryFile_.size() >= maxFileSize_) {
+        // Rotate alongside the text log naming scheme
+        closeBinaryFile();
+        QString backupName = QString("%1.1").arg(binaryFile_.fileName());
+        QFile::remove(backupName);
+        QFile::rename(binaryFile_.fileName(), backupName);
+        openBinaryFile();
+    }
+}
+
+void Logger::openBinaryFile()
+{
+    binaryFile_.setFileName(logFilePath_ + ".blog");
+    if (!binaryFile_.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qWarning() << "Failed to open binary log file:" << binaryFile_.fileName();
+        return;
+    }
+    binaryStream_.setDevice(&binaryFile_);
+    binaryStream_.setVersion(QDataStream::Qt_5_12);
+
+    if (binaryFile_.size() == 0) {
+        binaryStream_ << kBinaryMagic << kBinaryVersion;
+    }
+
+    // Re-emit known templates so each file segment stands alone
+    for (auto it = templateIds_.constBegin(); it != templateIds_.constEnd(); ++it) {
+        binaryStream_ << kRecordTemplateDef << it.value() << it.key();
+    }
+}
+
+void Logger::closeBinaryFile()
+{
+    if (binaryFile_.isOpen()) {
+        binaryStream_.setDevice(nullptr);
+        binaryFile_.close();
+    }
+}
+
+void Logger::setAsyncLogging(bool enabled)
+{
+    if (enabled == asyncEnabled_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    if (enabled) {
+        ring_ = std::vector<AsyncRecord>(kRingCapacity);
+        for (quint64 i = 0; i < kRingCapacity; ++i) {
+            ring_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        ringHead_.store(0, std::memory_order_relaxed);
+        ringTail_.store(0, std::memory_order_relaxed);
+        drainStop_.store(false, std::memory_order_relaxed);
+        drainThread_ = std::thread(&Logger::drainLoop, this);
+        asyncEnabled_.store(true, std::memory_order_release);
+    } else {
+        asyncEnabled_.store(false, std::memory_order_release);
+        drainStop_.store(true, std::memory_order_release);
+        if (drainThread_.joinable()) {
+            drainThread_.join();
+        }
+        ring_.clear();
+    }
+}
+
+bool Logger::isAsyncLoggingEnabled() const
+{
+    return asyncEnabled_.load(std::memory_order_acquire);
+}
+
+quint64 Logger::droppedMessageCount() const
+{
+    return droppedCount_.load(std::memory_order_relaxed);
+}
+
+bool Logger::tryEnqueueAsync(LogLevel level, const QString& message, const QString& component)
+{
+    quint64 head = ringHead_.load(std::memory_order_relaxed);
+    for (;;) {
+        AsyncRecord& cell = ring_[head & (kRingCapacity - 1)];
+        quint64 seq = cell.sequence.load(std::memory_order_acquire);
+        qint64 diff = static_cast<qint64>(seq) - static_cast<qint64>(head);
+
+        if (diff == 0) {
+            if (ringHead_.compare_exchange_weak(head, head + 1,
+                                                std::memory_order_relaxed)) {
+                cell.level = level;
+                cell.message = message;
+                cell.component = component;
+                cell.timestampMs = QDateTime::currentMSecsSinceEpoch();
+                cell.threadId = quintptr(QThread::currentThreadId());
+                cell.sequence.store(head + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false;  // ring full
+        } else {
+            head = ringHead_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::drainLoop()
+{
+    while (true) {
+        bool wrote = false;
+        quint64 tail = ringTail_.load(std::memory_order_relaxed);
+
+        // Drain whatever is available as one batch, flushing once at the end
+        while (true) {
+            AsyncRecord& cell = ring_[tail & (kRingCapacity - 1)];
+            quint64 seq = cell.sequence.load(std::memory_order_acquire);
+            if (static_cast<qint64>(seq) - static_cast<qint64>(tail + 1) != 0) {
+                break;
+            }
+
+            {
+                QMutexLocker locker(&mutex_);
+                // Format with the enqueue-time timestamp and producer
+                // thread, not the drainer's
+                QString formatted = formatMessage(cell.level, cell.message,
+                                                  cell.component,
+                                                  cell.timestampMs,
+                                                  cell.threadId);
+                if (fileOutput_ && logFile_.isOpen()) {
+                    fileStream_ << formatted << Qt::endl;
+                }
+                emit logMessageReceived(cell.level, cell.message, cell.component);
+            }
+
+            cell.message.clear();
+            cell.component.clear();
+            cell.sequence.store(tail + kRingCapacity, std::memory_order_release);
+            ringTail_.store(++tail, std::memory_order_relaxed);
+            wrote = true;
+        }
+
+        if (wrote) {
+            QMutexLocker locker(&mutex_);
+            if (fileOutput_ && logFile_.isOpen()) {
+                fileStream_.flush();
+                checkFileSize();
+            }
+        } else if (drainStop_.load(std::memory_order_acquire)) {
+            return;
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
 Logger& Logger::instance()
 {
     static Logger instance;
@@ -139,6 +350,21 @@ void Logger::critical(const QString& message, const QString& component)
 }
 
 void Logger::log(LogLevel level, const QString& message, const QString& component)
+{
+    if (asyncEnabled_.load(std::memory_order_acquire)) {
+        if (tryEnqueueAsync(level, message, component)) {
+            return;
+        }
+        // Overflow policy: shed Debug/Info, never lose Warning and above
+        if (level < LogLevel::Warning) {
+            droppedCount_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+    logSync(level, message, component);
+}
+
+void Logger::logSync(LogLevel level, const QString& message, const QString& component)
 {
     QMutexLocker locker(&mutex_);
     
@@ -209,14 +435,23 @@ void Logger::rotateLogFiles()
 
 QString Logger::formatMessage(LogLevel level, const QString& message, const QString& component) const
 {
-    QString timestamp = QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss.zzz");
-    QString threadId = QString("0x%1").arg(quintptr(QThread::currentThreadId()), 8, 16, QLatin1Char('0'));
+    return formatMessage(level, message, component,
+                         QDateTime::currentMSecsSinceEpoch(),
+                         quintptr(QThread::currentThreadId()));
+}
+
+QString Logger::formatMessage(LogLevel level, const QString& message, const QString& component,
+                              qint64 timestampMs, quintptr threadId) const
+{
+    QString timestamp = QDateTime::fromMSecsSinceEpoch(timestampMs)
+        .toString("yyyy-MM-dd hh:mm:ss.zzz");
+    QString threadIdStr = QString("0x%1").arg(threadId, 8, 16, QLatin1Char('0'));
     QString levelStr = levelToString(level);
     QString componentStr = component.isEmpty() ? "App" : component;
-    
+
     return QString("[%1] [%2] [%3] [%4] %5")
         .arg(timestamp)
-        .arg(threadId)
+        .arg(threadIdStr)
         .arg(levelStr)
         .arg(componentStr)
         .arg(message);
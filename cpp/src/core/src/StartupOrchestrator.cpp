@@ -0,0 +1,175 @@
+#include "StartupOrchestrator.hpp"
+
+#include <chrono>
+
+void StartupOrchestrator::registerSubsystem(const QString& name,
+                                            InitFunction init,
+                                            const QVector<QString>& dependsOn,
+                                            Phase phase) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Subsystem subsystem;
+    subsystem.init = std::move(init);
+    for (const QString& dependency : dependsOn) {
+        subsystem.dependsOn.push_back(dependency);
+    }
+    subsystem.phase = phase;
+    subsystems_[name] = std::move(subsystem);
+}
+
+bool StartupOrchestrator::dependenciesReady(Subsystem& subsystem) {
+    // Caller holds mutex_
+    for (const QString& name : subsystem.dependsOn) {
+        auto it = subsystems_.find(name);
+        if (it == subsystems_.end() || it->second.state == State::Failed ||
+            it->second.state == State::Skipped) {
+            subsystem.state = State::Skipped;
+            stateChanged_.notify_all();
+            return false;
+        }
+        if (it->second.state != State::Done) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StartupOrchestrator::execute(Phase phase, int numThreads) {
+    if (numThreads <= 0) {
+        numThreads = static_cast<int>(std::thread::hardware_concurrency());
+        if (numThreads <= 0) {
+            numThreads = 4;
+        }
+    }
+    auto worker = [this, phase]() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            // Find a pending subsystem of this phase whose
+            // dependencies are all done; skipped cascades happen in
+            // dependenciesReady
+            std::map<QString, Subsystem>::iterator ready = subsystems_.end();
+            bool anyPending = false;
+            for (auto it = subsystems_.begin(); it != subsystems_.end(); ++it) {
+                Subsystem& subsystem = it->second;
+                if (subsystem.phase != phase ||
+                    subsystem.state != State::Pending) {
+                    continue;
+                }
+                anyPending = true;
+                if (dependenciesReady(subsystem) &&
+                    subsystem.state == State::Pending) {
+                    ready = it;
+                    break;
+                }
+            }
+            if (ready == subsystems_.end()) {
+                if (!anyPending) {
+                    return;
+                }
+                // Pending work blocked with nothing running means an
+                // unsatisfiable graph (cycle or cross-phase
+                // dependency); skip it rather than deadlock
+                bool anyRunning = false;
+                for (const auto& entry : subsystems_) {
+                    if (entry.second.state == State::Running) {
+                        anyRunning = true;
+                        break;
+                    }
+                }
+                if (!anyRunning) {
+                    for (auto& entry : subsystems_) {
+                        if (entry.second.phase == phase &&
+                            entry.second.state == State::Pending) {
+                            entry.second.state = State::Skipped;
+                        }
+                    }
+                    stateChanged_.notify_all();
+                    return;
+                }
+                stateChanged_.wait(lock);
+                continue;
+            }
+            Subsystem& subsystem = ready->second;
+            subsystem.state = State::Running;
+            lock.unlock();
+            const auto started = std::chrono::steady_clock::now();
+            bool ok = false;
+            try {
+                ok = subsystem.init();
+            } catch (...) {
+                ok = false;
+            }
+            const auto finished = std::chrono::steady_clock::now();
+            lock.lock();
+            subsystem.elapsedMs =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    finished - started)
+                    .count();
+            subsystem.state = ok ? State::Done : State::Failed;
+            stateChanged_.notify_all();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int i = 0; i < numThreads; ++i) {
+        pool.emplace_back(worker);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : subsystems_) {
+        if (entry.second.phase == phase &&
+            entry.second.state != State::Done) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool StartupOrchestrator::run(int numThreads) {
+    return execute(Phase::Critical, numThreads);
+}
+
+void StartupOrchestrator::startDeferred(int numThreads) {
+    deferredWorkers_.emplace_back([this, numThreads]() {
+        execute(Phase::Deferred, numThreads);
+    });
+}
+
+void StartupOrchestrator::waitDeferred() {
+    for (auto& worker : deferredWorkers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    deferredWorkers_.clear();
+}
+
+QVector<QString> StartupOrchestrator::failedSubsystems() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    QVector<QString> failed;
+    for (const auto& entry : subsystems_) {
+        if (entry.second.state == State::Failed) {
+            failed.push_back(entry.first);
+        }
+    }
+    return failed;
+}
+
+QVector<QString> StartupOrchestrator::skippedSubsystems() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    QVector<QString> skipped;
+    for (const auto& entry : subsystems_) {
+        if (entry.second.state == State::Skipped) {
+            skipped.push_back(entry.first);
+        }
+    }
+    return skipped;
+}
+
+qint64 StartupOrchestrator::elapsedMs(const QString& name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = subsystems_.find(name);
+    return it != subsystems_.end() ? it->second.elapsedMs : -1;
+}
@@ -28,12 +28,156 @@ VoiceAssistant::VoiceAssistant(QObject* parent)
     loadVoiceSamples(Config::instance().getResourcePath() + "/voices");
 }
 
+VoiceAssistant::~VoiceAssistant()
+{
+    stopListening();
+}
+
 VoiceAssistant& VoiceAssistant::instance()
 {
     static VoiceAssistant instance;
     return instance;
 }
 
+size_t VoiceAssistant::AudioRing::write(const float* data, size_t count)
+{
+    const size_t capacity = samples.size();
+    const size_t h = head.load(std::memory_order_relaxed);
+    const size_t t = tail.load(std::memory_order_acquire);
+    const size_t free = capacity - (h - t);
+    const size_t n = qMin(count, free);
+
+    for (size_t i = 0; i < n; ++i) {
+        samples[(h + i) % capacity] = data[i];
+    }
+    head.store(h + n, std::memory_order_release);
+    return n;
+}
+
+size_t VoiceAssistant::AudioRing::read(float* out, size_t maxCount)
+{
+    const size_t capacity = samples.size();
+    const size_t t = tail.load(std::memory_order_relaxed);
+    const size_t h = head.load(std::memory_order_acquire);
+    const size_t n = qMin(maxCount, h - t);
+
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = samples[(t + i) % capacity];
+    }
+    tail.store(t + n, std::memory_order_release);
+    return n;
+}
+
+void VoiceAssistant::setAudioInputDevice(QIODevice* device)
+{
+    audioInput_ = device;
+}
+
+void VoiceAssistant::setRecognizer(Recognizer recognizer)
+{
+    recognizer_ = std::move(recognizer);
+}
+
+void VoiceAssistant::registerCommand(const QString& phrase, const QString& intent)
+{
+    commandIntents_[phrase.toLower()] = intent;
+}
+
+void VoiceAssistant::startListening()
+{
+    if (listening_.load() || !audioInput_ || !recognizer_) {
+        return;
+    }
+
+    audioRing_.samples.assign(kAudioRingCapacity, 0.0f);
+    audioRing_.head.store(0);
+    audioRing_.tail.store(0);
+    listening_.store(true);
+
+    captureThread_ = std::thread(&VoiceAssistant::captureLoop, this);
+    recognitionThread_ = std::thread(&VoiceAssistant::recognitionLoop, this);
+}
+
+void VoiceAssistant::stopListening()
+{
+    if (!listening_.exchange(false)) {
+        return;
+    }
+    if (captureThread_.joinable()) {
+        captureThread_.join();
+    }
+    if (recognitionThread_.joinable()) {
+        recognitionThread_.join();
+    }
+}
+
+bool VoiceAssistant::isListening() const
+{
+    return listening_.load();
+}
+
+void VoiceAssistant::captureLoop()
+{
+    // Real-time side: move samples from the input device into the ring and
+    // nothing else, so capture never blocks on decoding
+    std::vector<float> chunk(1024);
+    while (listening_.load(std::memory_order_acquire)) {
+        const qint64 bytes = audioInput_->read(
+            reinterpret_cast<char*>(chunk.data()),
+            static_cast<qint64>(chunk.size() * sizeof(float)));
+        if (bytes <= 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            continue;
+        }
+        const size_t count = static_cast<size_t>(bytes) / sizeof(float);
+        size_t written = 0;
+        while (written < count && listening_.load(std::memory_order_acquire)) {
+            written += audioRing_.write(chunk.data() + written, count - written);
+            if (written < count) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+}
+
+void VoiceAssistant::recognitionLoop()
+{
+    // Streaming side: decode partials while the user is still speaking and
+    // dispatch the intent as soon as the recognizer marks a final result
+    std::vector<float> frame(1600);  // 100 ms at 16 kHz
+    while (listening_.load(std::memory_order_acquire)) {
+        const size_t count = audioRing_.read(frame.data(), frame.size());
+        if (count == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            continue;
+        }
+
+        bool finalResult = false;
+        const QString text = recognizer_(frame.data(), count, finalResult);
+        if (text.isEmpty()) {
+            continue;
+        }
+
+        if (finalResult) {
+            dispatchIntent(text);
+        } else {
+            emit partialTranscription(text);
+        }
+    }
+}
+
+void VoiceAssistant::dispatchIntent(const QString& transcription)
+{
+    const QString normalized = transcription.toLower().trimmed();
+    for (auto it = commandIntents_.constBegin(); it != commandIntents_.constEnd(); ++it) {
+        if (normalized.contains(it.key())) {
+            emit commandRecognized(it.value(), transcription);
+            return;
+        }
+    }
+    Logger::instance().debug("No intent matched transcription: " + transcription);
+}
+
 void VoiceAssistant::speak(const QString& messageId, const QVariantMap& params)
 {
     if (!enabled_) {
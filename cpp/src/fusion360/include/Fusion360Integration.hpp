@@ -7,6 +7,8 @@
 #include <QMap>
 #include <memory>
 
+#include "MeshStore.hpp"
+
 // Fusion 360 API includes
 #include "adsk/core/Application.h"
 #include "adsk/core/UserInterface.h"
@@ -81,6 +83,13 @@ public:
     void registerEventHandler(const QString& eventType, std::function<void(const QVariantMap&)> handler);
     void unregisterEventHandler(const QString& eventType);
 
+    // Shared mesh pool. Geometry fetched by openDocument is interned
+    // here instead of cached per document, so the thousands of standard
+    // parts a full-vehicle assembly repeats resolve to one resident mesh
+    // each; closeDocument releases the document's references and
+    // zero-reference meshes are evicted.
+    MeshStore& meshStore();
+
 signals:
     void connected();
     void disconnected();
@@ -113,6 +122,7 @@ private:
     void cleanupAPI();
     QString generateUniqueId() const;
     void handleAPIError(const QString& context);
+    void internDocumentGeometry(const QString& path);
 
     // Fusion 360 API objects
     adsk::core::Application* app_{nullptr};
@@ -124,4 +134,5 @@ private:
     QMap<QString, std::function<void(const QVariantMap&)>> eventHandlers_;
     QMap<QString, QString> modelIdMap_;
     QStringList macros_;
+    MeshStore meshStore_;
 };
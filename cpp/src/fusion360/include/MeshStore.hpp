@@ -0,0 +1,70 @@
+#pragma once
+
+#include <QByteArray>
+#include <QSharedPointer>
+#include <QString>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+// Content-addressed store of immutable meshes shared across documents.
+//
+// Vehicle assemblies reference the same standard parts thousands of
+// times, and caching each fetched document independently kept that many
+// identical geometry copies resident. The store hashes mesh content on
+// intern: identical geometry resolves to the one resident mesh and only
+// bumps its reference count, so a document holds lightweight references
+// into a deduplicated pool. Meshes are immutable once interned — sharing
+// needs no locking on the read path — and eviction is reference-counted:
+// when the last document referencing a mesh closes, its bytes are freed.
+class MeshStore {
+public:
+    using MeshHash = quint64;
+
+    // Immutable once interned; documents hold shared references
+    struct Mesh {
+        QByteArray vertices;
+        QByteArray triangles;
+        MeshHash hash{0};
+
+        qint64 bytes() const { return vertices.size() + triangles.size(); }
+    };
+
+    // Interns geometry on behalf of a document. Content already resident
+    // is answered with the existing mesh; new content is copied in once.
+    // Every intern is matched by the document's releaseDocument.
+    QSharedPointer<const Mesh> intern(const QString& documentId,
+                                      const QByteArray& vertices,
+                                      const QByteArray& triangles);
+
+    // Releases every reference the document holds; meshes reaching zero
+    // references are evicted and their bytes freed
+    void releaseDocument(const QString& documentId);
+
+    // Resident mesh for a content hash, null when not resident
+    QSharedPointer<const Mesh> find(MeshHash hash) const;
+    int referenceCount(MeshHash hash) const;
+
+    int uniqueMeshes() const;
+    qint64 residentBytes() const;
+
+    // Bytes the session did not allocate because interning resolved to
+    // an already-resident mesh
+    qint64 dedupedBytes() const;
+
+private:
+    struct Entry {
+        QSharedPointer<const Mesh> mesh;
+        int references{0};
+    };
+
+    static MeshHash hashGeometry(const QByteArray& vertices,
+                                 const QByteArray& triangles);
+
+    // Hash collisions land in short per-hash chains; content is compared
+    // on every hit, so distinct geometry is never conflated
+    std::unordered_map<MeshHash, std::vector<Entry>> entries_;
+    std::map<QString, std::vector<QSharedPointer<const Mesh>>> documentMeshes_;
+    qint64 residentBytes_{0};
+    qint64 dedupedBytes_{0};
+};
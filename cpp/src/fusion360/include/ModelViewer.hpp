@@ -47,6 +47,14 @@ struct ComponentMetrics {
     double performance;
 };
 
+enum class LodTier {
+    Full,       // import-resolution mesh
+    High,       // ~25% triangle count
+    Medium,     // ~5% triangle count
+    Low,        // ~1% triangle count
+    Proxy       // bounding-box stand-in
+};
+
 class ModelViewer : public QOpenGLWidget, protected QOpenGLFunctions {
     Q_OBJECT
 
@@ -81,8 +89,20 @@ public:
     void stopAnimation();
     void setAnimationSpeed(float speed);
 
+    // Level of Detail
+    // Decimated mesh tiers are precomputed once on import; each frame the
+    // tier matching a component's screen-space size is streamed in, and
+    // resident geometry is held under a GPU budget with LRU eviction so
+    // orbiting the full vehicle never pulls full-resolution meshes it
+    // cannot display.
+    void setLodEnabled(bool enabled);
+    void setGeometryBudget(qint64 bytes);
+    qint64 residentGeometryBytes() const;
+    LodTier activeLodTier(const QString& componentId) const;
+
 signals:
     void modelLoaded();
+    void lodTierChanged(const QString& componentId, LodTier tier);
     void renderingError(const QString& error);
     void componentSelected(const QString& componentId);
     void viewChanged();
@@ -111,6 +131,10 @@ private:
     void calculateBoundingBox();
     void optimizeRendering();
     void updateShadowMaps();
+    void precomputeLodTiers(const QString& componentId);
+    LodTier selectLodTier(const QString& componentId) const;
+    void streamLodTier(const QString& componentId, LodTier tier);
+    void evictLeastRecentlyUsed(qint64 bytesNeeded);
 
     struct Private;
     std::unique_ptr<Private> d;
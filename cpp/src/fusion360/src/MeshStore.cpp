@@ -0,0 +1,110 @@
+#include "MeshStore.hpp"
+
+#include <algorithm>
+
+MeshStore::MeshHash MeshStore::hashGeometry(const QByteArray& vertices,
+                                            const QByteArray& triangles) {
+    // FNV-1a over both buffers, with the vertex length folded in so that
+    // shifting bytes between the buffers changes the hash
+    MeshHash hash = 14695981039346656037ull;
+    auto mix = [&hash](const char* data, qint64 length) {
+        for (qint64 i = 0; i < length; ++i) {
+            hash ^= static_cast<quint8>(data[i]);
+            hash *= 1099511628211ull;
+        }
+    };
+    mix(vertices.constData(), vertices.size());
+    const quint64 boundary = static_cast<quint64>(vertices.size());
+    mix(reinterpret_cast<const char*>(&boundary), sizeof(boundary));
+    mix(triangles.constData(), triangles.size());
+    return hash;
+}
+
+QSharedPointer<const MeshStore::Mesh> MeshStore::intern(
+    const QString& documentId, const QByteArray& vertices,
+    const QByteArray& triangles) {
+    const MeshHash hash = hashGeometry(vertices, triangles);
+
+    auto& chain = entries_[hash];
+    for (auto& entry : chain) {
+        if (entry.mesh->vertices == vertices &&
+            entry.mesh->triangles == triangles) {
+            entry.references++;
+            dedupedBytes_ += entry.mesh->bytes();
+            documentMeshes_[documentId].push_back(entry.mesh);
+            return entry.mesh;
+        }
+    }
+
+    auto mesh = QSharedPointer<const Mesh>::create(Mesh{vertices, triangles, hash});
+    chain.push_back({mesh, 1});
+    residentBytes_ += mesh->bytes();
+    documentMeshes_[documentId].push_back(mesh);
+    return mesh;
+}
+
+void MeshStore::releaseDocument(const QString& documentId) {
+    auto doc = documentMeshes_.find(documentId);
+    if (doc == documentMeshes_.end()) {
+        return;
+    }
+
+    for (const auto& mesh : doc->second) {
+        auto chain_it = entries_.find(mesh->hash);
+        if (chain_it == entries_.end()) {
+            continue;
+        }
+        auto& chain = chain_it->second;
+        auto entry = std::find_if(chain.begin(), chain.end(),
+                                  [&mesh](const Entry& candidate) {
+                                      return candidate.mesh == mesh;
+                                  });
+        if (entry == chain.end()) {
+            continue;
+        }
+        if (--entry->references == 0) {
+            residentBytes_ -= entry->mesh->bytes();
+            chain.erase(entry);
+            if (chain.empty()) {
+                entries_.erase(chain_it);
+            }
+        }
+    }
+    documentMeshes_.erase(doc);
+}
+
+QSharedPointer<const MeshStore::Mesh> MeshStore::find(MeshHash hash) const {
+    auto chain = entries_.find(hash);
+    if (chain == entries_.end() || chain->second.empty()) {
+        return {};
+    }
+    return chain->second.front().mesh;
+}
+
+int MeshStore::referenceCount(MeshHash hash) const {
+    auto chain = entries_.find(hash);
+    if (chain == entries_.end()) {
+        return 0;
+    }
+    int references = 0;
+    for (const auto& entry : chain->second) {
+        references += entry.references;
+    }
+    return references;
+}
+
+int MeshStore::uniqueMeshes() const {
+    int count = 0;
+    for (const auto& [hash, chain] : entries_) {
+        count += static_cast<int>(chain.size());
+    }
+    return count;
+}
+
+qint64 MeshStore::residentBytes() const {
+    return residentBytes_;
+}
+
+qint64 MeshStore::dedupedBytes() const {
+    return dedupedBytes_;
+}
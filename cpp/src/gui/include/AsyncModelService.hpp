@@ -0,0 +1,109 @@
+#pragma once
+
+#include <QString>
+#include <QVariantMap>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Asynchronous model load/predict service behind MLModelTab.
+//
+// Weight files are memory-mapped on first use, so "loading" a model is
+// an mmap plus page faults on the weights actually touched rather than
+// reading the whole file up front — switching models in the tab is
+// instant. A small LRU of resident models keeps recently used weights
+// mapped and unmaps the coldest on overflow. Predictions run on a
+// worker pool and deliver through a result handler invoked on the
+// worker; the tab forwards into its queued signals, so the GUI thread
+// never blocks on inference.
+class AsyncModelService {
+public:
+    // Model weights as mapped from disk; valid only for the duration
+    // of the runner call
+    struct Weights {
+        const float* values{nullptr};
+        size_t count{0};
+    };
+
+    // Per-model inference function supplied at registration
+    using Runner =
+        std::function<QVariantMap(const Weights& weights, const QVariantMap& input)>;
+    using ResultHandler = std::function<void(const QString& modelId,
+                                             const QVariantMap& result, bool ok)>;
+
+    explicit AsyncModelService(int residentCapacity = 4, int numWorkers = 2);
+    ~AsyncModelService();
+
+    AsyncModelService(const AsyncModelService&) = delete;
+    AsyncModelService& operator=(const AsyncModelService&) = delete;
+
+    // Registers the weight file and runner; nothing is read until the
+    // first prediction
+    bool registerModel(const QString& modelId, const QString& weightPath,
+                       Runner runner);
+    bool unregisterModel(const QString& modelId);
+
+    // Queues a prediction; the handler fires on a worker thread
+    bool predict(const QString& modelId, const QVariantMap& input,
+                 ResultHandler onResult);
+
+    // Blocks until every queued prediction has completed
+    void drain();
+
+    int residentModels() const;
+    qint64 cacheHits() const;
+    qint64 cacheMisses() const;
+
+private:
+    // One mmap'd weight file; unmapped on destruction
+    struct Mapping {
+        Mapping(const std::string& path);
+        ~Mapping();
+        Weights weights() const;
+        void* base{nullptr};
+        size_t length{0};
+        bool ok{false};
+    };
+
+    struct Model {
+        std::string weightPath;
+        Runner runner;
+        std::shared_ptr<Mapping> mapping;  // null until first use
+        std::list<QString>::iterator lruEntry;
+        bool resident{false};
+    };
+
+    struct Task {
+        QString modelId;
+        QVariantMap input;
+        ResultHandler onResult;
+    };
+
+    // Returns the model's mapping, loading and evicting under the LRU
+    // policy; null shared_ptr when the file cannot be mapped
+    std::shared_ptr<Mapping> acquireMapping(const QString& modelId,
+                                            Runner& runner);
+    void workerLoop();
+
+    const size_t residentCapacity_;
+    mutable std::mutex mutex_;
+    std::condition_variable taskAvailable_;
+    std::condition_variable idle_;
+    std::map<QString, Model> models_;
+    std::list<QString> lru_;  // most recent at front
+    size_t residentCount_{0};
+    std::deque<Task> tasks_;
+    size_t inFlight_{0};
+    std::vector<std::thread> workers_;
+    bool stopping_{false};
+    std::atomic<qint64> hits_{0};
+    std::atomic<qint64> misses_{0};
+};
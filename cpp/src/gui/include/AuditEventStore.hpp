@@ -0,0 +1,88 @@
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Append-only segmented audit store behind SecurityTab.
+//
+// Events append to the active segment, which seals at a fixed capacity;
+// each sealed segment persists a sidecar index holding its time range
+// and per-user byte offsets. The capture path batches appends, so a
+// burst of alerts costs one write instead of one per event. Queries
+// walk segments newest-first, skip whole segments outside the requested
+// time range, and follow user offset lists instead of scanning, so the
+// tab renders the latest page instantly and filters stay proportional
+// to the events matched, not to months of log.
+class AuditEventStore {
+public:
+    struct Event {
+        qint64 timestampMs{0};
+        int severity{0};
+        QString user;
+        QString category;
+        QString message;
+    };
+
+    struct Query {
+        qint64 fromMs{-1};  // -1 leaves the bound open
+        qint64 toMs{-1};
+        QString user;       // empty matches any user
+        int minSeverity{-1};
+        int limit{100};
+    };
+
+    explicit AuditEventStore(const QString& directory,
+                             int segmentCapacity = 10000, int batchSize = 64);
+    ~AuditEventStore();
+
+    // Buffers the event; the batch is written once batchSize events
+    // accumulate or flush() runs
+    void append(const Event& event);
+    void flush();
+
+    // Newest events first; reads only the tail segments needed
+    QVector<Event> latest(int count) const;
+    QVector<Event> query(const Query& query) const;
+
+    qint64 totalEvents() const;
+    int segmentCount() const;
+
+private:
+    // Sidecar metadata for one segment; byte offsets point into the
+    // segment log for direct seeks
+    struct Segment {
+        std::string logPath;
+        std::string indexPath;
+        qint64 minTs{0};
+        qint64 maxTs{0};
+        qint64 count{0};
+        std::map<std::string, std::vector<qint64>> userOffsets;
+        qint64 bytes{0};
+        bool sealed{false};
+    };
+
+    void flushLocked();
+    void sealActiveLocked();
+    void openSegmentLocked();
+    bool loadSegment(Segment& segment) const;
+    void saveIndex(const Segment& segment) const;
+    // Reads events at the given byte offsets, newest offset last
+    std::vector<Event> readAt(const Segment& segment,
+                              const std::vector<qint64>& offsets) const;
+    std::vector<Event> readAll(const Segment& segment) const;
+    static std::string encode(const Event& event);
+    static bool decode(const std::string& line, Event& event);
+
+    std::string directory_;
+    const int segmentCapacity_;
+    const int batchSize_;
+
+    mutable std::mutex mutex_;
+    std::vector<Segment> segments_;  // oldest first; back() is active
+    std::vector<Event> pending_;
+    qint64 total_{0};
+};
@@ -12,6 +12,9 @@ public:
     ~BackupTab() override;
 
 public slots:
+    // Backed by IncrementalBackupEngine: content-defined chunks are
+    // deduplicated against the repository index, so nightly runs store
+    // only what changed, and restore reassembles from a manifest
     void startBackup();
     void startRestore();
     void showBackupHistory();
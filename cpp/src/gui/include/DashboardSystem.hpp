@@ -8,6 +8,8 @@
 #include <memory>
 #include <functional>
 
+class DashboardVirtualizer;
+
 class DashboardSystem : public QObject {
     Q_OBJECT
 
@@ -50,7 +52,11 @@ public:
         QMap<QString, QVariant> settings;
     };
 
-    // Dashboard management
+    // Dashboard management. Card widgets are virtualized through the
+    // DashboardVirtualizer: only visible cards are live, off-screen
+    // cards serialize to lightweight state and recycle their widgets
+    // through a per-type pool, and hidden cards pause their refresh
+    // subscriptions.
     void createDashboard(const QString& id, const DashboardConfig& config);
     void updateDashboard(const QString& id, const DashboardConfig& config);
     void removeDashboard(const QString& id);
@@ -58,6 +64,7 @@ public:
     
     // Widget management
     void addWidget(const QString& dashboardId, const WidgetConfig& config);
+    DashboardVirtualizer& virtualizer();
     void updateWidget(const QString& dashboardId, const QString& widgetId, const QMap<QString, QVariant>& data);
     void removeWidget(const QString& dashboardId, const QString& widgetId);
     
@@ -129,4 +136,5 @@ private:
     // State
     QMap<QString, std::unique_ptr<Dashboard>> dashboards_;
     QString currentTheme_;
+    DashboardVirtualizer* virtualizer_{nullptr};  // owned via QObject parent
 };
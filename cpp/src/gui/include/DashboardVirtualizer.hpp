@@ -0,0 +1,84 @@
+#pragma once
+
+#include <QObject>
+#include <QMap>
+#include <QRect>
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <QWidget>
+#include "DashboardSystem.hpp"
+
+// Dashboard card virtualization for DashboardSystem.
+//
+// Only cards intersecting the viewport own live widgets; everything
+// off-screen is serialized to a lightweight CardState and its widget
+// returned to a per-type recycling pool. Scrolling or switching pages
+// rebinds pooled widgets to the cards entering view instead of
+// constructing new ones, so a 200-card fleet layout instantiates only
+// the dozen or so visible. Per-card refresh subscriptions pause while
+// a card is virtualized, so hidden cards cost no idle CPU.
+class DashboardVirtualizer : public QObject {
+    Q_OBJECT
+
+public:
+    // Serialized stand-in for an off-screen card: enough to rebind a
+    // pooled widget without reconstructing it
+    struct CardState {
+        QString widgetId;
+        DashboardSystem::WidgetConfig config;
+        QRect geometry;
+        QMap<QString, QVariant> widgetState;
+        bool subscriptionPaused{true};
+    };
+
+    explicit DashboardVirtualizer(QObject* parent = nullptr);
+
+    // Registers a card without creating its widget; it materializes
+    // when the viewport first reaches it
+    void addCard(const QString& dashboardId,
+                 const DashboardSystem::WidgetConfig& config,
+                 const QRect& geometry);
+    void removeCard(const QString& dashboardId, const QString& widgetId);
+
+    // Drives materialization: cards entering the rect take widgets
+    // from the pool, cards leaving serialize back into CardState
+    void setViewport(const QString& dashboardId, const QRect& viewport);
+
+    // Page switches virtualize every card of the outgoing page in one
+    // pass; the pool absorbs the widgets for the incoming page
+    void activatePage(const QString& dashboardId);
+    void deactivatePage(const QString& dashboardId);
+
+    int liveWidgets() const;
+    int pooledWidgets(DashboardSystem::WidgetType type) const;
+    QVector<QString> visibleCards(const QString& dashboardId) const;
+
+    // Pool sizing; excess widgets beyond the cap are deleted on release
+    void setPoolCapacity(DashboardSystem::WidgetType type, int capacity);
+
+signals:
+    void cardMaterialized(const QString& dashboardId, const QString& widgetId);
+    void cardVirtualized(const QString& dashboardId, const QString& widgetId);
+    void subscriptionPaused(const QString& dashboardId, const QString& widgetId);
+    void subscriptionResumed(const QString& dashboardId, const QString& widgetId);
+
+private:
+    struct Card {
+        CardState state;
+        QWidget* widget{nullptr};  // null while virtualized
+    };
+
+    // Takes a recycled widget of the type or creates one at the pool
+    // floor; rebinds it from the serialized state
+    QWidget* materialize(const QString& dashboardId, Card& card);
+    void virtualize(const QString& dashboardId, Card& card);
+    QWidget* acquireFromPool(DashboardSystem::WidgetType type);
+    void releaseToPool(DashboardSystem::WidgetType type, QWidget* widget);
+
+    QMap<QString, QMap<QString, Card>> cards_;
+    QMap<QString, QRect> viewports_;
+    QMap<DashboardSystem::WidgetType, QVector<QWidget*>> pools_;
+    QMap<DashboardSystem::WidgetType, int> poolCapacity_;
+    int liveWidgets_{0};
+};
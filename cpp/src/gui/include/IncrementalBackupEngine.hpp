@@ -0,0 +1,89 @@
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Incremental backup engine behind BackupTab.
+//
+// Files are split with content-defined chunking (gear rolling hash), so
+// an insert near the start of a file shifts chunk boundaries locally
+// instead of invalidating every fixed-size block after it. Chunk hashes
+// are looked up in a persistent index over an append-only pack file;
+// only chunks never seen before are stored, so a nightly run uploads
+// roughly what changed rather than the whole repository. Each backup
+// writes a manifest listing every file as a chunk-hash sequence, and
+// restore reassembles files from the pack via the manifest. Chunking
+// and hashing, the scan-phase bottleneck, run on a worker pool with one
+// writer appending to the pack.
+class IncrementalBackupEngine {
+public:
+    struct Stats {
+        qint64 filesScanned{0};
+        qint64 bytesScanned{0};
+        qint64 chunksTotal{0};
+        qint64 chunksNew{0};
+        qint64 bytesStored{0};
+        QString manifestPath;
+        bool ok{false};
+    };
+
+    using ProgressHandler =
+        std::function<void(qint64 bytesScanned, qint64 bytesTotal)>;
+
+    // avgChunkBits sets the expected chunk size to 2^bits bytes
+    // (minimum a quarter of that, maximum four times)
+    explicit IncrementalBackupEngine(const QString& repositoryDir,
+                                     int avgChunkBits = 20);
+
+    // Scans sourceDir, stores unseen chunks, and writes a new manifest.
+    // hashThreads 0 uses the hardware concurrency.
+    Stats backup(const QString& sourceDir, int hashThreads = 0,
+                 const ProgressHandler& onProgress = {});
+
+    // Rebuilds the backed-up tree from a manifest into targetDir
+    bool restore(const QString& manifestPath, const QString& targetDir);
+
+    QVector<QString> manifests() const;
+    int chunkCount() const;
+
+    static quint64 hashChunk(const char* data, size_t length);
+
+private:
+    struct ChunkRef {
+        quint64 offset;
+        quint32 length;
+    };
+
+    struct FileEntry {
+        std::string relativePath;
+        qint64 size;
+        std::vector<quint64> chunkHashes;
+        std::vector<quint32> chunkLengths;
+    };
+
+    bool loadIndex();
+    // Appends the chunk to the pack if unseen; returns true when stored
+    bool storeChunk(quint64 hash, const char* data, quint32 length);
+    // Content-defined split of one file; fills the entry's chunk lists
+    // and stores unseen chunks
+    bool chunkFile(const std::string& absolutePath, FileEntry& entry,
+                   qint64& newBytes, qint64& newChunks);
+    bool writeManifest(const std::string& path,
+                       const std::vector<FileEntry>& entries) const;
+
+    std::string repositoryDir_;
+    std::string packPath_;
+    std::string indexPath_;
+    quint32 minChunk_;
+    quint32 maxChunk_;
+    quint64 boundaryMask_;
+
+    std::mutex storeMutex_;
+    std::map<quint64, ChunkRef> index_;
+};
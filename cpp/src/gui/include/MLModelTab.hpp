@@ -12,6 +12,10 @@ public:
     ~MLModelTab() override;
 
 public slots:
+    // Model loads and predictions go through AsyncModelService:
+    // weights are memory-mapped lazily with an LRU of resident models,
+    // and inference runs on its worker pool, so switching models never
+    // stalls the GUI thread
     void updatePrediction(const QString& model, const QVariantMap& prediction);
     void trainModel(const QString& model);
     void evaluateModel(const QString& model);
@@ -2,6 +2,7 @@
 
 #include <QMainWindow>
 #include <QTabWidget>
+#include <functional>
 #include <memory>
 
 class SystemMonitor;
@@ -47,6 +48,11 @@ private:
     void loadSettings();
     void saveSettings();
 
+    // Lazy tab construction: tabs register a factory behind a
+    // placeholder and are built on first activation
+    void addLazyTab(const QString& title, std::function<QWidget*()> factory);
+    void activateTab(int index);
+
     struct Private;
     std::unique_ptr<Private> d;
 };
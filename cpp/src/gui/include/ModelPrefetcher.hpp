@@ -0,0 +1,98 @@
+#pragma once
+
+#include <QString>
+#include <QVariant>
+#include <QVector>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Speculative prefetch of linked documents behind ModelRepositoryTab.
+//
+// Browsing the repository follows links: an operator opens a model,
+// then one of its dependencies, then a linked requirement — and each
+// click paid a network round trip. The prefetcher keeps an LRU cache of
+// fetched records and, whenever a model is selected, queues its
+// dependencies and linkedRequirements targets for background fetching
+// under a bounded budget. Navigating away cancels what the previous
+// selection queued (a generation counter makes stale work a no-op), so
+// the workers always chase the links of the model on screen. The
+// typical follow-the-dependency click then lands in warm cache.
+class ModelPrefetcher {
+public:
+    // One fetched model: display details plus the link targets that
+    // seed the next prefetch round
+    struct Record {
+        QVariantMap details;
+        QVector<QString> dependencies;
+        QVector<QString> linkedRequirements;
+        bool ok{false};
+    };
+
+    // Performs the actual (network) fetch; called on worker threads and
+    // inline for cache misses on selection
+    using Fetcher = std::function<Record(const QString& modelId)>;
+
+    explicit ModelPrefetcher(Fetcher fetcher, int cacheCapacity = 256,
+                             int prefetchBudget = 16, int numWorkers = 2);
+    ~ModelPrefetcher();
+
+    ModelPrefetcher(const ModelPrefetcher&) = delete;
+    ModelPrefetcher& operator=(const ModelPrefetcher&) = delete;
+
+    // Cache-through fetch for the selected model, then queues its link
+    // targets for background warming and cancels the previous
+    // selection's queue
+    Record select(const QString& modelId);
+
+    bool isWarm(const QString& modelId) const;
+
+    // Blocks until the queue is empty and no fetch is in flight
+    void drain();
+
+    qint64 hits() const;
+    qint64 misses() const;
+    qint64 prefetchedRecords() const;
+    qint64 cancelledPrefetches() const;
+
+private:
+    struct CacheEntry {
+        Record record;
+        std::list<QString>::iterator lruEntry;
+    };
+
+    struct Task {
+        QString modelId;
+        quint64 generation;
+    };
+
+    // Cache insert under the LRU policy; caller holds the lock
+    void insertLocked(const QString& modelId, Record record);
+    bool lookupLocked(const QString& modelId, Record& record);
+    void workerLoop();
+
+    Fetcher fetcher_;
+    const size_t cacheCapacity_;
+    const size_t prefetchBudget_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable taskAvailable_;
+    std::condition_variable idle_;
+    std::map<QString, CacheEntry> cache_;
+    std::list<QString> lru_;  // most recent at front
+    std::deque<Task> queue_;
+    quint64 generation_{0};
+    size_t inFlight_{0};
+    bool stopping_{false};
+    std::vector<std::thread> workers_;
+
+    qint64 hits_{0};
+    qint64 misses_{0};
+    qint64 prefetched_{0};
+    qint64 cancelled_{0};
+};
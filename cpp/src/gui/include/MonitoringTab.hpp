@@ -10,6 +10,7 @@ namespace QtCharts {
 }
 
 class QCustomPlot;
+class MetricsHistoryStore;
 
 class MonitoringTab : public QWidget {
     Q_OBJECT
@@ -18,11 +19,17 @@ public:
     explicit MonitoringTab(QWidget* parent = nullptr);
     ~MonitoringTab() override;
 
+    // Attach the shared metrics time-series store. Incoming samples are
+    // recorded into it, and chart redraws for historical windows read the
+    // store's pre-aggregated tiers instead of replaying raw samples.
+    void setHistoryStore(MetricsHistoryStore* store);
+
 public slots:
     void updateMetrics(const QVariantMap& metrics);
     void clearData();
     void exportMetrics();
     void setUpdateInterval(int msec);
+    void setHistoryWindow(qint64 durationMs);
 
 signals:
     void thresholdExceeded(const QString& metric, double value);
@@ -32,6 +39,7 @@ private:
     void setupUi();
     void setupCharts();
     void updateCharts(const QVariantMap& metrics);
+    void replotFromHistory();
     void checkThresholds(const QVariantMap& metrics);
     void detectAnomalies(const QVariantMap& metrics);
 
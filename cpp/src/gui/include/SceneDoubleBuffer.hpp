@@ -0,0 +1,73 @@
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Double-buffered scene state between telemetry and the render path.
+//
+// The visualizer used to mutate its scene representation on the GUI
+// thread as telemetry arrived, so 50 Hz updates raced painting and the
+// view hitched. Here telemetry workers stage changes into a back buffer
+// off-thread; the render path swaps buffers at a frame boundary and
+// draws from an immutable snapshot for the whole frame. Scene state is
+// a persistent tree: staging a component copies only the nodes on the
+// path from the root to that component, and every unchanged subtree is
+// shared by pointer between the front and back buffers — a brake-pad
+// update at 50 Hz copies a handful of nodes, not the vehicle.
+class SceneDoubleBuffer {
+public:
+    // Telemetry-driven visual state of one component
+    struct ComponentState {
+        QString status;       // "normal", "warning", "critical"
+        quint32 colorRgba{0};
+        double temperature{0.0};
+        double stress{0.0};
+        double wear{0.0};
+    };
+
+    // Immutable once published; children of untouched nodes are shared
+    // across buffer generations
+    struct Node {
+        QString name;
+        ComponentState state;
+        std::vector<std::shared_ptr<const Node>> children;
+    };
+    using NodePtr = std::shared_ptr<const Node>;
+
+    SceneDoubleBuffer();
+
+    // Telemetry side: stages the component at the hierarchy path into
+    // the back buffer, creating intermediate nodes on first sight.
+    // Callable from any thread.
+    void stage(const QVector<QString>& path, const ComponentState& state);
+
+    // Frame boundary: atomically makes the back buffer the new front
+    // and reports which paths changed since the previous publish
+    NodePtr publish(QVector<QVector<QString>>* changedPaths = nullptr);
+
+    // Render side: the snapshot to draw this frame; stable for as long
+    // as the caller holds it, regardless of concurrent staging
+    NodePtr frame() const;
+
+    // Lookup within a snapshot; null when the path does not exist
+    static const ComponentState* find(const NodePtr& root,
+                                      const QVector<QString>& path);
+
+    // Structural-sharing accounting across all publishes
+    qint64 nodesCopied() const;
+    qint64 nodesShared() const;
+
+private:
+    NodePtr updatePath(const NodePtr& node, const QVector<QString>& path,
+                       int depth, const ComponentState& state);
+
+    mutable std::mutex stageMutex_;      // serializes telemetry writers
+    NodePtr back_;                       // being built, writer-owned
+    NodePtr front_;                      // published, atomically swapped
+    QVector<QVector<QString>> dirty_;    // paths staged since last publish
+    qint64 nodesCopied_{0};
+    qint64 nodesShared_{0};
+};
@@ -12,6 +12,9 @@ public:
     ~SecurityTab() override;
 
 public slots:
+    // Alerts land in the segmented AuditEventStore: appends batch on
+    // the capture path, and the log view pages through windowed index
+    // queries instead of loading the full event history
     void addSecurityAlert(const QString& alert);
     void updateSecurityStatus(const QString& status);
     void showAccessLog();
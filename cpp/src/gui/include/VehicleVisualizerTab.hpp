@@ -69,6 +69,9 @@ private:
     void optimizePerformance();
     void handleViewportResize();
 
+    // Applies the published scene snapshot at a frame boundary
+    void syncPublishedScene();
+
     struct Private;
     std::unique_ptr<Private> d;
 };
@@ -0,0 +1,186 @@
+#include "AsyncModelService.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+AsyncModelService::Mapping::Mapping(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    struct stat info;
+    if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+        length = static_cast<size_t>(info.st_size);
+        void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped != MAP_FAILED) {
+            base = mapped;
+            ok = true;
+        }
+    }
+    ::close(fd);
+}
+
+AsyncModelService::Mapping::~Mapping() {
+    if (base) {
+        ::munmap(base, length);
+    }
+}
+
+AsyncModelService::Weights AsyncModelService::Mapping::weights() const {
+    Weights w;
+    w.values = static_cast<const float*>(base);
+    w.count = length / sizeof(float);
+    return w;
+}
+
+AsyncModelService::AsyncModelService(int residentCapacity, int numWorkers)
+    : residentCapacity_(residentCapacity > 0 ? residentCapacity : 1) {
+    if (numWorkers <= 0) {
+        numWorkers = 2;
+    }
+    for (int i = 0; i < numWorkers; ++i) {
+        workers_.emplace_back(&AsyncModelService::workerLoop, this);
+    }
+}
+
+AsyncModelService::~AsyncModelService() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    taskAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+bool AsyncModelService::registerModel(const QString& modelId,
+                                      const QString& weightPath,
+                                      Runner runner) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (models_.count(modelId)) {
+        return false;
+    }
+    Model model;
+    model.weightPath = weightPath.toStdString();
+    model.runner = std::move(runner);
+    models_.emplace(modelId, std::move(model));
+    return true;
+}
+
+bool AsyncModelService::unregisterModel(const QString& modelId) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = models_.find(modelId);
+    if (it == models_.end()) {
+        return false;
+    }
+    if (it->second.resident) {
+        lru_.erase(it->second.lruEntry);
+        --residentCount_;
+    }
+    models_.erase(it);
+    return true;
+}
+
+bool AsyncModelService::predict(const QString& modelId,
+                                const QVariantMap& input,
+                                ResultHandler onResult) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopping_ || !models_.count(modelId)) {
+        return false;
+    }
+    tasks_.push_back(Task{modelId, input, std::move(onResult)});
+    taskAvailable_.notify_one();
+    return true;
+}
+
+void AsyncModelService::drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return tasks_.empty() && inFlight_ == 0; });
+}
+
+int AsyncModelService::residentModels() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int>(residentCount_);
+}
+
+qint64 AsyncModelService::cacheHits() const {
+    return hits_.load();
+}
+
+qint64 AsyncModelService::cacheMisses() const {
+    return misses_.load();
+}
+
+std::shared_ptr<AsyncModelService::Mapping>
+AsyncModelService::acquireMapping(const QString& modelId, Runner& runner) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = models_.find(modelId);
+    if (it == models_.end()) {
+        return nullptr;
+    }
+    Model& model = it->second;
+    runner = model.runner;
+    if (model.resident) {
+        lru_.splice(lru_.begin(), lru_, model.lruEntry);
+        ++hits_;
+        return model.mapping;
+    }
+    ++misses_;
+    auto mapping = std::make_shared<Mapping>(model.weightPath);
+    if (!mapping->ok) {
+        return nullptr;
+    }
+    // Evict the coldest resident model; in-flight predictions keep
+    // their mapping alive through the shared_ptr
+    while (residentCount_ >= residentCapacity_ && !lru_.empty()) {
+        auto victim = models_.find(lru_.back());
+        lru_.pop_back();
+        if (victim != models_.end()) {
+            victim->second.mapping.reset();
+            victim->second.resident = false;
+            --residentCount_;
+        }
+    }
+    model.mapping = mapping;
+    lru_.push_front(modelId);
+    model.lruEntry = lru_.begin();
+    model.resident = true;
+    ++residentCount_;
+    return mapping;
+}
+
+void AsyncModelService::workerLoop() {
+    for (;;) {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            taskAvailable_.wait(lock,
+                                [this] { return stopping_ || !tasks_.empty(); });
+            if (stopping_ && tasks_.empty()) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+            ++inFlight_;
+        }
+        Runner runner;
+        auto mapping = acquireMapping(task.modelId, runner);
+        QVariantMap result;
+        bool ok = false;
+        if (mapping && runner) {
+            result = runner(mapping->weights(), task.input);
+            ok = true;
+        }
+        if (task.onResult) {
+            task.onResult(task.modelId, result, ok);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            --inFlight_;
+        }
+        idle_.notify_all();
+    }
+}
@@ -0,0 +1,336 @@
+#include "AuditEventStore.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+std::string escapeField(const std::string& field) {
+    std::string escaped;
+    escaped.reserve(field.size());
+    for (char c : field) {
+        if (c == '\\') {
+            escaped += "\\\\";
+        } else if (c == '\t') {
+            escaped += "\\t";
+        } else if (c == ' ') {
+            escaped += "\\s";
+        } else if (c == '\n') {
+            escaped += "\\n";
+        } else {
+            escaped += c;
+        }
+    }
+    return escaped;
+}
+
+std::string unescapeField(const std::string& field) {
+    std::string plain;
+    plain.reserve(field.size());
+    for (size_t i = 0; i < field.size(); ++i) {
+        if (field[i] == '\\' && i + 1 < field.size()) {
+            const char next = field[++i];
+            plain += next == 't' ? '\t'
+                   : next == 'n' ? '\n'
+                   : next == 's' ? ' '
+                                 : next;
+        } else {
+            plain += field[i];
+        }
+    }
+    return plain;
+}
+
+} // namespace
+
+AuditEventStore::AuditEventStore(const QString& directory, int segmentCapacity,
+                                 int batchSize)
+    : directory_(directory.toStdString()),
+      segmentCapacity_(segmentCapacity > 0 ? segmentCapacity : 1),
+      batchSize_(batchSize > 0 ? batchSize : 1) {
+    fs::create_directories(directory_);
+
+    // Recover segments in order; sealed ones load from their sidecar
+    // index, the unsealed tail is rebuilt by scanning its log
+    std::vector<std::string> logs;
+    std::error_code ec;
+    for (const auto& item : fs::directory_iterator(directory_, ec)) {
+        const std::string name = item.path().filename().string();
+        if (name.rfind("segment-", 0) == 0 &&
+            name.size() > 4 && name.substr(name.size() - 4) == ".log") {
+            logs.push_back(item.path().string());
+        }
+    }
+    std::sort(logs.begin(), logs.end());
+    for (const auto& logPath : logs) {
+        Segment segment;
+        segment.logPath = logPath;
+        segment.indexPath = logPath.substr(0, logPath.size() - 4) + ".idx";
+        if (loadSegment(segment)) {
+            total_ += segment.count;
+            segments_.push_back(std::move(segment));
+        }
+    }
+    if (segments_.empty() || segments_.back().sealed) {
+        openSegmentLocked();
+    }
+}
+
+AuditEventStore::~AuditEventStore() {
+    flush();
+}
+
+void AuditEventStore::append(const Event& event) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back(event);
+    if (static_cast<int>(pending_.size()) >= batchSize_) {
+        flushLocked();
+    }
+}
+
+void AuditEventStore::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushLocked();
+}
+
+void AuditEventStore::flushLocked() {
+    if (pending_.empty()) {
+        return;
+    }
+    std::ofstream log(segments_.back().logPath,
+                      std::ios::binary | std::ios::app);
+    for (const Event& event : pending_) {
+        Segment& active = segments_.back();
+        const std::string line = encode(event);
+        log.write(line.data(), static_cast<std::streamsize>(line.size()));
+        active.userOffsets[event.user.toStdString()].push_back(active.bytes);
+        active.bytes += static_cast<qint64>(line.size());
+        if (active.count == 0) {
+            active.minTs = event.timestampMs;
+        }
+        active.minTs = std::min(active.minTs, event.timestampMs);
+        active.maxTs = std::max(active.maxTs, event.timestampMs);
+        ++active.count;
+        ++total_;
+        if (active.count >= segmentCapacity_) {
+            log.close();
+            sealActiveLocked();
+            openSegmentLocked();
+            log.open(segments_.back().logPath,
+                     std::ios::binary | std::ios::app);
+        }
+    }
+    pending_.clear();
+}
+
+void AuditEventStore::sealActiveLocked() {
+    segments_.back().sealed = true;
+    saveIndex(segments_.back());
+}
+
+void AuditEventStore::openSegmentLocked() {
+    Segment segment;
+    std::ostringstream name;
+    name << directory_ << "/segment-";
+    name.width(8);
+    name.fill('0');
+    name << segments_.size() << ".log";
+    segment.logPath = name.str();
+    segment.indexPath =
+        segment.logPath.substr(0, segment.logPath.size() - 4) + ".idx";
+    segments_.push_back(std::move(segment));
+}
+
+void AuditEventStore::saveIndex(const Segment& segment) const {
+    std::ofstream idx(segment.indexPath);
+    idx << segment.minTs << ' ' << segment.maxTs << ' ' << segment.count
+        << ' ' << segment.bytes << '\n';
+    for (const auto& entry : segment.userOffsets) {
+        idx << escapeField(entry.first);
+        for (qint64 offset : entry.second) {
+            idx << ' ' << offset;
+        }
+        idx << '\n';
+    }
+}
+
+bool AuditEventStore::loadSegment(Segment& segment) const {
+    std::ifstream idx(segment.indexPath);
+    if (idx) {
+        std::string header;
+        std::getline(idx, header);
+        std::istringstream fields(header);
+        fields >> segment.minTs >> segment.maxTs >> segment.count >>
+            segment.bytes;
+        std::string line;
+        while (std::getline(idx, line)) {
+            std::istringstream entry(line);
+            std::string user;
+            entry >> user;
+            auto& offsets = segment.userOffsets[unescapeField(user)];
+            qint64 offset;
+            while (entry >> offset) {
+                offsets.push_back(offset);
+            }
+        }
+        segment.sealed = true;
+        return true;
+    }
+    // Unsealed tail: rebuild metadata from the log
+    std::ifstream log(segment.logPath, std::ios::binary);
+    if (!log) {
+        return false;
+    }
+    std::string line;
+    while (std::getline(log, line)) {
+        Event event;
+        if (!decode(line, event)) {
+            continue;
+        }
+        segment.userOffsets[event.user.toStdString()].push_back(segment.bytes);
+        segment.bytes += static_cast<qint64>(line.size()) + 1;
+        if (segment.count == 0) {
+            segment.minTs = event.timestampMs;
+        }
+        segment.minTs = std::min(segment.minTs, event.timestampMs);
+        segment.maxTs = std::max(segment.maxTs, event.timestampMs);
+        ++segment.count;
+    }
+    return true;
+}
+
+std::vector<AuditEventStore::Event> AuditEventStore::readAt(
+    const Segment& segment, const std::vector<qint64>& offsets) const {
+    std::vector<Event> events;
+    std::ifstream log(segment.logPath, std::ios::binary);
+    if (!log) {
+        return events;
+    }
+    std::string line;
+    for (qint64 offset : offsets) {
+        log.clear();
+        log.seekg(static_cast<std::streamoff>(offset));
+        if (!std::getline(log, line)) {
+            continue;
+        }
+        Event event;
+        if (decode(line, event)) {
+            events.push_back(std::move(event));
+        }
+    }
+    return events;
+}
+
+std::vector<AuditEventStore::Event> AuditEventStore::readAll(
+    const Segment& segment) const {
+    std::vector<Event> events;
+    std::ifstream log(segment.logPath, std::ios::binary);
+    std::string line;
+    while (std::getline(log, line)) {
+        Event event;
+        if (decode(line, event)) {
+            events.push_back(std::move(event));
+        }
+    }
+    return events;
+}
+
+QVector<AuditEventStore::Event> AuditEventStore::latest(int count) const {
+    Query tail;
+    tail.limit = count;
+    return query(tail);
+}
+
+QVector<AuditEventStore::Event> AuditEventStore::query(
+    const Query& query) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const_cast<AuditEventStore*>(this)->flushLocked();
+
+    QVector<Event> matched;
+    const std::string user = query.user.toStdString();
+    for (auto it = segments_.rbegin(); it != segments_.rend(); ++it) {
+        if (static_cast<int>(matched.size()) >= query.limit) {
+            break;
+        }
+        const Segment& segment = *it;
+        if (segment.count == 0 ||
+            (query.fromMs >= 0 && segment.maxTs < query.fromMs) ||
+            (query.toMs >= 0 && segment.minTs > query.toMs)) {
+            continue;
+        }
+        std::vector<Event> events;
+        if (!user.empty()) {
+            auto offsets = segment.userOffsets.find(user);
+            if (offsets == segment.userOffsets.end()) {
+                continue;
+            }
+            events = readAt(segment, offsets->second);
+        } else {
+            events = readAll(segment);
+        }
+        // Newest first within the segment
+        for (auto event = events.rbegin(); event != events.rend(); ++event) {
+            if (query.fromMs >= 0 && event->timestampMs < query.fromMs) {
+                continue;
+            }
+            if (query.toMs >= 0 && event->timestampMs > query.toMs) {
+                continue;
+            }
+            if (query.minSeverity >= 0 && event->severity < query.minSeverity) {
+                continue;
+            }
+            matched.push_back(*event);
+            if (static_cast<int>(matched.size()) >= query.limit) {
+                break;
+            }
+        }
+    }
+    return matched;
+}
+
+qint64 AuditEventStore::totalEvents() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_ + static_cast<qint64>(pending_.size());
+}
+
+int AuditEventStore::segmentCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int>(segments_.size());
+}
+
+std::string AuditEventStore::encode(const Event& event) {
+    std::ostringstream line;
+    line << event.timestampMs << '\t' << event.severity << '\t'
+         << escapeField(event.user.toStdString()) << '\t'
+         << escapeField(event.category.toStdString()) << '\t'
+         << escapeField(event.message.toStdString()) << '\n';
+    return line.str();
+}
+
+bool AuditEventStore::decode(const std::string& line, Event& event) {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    for (size_t i = 0; i <= line.size(); ++i) {
+        if (i == line.size() || line[i] == '\t') {
+            fields.push_back(line.substr(start, i - start));
+            start = i + 1;
+        }
+    }
+    if (fields.size() < 5) {
+        return false;
+    }
+    try {
+        event.timestampMs = std::stoll(fields[0]);
+        event.severity = std::stoi(fields[1]);
+    } catch (const std::exception&) {
+        return false;
+    }
+    event.user = QString::fromStdString(unescapeField(fields[2]));
+    event.category = QString::fromStdString(unescapeField(fields[3]));
+    event.message = QString::fromStdString(unescapeField(fields[4]));
+    return true;
+}
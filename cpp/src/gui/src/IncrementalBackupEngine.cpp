@@ -0,0 +1,311 @@
+#include "IncrementalBackupEngine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Gear table for the rolling hash, filled deterministically so chunk
+// boundaries are stable across runs and machines
+const std::array<quint64, 256>& gearTable() {
+    static const std::array<quint64, 256> table = [] {
+        std::array<quint64, 256> t{};
+        quint64 state = 0x2545f4914f6cdd1dull;
+        for (auto& entry : t) {
+            state += 0x9e3779b97f4a7c15ull;
+            quint64 z = state;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+            entry = z ^ (z >> 31);
+        }
+        return t;
+    }();
+    return table;
+}
+
+} // namespace
+
+IncrementalBackupEngine::IncrementalBackupEngine(const QString& repositoryDir,
+                                                 int avgChunkBits)
+    : repositoryDir_(repositoryDir.toStdString()) {
+    packPath_ = repositoryDir_ + "/chunks.pack";
+    indexPath_ = repositoryDir_ + "/chunks.idx";
+    const quint64 avg = 1ull << avgChunkBits;
+    minChunk_ = static_cast<quint32>(avg / 4);
+    maxChunk_ = static_cast<quint32>(avg * 4);
+    boundaryMask_ = avg - 1;
+    fs::create_directories(repositoryDir_);
+    loadIndex();
+}
+
+quint64 IncrementalBackupEngine::hashChunk(const char* data, size_t length) {
+    quint64 hash = 14695981039346656037ull;
+    for (size_t i = 0; i < length; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool IncrementalBackupEngine::loadIndex() {
+    std::ifstream file(indexPath_);
+    if (!file) {
+        return false;
+    }
+    quint64 hash, offset;
+    quint32 length;
+    while (file >> hash >> offset >> length) {
+        index_.emplace(hash, ChunkRef{offset, length});
+    }
+    return true;
+}
+
+bool IncrementalBackupEngine::storeChunk(quint64 hash, const char* data,
+                                         quint32 length) {
+    std::lock_guard<std::mutex> lock(storeMutex_);
+    if (index_.count(hash)) {
+        return false;
+    }
+    std::ofstream pack(packPath_, std::ios::binary | std::ios::app);
+    pack.seekp(0, std::ios::end);
+    const quint64 offset = static_cast<quint64>(pack.tellp());
+    pack.write(data, length);
+    std::ofstream idx(indexPath_, std::ios::app);
+    idx << hash << ' ' << offset << ' ' << length << '\n';
+    index_.emplace(hash, ChunkRef{offset, length});
+    return true;
+}
+
+bool IncrementalBackupEngine::chunkFile(const std::string& absolutePath,
+                                        FileEntry& entry, qint64& newBytes,
+                                        qint64& newChunks) {
+    std::ifstream file(absolutePath, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    const auto& gear = gearTable();
+    std::string buffer;
+    std::vector<char> readBlock(maxChunk_);
+    bool eof = false;
+    while (!eof || !buffer.empty()) {
+        // Keep enough buffered to find the next cut anywhere up to the
+        // maximum chunk size
+        while (!eof && buffer.size() < maxChunk_) {
+            file.read(readBlock.data(), readBlock.size());
+            const std::streamsize got = file.gcount();
+            if (got <= 0) {
+                eof = true;
+            } else {
+                buffer.append(readBlock.data(), static_cast<size_t>(got));
+            }
+        }
+        if (buffer.empty()) {
+            break;
+        }
+        size_t cut = std::min<size_t>(buffer.size(), maxChunk_);
+        if (buffer.size() > minChunk_) {
+            quint64 rolling = 0;
+            const size_t limit = cut;
+            for (size_t i = 0; i < limit; ++i) {
+                rolling = (rolling << 1) +
+                          gear[static_cast<unsigned char>(buffer[i])];
+                if (i + 1 >= minChunk_ && (rolling & boundaryMask_) == 0) {
+                    cut = i + 1;
+                    break;
+                }
+            }
+        }
+        const quint64 hash = hashChunk(buffer.data(), cut);
+        entry.chunkHashes.push_back(hash);
+        entry.chunkLengths.push_back(static_cast<quint32>(cut));
+        if (storeChunk(hash, buffer.data(), static_cast<quint32>(cut))) {
+            newBytes += static_cast<qint64>(cut);
+            ++newChunks;
+        }
+        buffer.erase(0, cut);
+    }
+    return true;
+}
+
+IncrementalBackupEngine::Stats IncrementalBackupEngine::backup(
+    const QString& sourceDir, int hashThreads,
+    const ProgressHandler& onProgress) {
+    Stats stats;
+    const fs::path root(sourceDir.toStdString());
+    std::error_code ec;
+    if (!fs::is_directory(root, ec)) {
+        return stats;
+    }
+
+    std::vector<FileEntry> entries;
+    qint64 totalBytes = 0;
+    for (const auto& item : fs::recursive_directory_iterator(root, ec)) {
+        if (!item.is_regular_file(ec)) {
+            continue;
+        }
+        FileEntry entry;
+        entry.relativePath = fs::relative(item.path(), root, ec).generic_string();
+        entry.size = static_cast<qint64>(item.file_size(ec));
+        totalBytes += entry.size;
+        entries.push_back(std::move(entry));
+    }
+
+    // Chunking and hashing dominate the scan; spread files across the
+    // pool while storeChunk serializes pack appends
+    if (hashThreads <= 0) {
+        hashThreads = static_cast<int>(std::thread::hardware_concurrency());
+        if (hashThreads <= 0) {
+            hashThreads = 4;
+        }
+    }
+    std::atomic<size_t> cursor{0};
+    std::atomic<qint64> scanned{0};
+    std::atomic<qint64> newBytes{0};
+    std::atomic<qint64> newChunks{0};
+    std::atomic<bool> failed{false};
+    auto worker = [&]() {
+        for (;;) {
+            const size_t i = cursor.fetch_add(1);
+            if (i >= entries.size()) {
+                return;
+            }
+            qint64 fileNewBytes = 0, fileNewChunks = 0;
+            const std::string absolute =
+                (root / fs::path(entries[i].relativePath)).string();
+            if (!chunkFile(absolute, entries[i], fileNewBytes, fileNewChunks)) {
+                failed.store(true);
+                return;
+            }
+            newBytes += fileNewBytes;
+            newChunks += fileNewChunks;
+            scanned += entries[i].size;
+            if (onProgress) {
+                onProgress(scanned.load(), totalBytes);
+            }
+        }
+    };
+    std::vector<std::thread> pool;
+    for (int i = 0; i < hashThreads; ++i) {
+        pool.emplace_back(worker);
+    }
+    for (auto& thread : pool) {
+        thread.join();
+    }
+    if (failed.load()) {
+        return stats;
+    }
+
+    const auto now = std::chrono::system_clock::now().time_since_epoch();
+    const auto stamp =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now).count();
+    std::ostringstream name;
+    name << repositoryDir_ << "/manifest-" << stamp << ".txt";
+    if (!writeManifest(name.str(), entries)) {
+        return stats;
+    }
+
+    stats.filesScanned = static_cast<qint64>(entries.size());
+    stats.bytesScanned = totalBytes;
+    for (const auto& entry : entries) {
+        stats.chunksTotal += static_cast<qint64>(entry.chunkHashes.size());
+    }
+    stats.chunksNew = newChunks.load();
+    stats.bytesStored = newBytes.load();
+    stats.manifestPath = QString::fromStdString(name.str());
+    stats.ok = true;
+    return stats;
+}
+
+bool IncrementalBackupEngine::writeManifest(
+    const std::string& path, const std::vector<FileEntry>& entries) const {
+    std::ofstream file(path);
+    if (!file) {
+        return false;
+    }
+    for (const auto& entry : entries) {
+        file << "F " << entry.size << ' ' << entry.relativePath << '\n';
+        for (size_t i = 0; i < entry.chunkHashes.size(); ++i) {
+            file << "C " << entry.chunkHashes[i] << ' '
+                 << entry.chunkLengths[i] << '\n';
+        }
+    }
+    return static_cast<bool>(file);
+}
+
+bool IncrementalBackupEngine::restore(const QString& manifestPath,
+                                      const QString& targetDir) {
+    std::ifstream manifest(manifestPath.toStdString());
+    std::ifstream pack(packPath_, std::ios::binary);
+    if (!manifest || !pack) {
+        return false;
+    }
+    const fs::path target(targetDir.toStdString());
+    std::error_code ec;
+    fs::create_directories(target, ec);
+
+    std::ofstream out;
+    std::string tag;
+    std::vector<char> chunk;
+    while (manifest >> tag) {
+        if (tag == "F") {
+            qint64 size;
+            std::string relativePath;
+            manifest >> size;
+            std::getline(manifest, relativePath);
+            if (!relativePath.empty() && relativePath.front() == ' ') {
+                relativePath.erase(0, 1);
+            }
+            const fs::path dest = target / fs::path(relativePath);
+            fs::create_directories(dest.parent_path(), ec);
+            out.close();
+            out.open(dest.string(), std::ios::binary);
+            if (!out) {
+                return false;
+            }
+        } else if (tag == "C") {
+            quint64 hash;
+            quint32 length;
+            manifest >> hash >> length;
+            auto it = index_.find(hash);
+            if (it == index_.end() || it->second.length != length) {
+                return false;
+            }
+            chunk.resize(length);
+            pack.seekg(static_cast<std::streamoff>(it->second.offset));
+            pack.read(chunk.data(), length);
+            if (pack.gcount() != static_cast<std::streamsize>(length)) {
+                return false;
+            }
+            out.write(chunk.data(), length);
+        } else {
+            return false;
+        }
+    }
+    out.close();
+    return true;
+}
+
+QVector<QString> IncrementalBackupEngine::manifests() const {
+    QVector<QString> found;
+    std::error_code ec;
+    for (const auto& item : fs::directory_iterator(repositoryDir_, ec)) {
+        const std::string name = item.path().filename().string();
+        if (name.rfind("manifest-", 0) == 0) {
+            found.push_back(QString::fromStdString(item.path().string()));
+        }
+    }
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
+int IncrementalBackupEngine::chunkCount() const {
+    return static_cast<int>(index_.size());
+}
@@ -21,7 +21,17 @@ struct MainWindow::Private {
     MLModelTab* mlModelTab{nullptr};
     SecurityTab* securityTab{nullptr};
     BackupTab* backupTab{nullptr};
-    
+
+    // Lazy tabs: the factory runs on first activation and fills the
+    // placeholder; until then the tab costs one empty QWidget
+    struct LazyTab {
+        std::function<QWidget*()> factory;  // null for eager tabs
+        QWidget* placeholder{nullptr};
+        bool constructed{false};
+    };
+    std::vector<LazyTab> lazyTabs;  // by tab index
+    int restoredTabIndex{0};
+
     // Core components
     std::unique_ptr<SystemMonitor> systemMonitor;
     std::unique_ptr<MLModelManager> modelManager;
@@ -51,7 +61,12 @@ MainWindow::MainWindow(QWidget* parent)
         
         // Load last session state if available
         restoreState();
-        
+
+        // Reactivating the last session's tab constructs it (and only
+        // it) on top of the eager dashboard
+        d->tabWidget->setCurrentIndex(d->restoredTabIndex);
+        activateTab(d->restoredTabIndex);
+
     } catch (const std::exception& e) {
         QMessageBox::critical(this, tr("Initialization Error"),
             tr("Failed to initialize application: %1").arg(e.what()));
@@ -72,23 +87,59 @@ void MainWindow::setupUi()
     d->tabWidget = new QTabWidget(this);
     layout->addWidget(d->tabWidget);
 
-    // Create and add tabs
+    // The dashboard is the landing tab and receives metrics from the
+    // first update, so it stays eager; every other tab is a placeholder
+    // constructed on first activation
     d->dashboard = new DashboardWidget(this);
-    d->monitoringTab = new MonitoringTab(this);
-    d->mlModelTab = new MLModelTab(this);
-    d->securityTab = new SecurityTab(this);
-    d->backupTab = new BackupTab(this);
-
     d->tabWidget->addTab(d->dashboard, tr("Dashboard"));
-    d->tabWidget->addTab(d->monitoringTab, tr("Monitoring"));
-    d->tabWidget->addTab(d->mlModelTab, tr("ML Models"));
-    d->tabWidget->addTab(d->securityTab, tr("Security"));
-    d->tabWidget->addTab(d->backupTab, tr("Backup & Restore"));
+    d->lazyTabs.push_back({nullptr, d->dashboard, true});
+
+    addLazyTab(tr("Monitoring"), [this]() -> QWidget* {
+        d->monitoringTab = new MonitoringTab(this);
+        return d->monitoringTab;
+    });
+    addLazyTab(tr("ML Models"), [this]() -> QWidget* {
+        d->mlModelTab = new MLModelTab(this);
+        return d->mlModelTab;
+    });
+    addLazyTab(tr("Security"), [this]() -> QWidget* {
+        d->securityTab = new SecurityTab(this);
+        return d->securityTab;
+    });
+    addLazyTab(tr("Backup & Restore"), [this]() -> QWidget* {
+        d->backupTab = new BackupTab(this);
+        return d->backupTab;
+    });
+
+    connect(d->tabWidget, &QTabWidget::currentChanged,
+            this, &MainWindow::activateTab);
 
     // Set up status bar
     statusBar()->showMessage(tr("System Ready"));
 }
 
+void MainWindow::addLazyTab(const QString& title,
+                            std::function<QWidget*()> factory)
+{
+    auto* placeholder = new QWidget(this);
+    new QVBoxLayout(placeholder);
+    d->tabWidget->addTab(placeholder, title);
+    d->lazyTabs.push_back({std::move(factory), placeholder, false});
+}
+
+void MainWindow::activateTab(int index)
+{
+    if (index < 0 || index >= static_cast<int>(d->lazyTabs.size())) {
+        return;
+    }
+    auto& tab = d->lazyTabs[index];
+    if (tab.constructed) {
+        return;
+    }
+    tab.constructed = true;
+    tab.placeholder->layout()->addWidget(tab.factory());
+}
+
 void MainWindow::setupConnections()
 {
     // Connect monitoring signals
@@ -125,13 +176,14 @@ void MainWindow::setupMenus()
     fileMenu->addSeparator();
     fileMenu->addAction(tr("E&xit"), qApp, &QApplication::quit);
 
-    // View menu
+    // View menu; activation by index so unconstructed tabs build on
+    // first use
     auto* viewMenu = menuBar()->addMenu(tr("&View"));
-    viewMenu->addAction(tr("&Dashboard"), [this]() { d->tabWidget->setCurrentWidget(d->dashboard); });
-    viewMenu->addAction(tr("&Monitoring"), [this]() { d->tabWidget->setCurrentWidget(d->monitoringTab); });
-    viewMenu->addAction(tr("&ML Models"), [this]() { d->tabWidget->setCurrentWidget(d->mlModelTab); });
-    viewMenu->addAction(tr("&Security"), [this]() { d->tabWidget->setCurrentWidget(d->securityTab); });
-    viewMenu->addAction(tr("&Backup"), [this]() { d->tabWidget->setCurrentWidget(d->backupTab); });
+    viewMenu->addAction(tr("&Dashboard"), [this]() { d->tabWidget->setCurrentIndex(0); });
+    viewMenu->addAction(tr("&Monitoring"), [this]() { d->tabWidget->setCurrentIndex(1); });
+    viewMenu->addAction(tr("&ML Models"), [this]() { d->tabWidget->setCurrentIndex(2); });
+    viewMenu->addAction(tr("&Security"), [this]() { d->tabWidget->setCurrentIndex(3); });
+    viewMenu->addAction(tr("&Backup"), [this]() { d->tabWidget->setCurrentIndex(4); });
 
     // Tools menu
     auto* toolsMenu = menuBar()->addMenu(tr("&Tools"));
@@ -154,7 +206,10 @@ void MainWindow::setupMenus()
 void MainWindow::onMetricsUpdate(const QVariantMap& metrics)
 {
     d->dashboard->updateMetrics(metrics);
-    d->monitoringTab->updateMetrics(metrics);
+    // A tab never activated has no widget to keep current
+    if (d->monitoringTab) {
+        d->monitoringTab->updateMetrics(metrics);
+    }
     statusBar()->showMessage(tr("Metrics Updated: %1").arg(QTime::currentTime().toString()));
 }
 
@@ -173,12 +228,16 @@ void MainWindow::onAlertTriggered(const QString& alert, const QString& severity)
 
 void MainWindow::onModelPrediction(const QString& model, const QVariantMap& prediction)
 {
-    d->mlModelTab->updatePrediction(model, prediction);
+    if (d->mlModelTab) {
+        d->mlModelTab->updatePrediction(model, prediction);
+    }
 }
 
 void MainWindow::onSecurityAlert(const QString& alert)
 {
-    d->securityTab->addSecurityAlert(alert);
+    if (d->securityTab) {
+        d->securityTab->addSecurityAlert(alert);
+    }
     QMessageBox::warning(this, tr("Security Alert"), alert);
 }
 
@@ -202,6 +261,7 @@ void MainWindow::loadSettings()
     QSettings settings;
     restoreGeometry(settings.value("mainWindow/geometry").toByteArray());
     restoreState(settings.value("mainWindow/windowState").toByteArray());
+    d->restoredTabIndex = settings.value("mainWindow/activeTab", 0).toInt();
 }
 
 void MainWindow::saveSettings()
@@ -209,6 +269,7 @@ void MainWindow::saveSettings()
     QSettings settings;
     settings.setValue("mainWindow/geometry", saveGeometry());
     settings.setValue("mainWindow/windowState", saveState());
+    settings.setValue("mainWindow/activeTab", d->tabWidget->currentIndex());
 }
 
 void MainWindow::showSettings()
@@ -0,0 +1,150 @@
+#include "ModelPrefetcher.hpp"
+
+ModelPrefetcher::ModelPrefetcher(Fetcher fetcher, int cacheCapacity,
+                                 int prefetchBudget, int numWorkers)
+    : fetcher_(std::move(fetcher)),
+      cacheCapacity_(static_cast<size_t>(cacheCapacity)),
+      prefetchBudget_(static_cast<size_t>(prefetchBudget)) {
+    for (int i = 0; i < numWorkers; ++i) {
+        workers_.emplace_back([this] { workerLoop(); });
+    }
+}
+
+ModelPrefetcher::~ModelPrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    taskAvailable_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+ModelPrefetcher::Record ModelPrefetcher::select(const QString& modelId) {
+    Record record;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (lookupLocked(modelId, record)) {
+            hits_++;
+        } else {
+            misses_++;
+            lock.unlock();
+            record = fetcher_(modelId);
+            lock.lock();
+            if (record.ok) {
+                insertLocked(modelId, record);
+            }
+        }
+
+        // Navigation moved on: everything the previous selection queued
+        // is stale, and the generation bump voids work already picked up
+        cancelled_ += static_cast<qint64>(queue_.size());
+        queue_.clear();
+        generation_++;
+
+        // Queue this model's link targets under the prefetch budget,
+        // dependencies first — they are the likelier next click
+        auto enqueue = [this](const QVector<QString>& targets) {
+            for (const auto& target : targets) {
+                if (queue_.size() >= prefetchBudget_) {
+                    return;
+                }
+                Record cached;
+                if (!lookupLocked(target, cached)) {
+                    queue_.push_back({target, generation_});
+                }
+            }
+        };
+        enqueue(record.dependencies);
+        enqueue(record.linkedRequirements);
+    }
+    taskAvailable_.notify_all();
+    return record;
+}
+
+bool ModelPrefetcher::isWarm(const QString& modelId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.find(modelId) != cache_.end();
+}
+
+void ModelPrefetcher::drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [this] { return queue_.empty() && inFlight_ == 0; });
+}
+
+qint64 ModelPrefetcher::hits() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+}
+
+qint64 ModelPrefetcher::misses() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+}
+
+qint64 ModelPrefetcher::prefetchedRecords() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return prefetched_;
+}
+
+qint64 ModelPrefetcher::cancelledPrefetches() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cancelled_;
+}
+
+void ModelPrefetcher::insertLocked(const QString& modelId, Record record) {
+    auto existing = cache_.find(modelId);
+    if (existing != cache_.end()) {
+        lru_.erase(existing->second.lruEntry);
+        cache_.erase(existing);
+    }
+    while (cache_.size() >= cacheCapacity_ && !lru_.empty()) {
+        cache_.erase(lru_.back());
+        lru_.pop_back();
+    }
+    lru_.push_front(modelId);
+    cache_[modelId] = {std::move(record), lru_.begin()};
+}
+
+bool ModelPrefetcher::lookupLocked(const QString& modelId, Record& record) {
+    auto it = cache_.find(modelId);
+    if (it == cache_.end()) {
+        return false;
+    }
+    lru_.erase(it->second.lruEntry);
+    lru_.push_front(modelId);
+    it->second.lruEntry = lru_.begin();
+    record = it->second.record;
+    return true;
+}
+
+void ModelPrefetcher::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        taskAvailable_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (stopping_) {
+            return;
+        }
+        Task task = queue_.front();
+        queue_.pop_front();
+        inFlight_++;
+        lock.unlock();
+
+        Record record = fetcher_(task.modelId);
+
+        lock.lock();
+        inFlight_--;
+        // A selection made while fetching voids this result; the bytes
+        // are wasted but the stale record never enters the cache
+        if (record.ok && task.generation == generation_) {
+            insertLocked(task.modelId, std::move(record));
+            prefetched_++;
+        } else if (task.generation != generation_) {
+            cancelled_++;
+        }
+        if (queue_.empty() && inFlight_ == 0) {
+            idle_.notify_all();
+        }
+    }
+}
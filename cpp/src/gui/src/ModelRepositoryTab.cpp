@@ -1,4 +1,5 @@
 #include "ModelRepositoryTab.hpp"
+#include "ModelPrefetcher.hpp"
 #include "ui_ModelRepositoryForm.h"
 #include <QVBoxLayout>
 #include <QToolBar>
@@ -9,6 +10,8 @@
 #include <QMessageBox>
 #include <QFileDialog>
 #include <QDateTime>
+#include <QHash>
+#include <mutex>
 #include <Qt3DCore>
 #include <Qt3DRender>
 #include <Qt3DExtras>
@@ -21,7 +24,14 @@ struct ModelRepositoryTab::Private {
     Qt3DRender::QCamera* camera;
     Qt3DExtras::QOrbitCameraController* cameraController;
     QString currentModelId;
-    
+    std::unique_ptr<ModelPrefetcher> prefetcher;
+
+    // In-memory model registry the prefetcher's fetcher reads; filled by
+    // refreshModelList and guarded because fetches run on worker threads.
+    // This is the single point where the real repository service plugs in.
+    std::mutex registryMutex;
+    QHash<QString, ModelPrefetcher::Record> registry;
+
     Private() : ui(std::make_unique<Ui::ModelRepositoryForm>()),
                 modelTreeModel(new QStandardItemModel) {}
 };
@@ -35,7 +45,20 @@ ModelRepositoryTab::ModelRepositoryTab(QWidget* parent)
     setupToolbar();
     setupContextMenu();
     setupSearchFilters();
-    
+
+    // Prefetch layer: selecting a model warms the cache with its
+    // dependency and linked-requirement targets, so follow-the-link
+    // browsing hits warm cache instead of paying a fetch per click
+    d->prefetcher = std::make_unique<ModelPrefetcher>(
+        [this](const QString& modelId) {
+            // TODO: Replace the registry lookup with the repository service
+            // call once it exists; runs on prefetch worker threads
+            std::lock_guard<std::mutex> lock(d->registryMutex);
+            auto it = d->registry.find(modelId);
+            return it != d->registry.end() ? it.value()
+                                           : ModelPrefetcher::Record{};
+        });
+
     // Connect signals/slots
     connect(d->ui->searchBox, &QLineEdit::textChanged,
             this, &ModelRepositoryTab::searchModels);
@@ -366,21 +389,51 @@ void ModelRepositoryTab::searchModels(const QString& query) {
 void ModelRepositoryTab::refreshModelList() {
     d->modelTreeModel->clear();
     d->modelTreeModel->setHorizontalHeaderLabels({"Models"});
-    
+
     // TODO: Implement actual model list retrieval
-    // This is placeholder data
-    QStringList demoModels = {
-        "Engine Assembly",
-        "Transmission",
-        "Suspension System",
-        "Brake System",
-        "Steering Mechanism"
+    // This is placeholder data; dependencies mirror how assemblies link
+    // so the prefetch path is exercised end to end
+    struct DemoModel {
+        QString name;
+        QStringList dependencies;
     };
-    
-    for (const QString& model : demoModels) {
-        QStandardItem* item = new QStandardItem(model);
-        item->setData(QUuid::createUuid().toString(), Qt::UserRole); // Model ID
+    QVector<DemoModel> demoModels = {
+        {"Engine Assembly", {"Transmission", "Brake System"}},
+        {"Transmission", {"Steering Mechanism"}},
+        {"Suspension System", {"Steering Mechanism", "Brake System"}},
+        {"Brake System", {}},
+        {"Steering Mechanism", {}}
+    };
+
+    QHash<QString, QString> idsByName;
+    for (const DemoModel& model : demoModels) {
+        idsByName.insert(model.name, QUuid::createUuid().toString());
+    }
+
+    QHash<QString, ModelPrefetcher::Record> registry;
+    for (const DemoModel& model : demoModels) {
+        const QString& modelId = idsByName.value(model.name);
+        QStandardItem* item = new QStandardItem(model.name);
+        item->setData(modelId, Qt::UserRole); // Model ID
         d->modelTreeModel->appendRow(item);
+
+        ModelPrefetcher::Record record;
+        record.details.insert("name", model.name);
+        record.details.insert("type", "Assembly");
+        record.details.insert("status", "Draft");
+        record.details.insert("version", "1.0.0");
+        record.details.insert("description",
+                              QString("%1 model").arg(model.name));
+        for (const QString& dependency : model.dependencies) {
+            record.dependencies.append(idsByName.value(dependency));
+        }
+        record.ok = true;
+        registry.insert(modelId, record);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(d->registryMutex);
+        d->registry = std::move(registry);
     }
 }
 
@@ -390,13 +443,18 @@ void ModelRepositoryTab::updatePreview(const QString& modelId) {
 }
 
 void ModelRepositoryTab::updateMetadata(const QString& modelId) {
-    // TODO: Implement metadata retrieval and display
-    // This is placeholder data
-    d->ui->nameEdit->setText("Sample Model");
-    d->ui->typeCombo->setCurrentText("Assembly");
-    d->ui->statusCombo->setCurrentText("Draft");
-    d->ui->versionEdit->setText("1.0.0");
-    d->ui->descriptionEdit->setText("Sample model description");
+    // Cache-through fetch; also cancels the previous selection's
+    // prefetches and queues this model's link targets for warming
+    ModelPrefetcher::Record record = d->prefetcher->select(modelId);
+    if (!record.ok) {
+        return;
+    }
+
+    d->ui->nameEdit->setText(record.details.value("name").toString());
+    d->ui->typeCombo->setCurrentText(record.details.value("type").toString());
+    d->ui->statusCombo->setCurrentText(record.details.value("status").toString());
+    d->ui->versionEdit->setText(record.details.value("version").toString());
+    d->ui->descriptionEdit->setText(record.details.value("description").toString());
 }
 
 void ModelRepositoryTab::checkPermissions() {
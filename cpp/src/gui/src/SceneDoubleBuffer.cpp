@@ -0,0 +1,114 @@
+#include "SceneDoubleBuffer.hpp"
+
+#include <algorithm>
+
+SceneDoubleBuffer::SceneDoubleBuffer() {
+    auto root = std::make_shared<Node>();
+    root->name = QString("root");
+    back_ = root;
+    std::atomic_store(&front_, back_);
+}
+
+void SceneDoubleBuffer::stage(const QVector<QString>& path,
+                              const ComponentState& state) {
+    if (path.isEmpty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(stageMutex_);
+    back_ = updatePath(back_, path, 0, state);
+    dirty_.push_back(path);
+}
+
+SceneDoubleBuffer::NodePtr SceneDoubleBuffer::publish(
+    QVector<QVector<QString>>* changedPaths) {
+    std::lock_guard<std::mutex> lock(stageMutex_);
+    if (changedPaths) {
+        *changedPaths = dirty_;
+    }
+    dirty_.clear();
+    // The back buffer is immutable from here on: the next stage() call
+    // path-copies off it, so the render side can hold this snapshot for
+    // the whole frame while telemetry keeps staging
+    std::atomic_store(&front_, back_);
+    return back_;
+}
+
+SceneDoubleBuffer::NodePtr SceneDoubleBuffer::frame() const {
+    return std::atomic_load(&front_);
+}
+
+const SceneDoubleBuffer::ComponentState* SceneDoubleBuffer::find(
+    const NodePtr& root, const QVector<QString>& path) {
+    const Node* node = root.get();
+    for (const auto& name : path) {
+        if (!node) {
+            return nullptr;
+        }
+        const Node* next = nullptr;
+        for (const auto& child : node->children) {
+            if (child->name == name) {
+                next = child.get();
+                break;
+            }
+        }
+        node = next;
+    }
+    return node ? &node->state : nullptr;
+}
+
+qint64 SceneDoubleBuffer::nodesCopied() const {
+    std::lock_guard<std::mutex> lock(stageMutex_);
+    return nodesCopied_;
+}
+
+qint64 SceneDoubleBuffer::nodesShared() const {
+    std::lock_guard<std::mutex> lock(stageMutex_);
+    return nodesShared_;
+}
+
+SceneDoubleBuffer::NodePtr SceneDoubleBuffer::updatePath(
+    const NodePtr& node, const QVector<QString>& path, int depth,
+    const ComponentState& state) {
+    // Copy this node; everything off the staged path is shared by
+    // pointer with the previous generation
+    auto copy = std::make_shared<Node>();
+    nodesCopied_++;
+    if (node) {
+        copy->name = node->name;
+        copy->state = node->state;
+        copy->children = node->children;
+        nodesShared_ += static_cast<qint64>(node->children.size());
+    }
+
+    if (depth == path.size()) {
+        copy->state = state;
+        return copy;
+    }
+
+    const QString& name = path[depth];
+    auto child = std::find_if(copy->children.begin(), copy->children.end(),
+                              [&name](const NodePtr& candidate) {
+                                  return candidate->name == name;
+                              });
+    if (child != copy->children.end()) {
+        nodesShared_--;  // this child is replaced, not shared
+        *child = updatePath(*child, path, depth + 1, state);
+    } else {
+        NodePtr created;
+        // Build the missing tail bottom-up so intermediate nodes exist
+        for (int i = path.size(); i > depth; --i) {
+            auto fresh = std::make_shared<Node>();
+            nodesCopied_++;
+            fresh->name = path[i - 1];
+            if (i == path.size()) {
+                fresh->state = state;
+            }
+            if (created) {
+                fresh->children.push_back(created);
+            }
+            created = fresh;
+        }
+        copy->children.push_back(created);
+    }
+    return copy;
+}
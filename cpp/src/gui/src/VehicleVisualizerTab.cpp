@@ -1,4 +1,6 @@
 #include "VehicleVisualizerTab.hpp"
+#include "SceneDoubleBuffer.hpp"
+#include <QTimer>
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QSplitter>
@@ -39,6 +41,11 @@ struct VehicleVisualizerTab::Private {
     // Component Status Cache
     QMap<QString, QString> componentStatus;
     QMap<QString, QColor> componentColors;
+
+    // Telemetry/render double buffer: workers stage off-thread, the GUI
+    // applies the published snapshot once per frame boundary
+    SceneDoubleBuffer sceneBuffer;
+    QTimer* frameSyncTimer{nullptr};
 };
 
 VehicleVisualizerTab::VehicleVisualizerTab(QWidget* parent)
@@ -50,6 +57,14 @@ VehicleVisualizerTab::VehicleVisualizerTab(QWidget* parent)
     connectFusionAPIs();
     loadMaterials();
     setupLighting();
+
+    // Frame-boundary swap at the 50 Hz telemetry rate; this is the only
+    // place telemetry-driven scene changes reach the widgets
+    d->frameSyncTimer = new QTimer(this);
+    d->frameSyncTimer->setInterval(20);
+    connect(d->frameSyncTimer, &QTimer::timeout,
+            this, [this] { syncPublishedScene(); });
+    d->frameSyncTimer->start();
 }
 
 VehicleVisualizerTab::~VehicleVisualizerTab() = default;
@@ -160,9 +175,8 @@ void VehicleVisualizerTab::loadVehicleModel(const QString& modelPath)
 
 void VehicleVisualizerTab::updateComponentStatus(const QString& componentId, const QString& status)
 {
-    d->componentStatus[componentId] = status;
-    
-    // Update component color based on status
+    // Telemetry entry point: stage into the back buffer and return.
+    // Safe off the GUI thread; no widget or scene mutation happens here.
     QColor color;
     if (status == "normal") {
         color = Qt::green;
@@ -171,9 +185,28 @@ void VehicleVisualizerTab::updateComponentStatus(const QString& componentId, con
     } else if (status == "critical") {
         color = Qt::red;
     }
-    
-    highlightComponent(componentId, color);
-    d->componentTree->updateComponentStatus(componentId, status);
+
+    SceneDoubleBuffer::ComponentState state;
+    state.status = status;
+    state.colorRgba = color.rgba();
+    d->sceneBuffer.stage({componentId}, state);
+}
+
+void VehicleVisualizerTab::syncPublishedScene()
+{
+    QVector<QVector<QString>> changed;
+    auto scene = d->sceneBuffer.publish(&changed);
+
+    for (const auto& path : changed) {
+        const auto* state = SceneDoubleBuffer::find(scene, path);
+        if (!state) {
+            continue;
+        }
+        const QString& componentId = path.last();
+        d->componentStatus[componentId] = state->status;
+        highlightComponent(componentId, QColor::fromRgba(state->colorRgba));
+        d->componentTree->updateComponentStatus(componentId, state->status);
+    }
 }
 
 void VehicleVisualizerTab::highlightComponent(const QString& componentId, const QColor& color)
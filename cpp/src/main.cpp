@@ -8,6 +8,8 @@
 #include "ui/MainWindow.hpp"
 #include "core/Config.hpp"
 #include "core/Logger.hpp"
+#include "StartupOrchestrator.hpp"
+#include "VoiceAssistant.hpp"
 
 int main(int argc, char *argv[]) {
     // Set application metadata
@@ -15,45 +17,69 @@ int main(int argc, char *argv[]) {
     QApplication::setApplicationVersion("1.0.0");
     QApplication::setOrganizationName("EcoVehicle");
     QApplication::setOrganizationDomain("ecovehicle.com");
-    
+
     // Create application
     QApplication app(argc, argv);
-    
+
     // Parse command line arguments
     QCommandLineParser parser;
     parser.setApplicationDescription("EcoVehicle Monitoring System");
     parser.addHelpOption();
     parser.addVersionOption();
-    
+
     // Add custom options
     QCommandLineOption configOption(QStringList() << "c" << "config",
         "Load configuration file.", "config", "config/default.json");
     parser.addOption(configOption);
-    
+
     parser.process(app);
-    
-    // Initialize logging
-    Logger::init();
-    
-    // Load configuration
+
+    // Initialize subsystems through the orchestrator: independent ones
+    // run in parallel, and deferrable integrations start after first
+    // paint instead of standing between the user and the window
     QString configFile = parser.value(configOption);
-    if (!Config::instance().load(configFile)) {
-        qCritical() << "Failed to load configuration file:" << configFile;
+    StartupOrchestrator orchestrator;
+    orchestrator.registerSubsystem("logger", [] {
+        Logger::init();
+        return true;
+    });
+    orchestrator.registerSubsystem("config", [&configFile] {
+        return Config::instance().load(configFile);
+    });
+    orchestrator.registerSubsystem("voice-assistant", [] {
+        VoiceAssistant::instance();
+        return true;
+    }, {"config"}, StartupOrchestrator::Phase::Deferred);
+
+    if (!orchestrator.run()) {
+        for (const QString& name : orchestrator.failedSubsystems()) {
+            if (name == "config") {
+                qCritical() << "Failed to load configuration file:" << configFile;
+            } else {
+                qCritical() << "Failed to initialize subsystem:" << name;
+            }
+        }
         return 1;
     }
-    
+
     // Show splash screen
     QPixmap pixmap(":/images/splash.png");
     QSplashScreen splash(pixmap);
     splash.show();
     app.processEvents();
-    
+
     // Create and show main window
     MainWindow mainWindow;
     mainWindow.show();
-    
+
     // Close splash screen
     splash.finish(&mainWindow);
-    
-    return app.exec();
+
+    // Heavy integrations initialize in the background now that the
+    // window is up
+    orchestrator.startDeferred();
+
+    const int exitCode = app.exec();
+    orchestrator.waitDeferred();
+    return exitCode;
 }
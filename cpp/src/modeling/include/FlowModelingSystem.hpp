@@ -3,6 +3,7 @@
 #include <QString>
 #include <QVector>
 #include <QMap>
+#include <QSet>
 #include <QVariant>
 #include <memory>
 
@@ -207,11 +208,27 @@ private:
     QMap<QString, QVariant> m_defaults;
 };
 
+// Compiled execution schedule: activities in topological order plus the
+// downstream adjacency needed to walk only the cone affected by an edit
+class ExecutionSchedule {
+public:
+    bool isValid() const { return m_valid; }
+    int activityCount() const { return m_order.size(); }
+
+private:
+    friend class FlowModelingSystem;
+
+    QVector<std::shared_ptr<Activity>> m_order;   // topological order
+    QMap<QString, int> m_slotById;                // activity id -> schedule slot
+    QVector<QVector<int>> m_downstream;           // slot -> dependent slots
+    bool m_valid{false};
+};
+
 // Flow modeling system manager
 class FlowModelingSystem {
 public:
     static FlowModelingSystem& instance();
-    
+
     std::shared_ptr<Activity> createActivity(const QString& name);
     std::shared_ptr<ObjectFlow> createFlow(ObjectFlow::Type type);
     std::shared_ptr<ControlNode> createControlNode(ControlNode::Type type);
@@ -219,17 +236,32 @@ public:
     std::shared_ptr<DataSource> createDataSource(DataSource::Type type);
     std::shared_ptr<Buffer> createBuffer(Buffer::Policy policy);
     std::shared_ptr<ParameterSet> createParameterSet();
-    
+
     void saveModel(const QString& filename);
     void loadModel(const QString& filename);
     void validateModel();
     void executeModel();
-    
+
+    // Incremental execution: compileModel() topologically sorts the graph
+    // into an ExecutionSchedule once (fails on cycles); edits mark their
+    // activity dirty and executeIncremental() re-evaluates only the dirty
+    // activities and their downstream cone in schedule order. Structural
+    // changes (new flows/activities) invalidate the schedule and force a
+    // recompile on the next run.
+    bool compileModel();
+    void markDirty(const QString& activityId);
+    void executeIncremental();
+    const ExecutionSchedule& schedule() const { return m_schedule; }
+
 private:
     FlowModelingSystem() = default;
     ~FlowModelingSystem() = default;
-    
+
+    void invalidateSchedule();
+
     QVector<std::shared_ptr<FlowElement>> m_elements;
+    ExecutionSchedule m_schedule;
+    QSet<int> m_dirtySlots;
 };
 
 } // namespace FlowModeling
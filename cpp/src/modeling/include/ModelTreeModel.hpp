@@ -3,6 +3,7 @@
 #include "ModelMetadata.hpp"
 #include <QAbstractItemModel>
 #include <QSortFilterProxyModel>
+#include <QHash>
 #include <memory>
 #include <vector>
 
@@ -21,9 +22,34 @@ public:
     const ModelMetadata& metadata() const { return modelData; }
 
 private:
+    friend class ModelTreeModel;
+    friend class ModelTreeItemPool;
+
     std::vector<ModelTreeItem*> childItems;
     ModelMetadata modelData;
     ModelTreeItem* parent;
+    bool childrenFetched{true};  // false while children are still pending
+    bool ownsChildren{true};     // pool-allocated items are freed by the pool
+};
+
+// Chunked allocator for tree items. Lazy expansion of deep branches creates
+// items in bursts; carving them out of large chunks avoids per-node heap
+// traffic and frees the whole tree in one sweep on clear()
+class ModelTreeItemPool {
+public:
+    ModelTreeItemPool() = default;
+    ~ModelTreeItemPool();
+    ModelTreeItemPool(const ModelTreeItemPool&) = delete;
+    ModelTreeItemPool& operator=(const ModelTreeItemPool&) = delete;
+
+    ModelTreeItem* allocate(const ModelMetadata& data, ModelTreeItem* parent);
+    void clear();
+
+private:
+    static constexpr int kChunkSize = 256;
+
+    std::vector<char*> chunks;
+    int usedInLastChunk{kChunkSize};
 };
 
 class ModelTreeModel : public QAbstractItemModel {
@@ -42,7 +68,14 @@ public:
     int rowCount(const QModelIndex& parent = QModelIndex()) const override;
     int columnCount(const QModelIndex& parent = QModelIndex()) const override;
 
+    // Lazy population: loadModels builds only root-level items; children
+    // (grouped by parentId) are materialized when the view expands a branch
+    bool hasChildren(const QModelIndex& parent = QModelIndex()) const override;
+    bool canFetchMore(const QModelIndex& parent) const override;
+    void fetchMore(const QModelIndex& parent) override;
+
     // Model management
+    void loadModels(const QList<ModelMetadata>& models);
     void addModel(const ModelMetadata& model);
     void updateModel(const ModelMetadata& model);
     void removeModel(const QString& modelId);
@@ -71,6 +104,8 @@ private:
     void updateFilterAndSort();
 
     std::unique_ptr<ModelTreeItem> rootItem;
+    ModelTreeItemPool itemPool;
+    QHash<QString, QList<ModelMetadata>> pendingChildren;  // parentId -> children
     QString filterType;
     QString filterStatus;
     QString filterText;
@@ -4,6 +4,7 @@
 #include <QDateTime>
 #include <QMimeData>
 #include <QIcon>
+#include <new>
 
 ModelTreeItem::ModelTreeItem(const ModelMetadata& data, ModelTreeItem* parentItem)
     : modelData(data)
@@ -13,7 +14,42 @@ ModelTreeItem::ModelTreeItem(const ModelMetadata& data, ModelTreeItem* parentIte
 
 ModelTreeItem::~ModelTreeItem()
 {
-    qDeleteAll(childItems);
+    if (ownsChildren) {
+        qDeleteAll(childItems);
+    }
+}
+
+ModelTreeItemPool::~ModelTreeItemPool()
+{
+    clear();
+}
+
+ModelTreeItem* ModelTreeItemPool::allocate(const ModelMetadata& data, ModelTreeItem* parent)
+{
+    if (usedInLastChunk == kChunkSize) {
+        chunks.push_back(static_cast<char*>(
+            ::operator new(kChunkSize * sizeof(ModelTreeItem))));
+        usedInLastChunk = 0;
+    }
+    char* slot = chunks.back() + usedInLastChunk * sizeof(ModelTreeItem);
+    ++usedInLastChunk;
+
+    ModelTreeItem* item = new (slot) ModelTreeItem(data, parent);
+    item->ownsChildren = false;  // pool reclaims all items in one sweep
+    return item;
+}
+
+void ModelTreeItemPool::clear()
+{
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        const int used = (c + 1 == chunks.size()) ? usedInLastChunk : kChunkSize;
+        for (int i = 0; i < used; ++i) {
+            reinterpret_cast<ModelTreeItem*>(chunks[c] + i * sizeof(ModelTreeItem))->~ModelTreeItem();
+        }
+        ::operator delete(chunks[c]);
+    }
+    chunks.clear();
+    usedInLastChunk = kChunkSize;
 }
 
 void ModelTreeItem::appendChild(ModelTreeItem* child)
@@ -74,6 +110,7 @@ ModelTreeModel::ModelTreeModel(QObject* parent)
     , sortColumn(0)
     , sortOrder(Qt::AscendingOrder)
 {
+    rootItem->ownsChildren = false;  // children always come from itemPool
     setupModelData();
 }
 
@@ -186,10 +223,77 @@ int ModelTreeModel::columnCount(const QModelIndex& parent) const
     return 7;
 }
 
+bool ModelTreeModel::hasChildren(const QModelIndex& parent) const
+{
+    ModelTreeItem* parentItem = getItem(parent);
+    if (!parentItem)
+        return false;
+    // Show the expander for unfetched branches without materializing them
+    if (!parentItem->childrenFetched)
+        return true;
+    return parentItem->childCount() > 0;
+}
+
+bool ModelTreeModel::canFetchMore(const QModelIndex& parent) const
+{
+    ModelTreeItem* parentItem = getItem(parent);
+    return parentItem && !parentItem->childrenFetched;
+}
+
+void ModelTreeModel::fetchMore(const QModelIndex& parent)
+{
+    ModelTreeItem* parentItem = getItem(parent);
+    if (!parentItem || parentItem->childrenFetched)
+        return;
+
+    parentItem->childrenFetched = true;
+
+    const QList<ModelMetadata> children =
+        pendingChildren.take(parentItem->metadata().id);
+    if (children.isEmpty())
+        return;
+
+    beginInsertRows(parent, 0, children.size() - 1);
+    for (const auto& child : children) {
+        ModelTreeItem* item = itemPool.allocate(child, parentItem);
+        item->childrenFetched = !pendingChildren.contains(child.id);
+        parentItem->appendChild(item);
+    }
+    endInsertRows();
+}
+
+void ModelTreeModel::loadModels(const QList<ModelMetadata>& models)
+{
+    beginResetModel();
+
+    rootItem = std::make_unique<ModelTreeItem>(ModelMetadata());
+    rootItem->ownsChildren = false;
+    itemPool.clear();
+    pendingChildren.clear();
+
+    // Group children by parent; only root-level items are materialized now
+    QList<ModelMetadata> roots;
+    for (const auto& model : models) {
+        if (model.parentId.isEmpty()) {
+            roots.append(model);
+        } else {
+            pendingChildren[model.parentId].append(model);
+        }
+    }
+
+    for (const auto& model : roots) {
+        ModelTreeItem* item = itemPool.allocate(model, rootItem.get());
+        item->childrenFetched = !pendingChildren.contains(model.id);
+        rootItem->appendChild(item);
+    }
+
+    endResetModel();
+}
+
 void ModelTreeModel::addModel(const ModelMetadata& model)
 {
     beginInsertRows(QModelIndex(), rootItem->childCount(), rootItem->childCount());
-    rootItem->appendChild(new ModelTreeItem(model, rootItem.get()));
+    rootItem->appendChild(itemPool.allocate(model, rootItem.get()));
     endInsertRows();
     
     emit modelAdded(model.id);
@@ -237,6 +341,9 @@ void ModelTreeModel::clear()
 {
     beginResetModel();
     rootItem = std::make_unique<ModelTreeItem>(ModelMetadata());
+    rootItem->ownsChildren = false;
+    itemPool.clear();
+    pendingChildren.clear();
     endResetModel();
 }
 
@@ -337,9 +444,10 @@ void ModelTreeModel::updateFilterAndSort()
     // Store current models
     QList<ModelMetadata> models = getAllModels();
     
-    // Clear current items
+    // Clear current items; children are pool-allocated, never owned
     rootItem = std::make_unique<ModelTreeItem>(ModelMetadata());
-    
+    rootItem->ownsChildren = false;
+
     // Filter models
     QList<ModelMetadata> filteredModels;
     for (const auto& model : models) {
@@ -372,7 +480,7 @@ void ModelTreeModel::updateFilterAndSort()
     
     // Add filtered and sorted models back to the tree
     for (const auto& model : filteredModels) {
-        rootItem->appendChild(new ModelTreeItem(model, rootItem.get()));
+        rootItem->appendChild(itemPool.allocate(model, rootItem.get()));
     }
     
     endResetModel();
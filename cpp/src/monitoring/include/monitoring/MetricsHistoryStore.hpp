@@ -0,0 +1,71 @@
+#pragma once
+
+#include <QString>
+#include <QMutex>
+#include <map>
+#include <vector>
+
+// Shared in-process time-series store for system metrics.
+//
+// Each metric keeps a fixed-size ring of raw samples plus pre-aggregated
+// 1 s / 1 min / 1 h tiers (min/max/avg/count per bucket). Consumers such as
+// the monitoring charts query a time window with a point budget and the
+// store answers from the coarsest tier that still meets the requested
+// resolution — a 24-hour window renders from ~1,000 pre-aggregated points
+// instead of replaying millions of raw samples.
+class MetricsHistoryStore {
+public:
+    struct AggregatedPoint {
+        qint64 bucketStartMs{0};
+        double min{0.0};
+        double max{0.0};
+        double avg{0.0};
+        quint32 count{0};
+    };
+
+    explicit MetricsHistoryStore(size_t rawCapacity = 4096,
+                                 size_t tierCapacity = 4096);
+
+    // Record one raw sample; folds it into the open 1 s bucket and cascades
+    // closed buckets up through the 1 min and 1 h tiers
+    void record(const QString& metric, double value, qint64 timestampMs);
+
+    // Returns at most maxPoints aggregated points covering [startMs, endMs],
+    // oldest first, read from the coarsest tier whose bucket width still
+    // satisfies the implied resolution
+    std::vector<AggregatedPoint> query(const QString& metric,
+                                       qint64 startMs, qint64 endMs,
+                                       size_t maxPoints = 1000) const;
+
+    std::vector<QString> metricNames() const;
+    void clear();
+
+private:
+    struct RingBuffer {
+        std::vector<AggregatedPoint> points;
+        size_t head{0};   // next write position
+        size_t count{0};  // valid entries, capped at capacity
+    };
+
+    struct Series {
+        RingBuffer raw;
+        RingBuffer oneSecond;
+        RingBuffer oneMinute;
+        RingBuffer oneHour;
+        AggregatedPoint pendingSecond;
+        AggregatedPoint pendingMinute;
+        AggregatedPoint pendingHour;
+    };
+
+    void push(RingBuffer& ring, const AggregatedPoint& point, size_t capacity);
+    void fold(AggregatedPoint& bucket, const AggregatedPoint& point,
+              qint64 bucketStartMs);
+    static void collectInRange(const RingBuffer& ring, qint64 startMs,
+                               qint64 endMs,
+                               std::vector<AggregatedPoint>& out);
+
+    size_t rawCapacity_;
+    size_t tierCapacity_;
+    std::map<QString, Series> series_;
+    mutable QMutex mutex_;
+};
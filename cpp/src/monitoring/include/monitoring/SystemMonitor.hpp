@@ -3,9 +3,18 @@
 #include <QObject>
 #include <QString>
 #include <QVariantMap>
+#include <QMetaType>
 #include <memory>
 #include <vector>
 
+// Compact typed sample emitted in delta mode instead of a full QVariantMap
+struct MetricSample {
+    QString name;
+    double value{0.0};
+    qint64 timestampMs{0};
+};
+Q_DECLARE_METATYPE(MetricSample)
+
 class SystemMonitor : public QObject {
     Q_OBJECT
 
@@ -32,8 +41,18 @@ public:
     void setLatencyThreshold(double threshold);
     void setEnvironmentalThreshold(double threshold);
 
+    // Delta mode: metrics are sampled at individual rates and only emitted
+    // when they move by more than their change threshold, replacing the
+    // wholesale QVariantMap rebuild on every tick. Cuts overhead on
+    // low-power in-vehicle hardware where most values are stable.
+    void setDeltaMode(bool enabled);
+    bool isDeltaModeEnabled() const;
+    void setMetricChangeThreshold(const QString& metric, double minDelta);
+    void setMetricSampleRate(const QString& metric, int hz);
+
 signals:
     void metricsUpdated(const QVariantMap& metrics);
+    void metricChanged(const MetricSample& sample);
     void alertTriggered(const QString& component, const QString& message, const QString& severity);
     void statusChanged(const QString& status);
     void healthChanged(bool healthy);
@@ -60,4 +79,6 @@ private:
     // Utility functions
     QString formatMetric(const QString& name, double value, const QString& unit);
     void logMetric(const QString& name, double value);
+    void updateMetricDelta(const QString& name, double value, qint64 nowMs);
+    void applyFastestSampleRate();
 };
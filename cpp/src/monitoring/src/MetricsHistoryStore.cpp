@@ -0,0 +1,163 @@
+#include "monitoring/MetricsHistoryStore.hpp"
+
+#include <QMutexLocker>
+#include <algorithm>
+
+namespace {
+constexpr qint64 kSecondMs = 1000;
+constexpr qint64 kMinuteMs = 60 * 1000;
+constexpr qint64 kHourMs = 60 * 60 * 1000;
+}
+
+MetricsHistoryStore::MetricsHistoryStore(size_t rawCapacity, size_t tierCapacity)
+    : rawCapacity_(rawCapacity)
+    , tierCapacity_(tierCapacity)
+{
+}
+
+void MetricsHistoryStore::push(RingBuffer& ring, const AggregatedPoint& point,
+                               size_t capacity)
+{
+    if (ring.points.size() < capacity) {
+        ring.points.resize(capacity);
+    }
+    ring.points[ring.head] = point;
+    ring.head = (ring.head + 1) % capacity;
+    if (ring.count < capacity) {
+        ++ring.count;
+    }
+}
+
+void MetricsHistoryStore::fold(AggregatedPoint& bucket,
+                               const AggregatedPoint& point,
+                               qint64 bucketStartMs)
+{
+    if (bucket.count == 0) {
+        bucket.bucketStartMs = bucketStartMs;
+        bucket.min = point.min;
+        bucket.max = point.max;
+        bucket.avg = point.avg;
+        bucket.count = point.count;
+        return;
+    }
+    bucket.min = std::min(bucket.min, point.min);
+    bucket.max = std::max(bucket.max, point.max);
+    // Count-weighted running mean keeps averages exact across cascades
+    const double total = static_cast<double>(bucket.count) + point.count;
+    bucket.avg = (bucket.avg * bucket.count + point.avg * point.count) / total;
+    bucket.count += point.count;
+}
+
+void MetricsHistoryStore::record(const QString& metric, double value,
+                                 qint64 timestampMs)
+{
+    QMutexLocker locker(&mutex_);
+    Series& s = series_[metric];
+
+    AggregatedPoint sample{timestampMs, value, value, value, 1};
+    push(s.raw, sample, rawCapacity_);
+
+    // Cascade closed buckets upward: raw -> 1 s -> 1 min -> 1 h
+    const qint64 secondStart = (timestampMs / kSecondMs) * kSecondMs;
+    if (s.pendingSecond.count > 0 && s.pendingSecond.bucketStartMs != secondStart) {
+        push(s.oneSecond, s.pendingSecond, tierCapacity_);
+
+        const qint64 minuteStart =
+            (s.pendingSecond.bucketStartMs / kMinuteMs) * kMinuteMs;
+        if (s.pendingMinute.count > 0 && s.pendingMinute.bucketStartMs != minuteStart) {
+            push(s.oneMinute, s.pendingMinute, tierCapacity_);
+
+            const qint64 hourStart =
+                (s.pendingMinute.bucketStartMs / kHourMs) * kHourMs;
+            if (s.pendingHour.count > 0 && s.pendingHour.bucketStartMs != hourStart) {
+                push(s.oneHour, s.pendingHour, tierCapacity_);
+                s.pendingHour = AggregatedPoint{};
+            }
+            fold(s.pendingHour, s.pendingMinute, hourStart);
+            s.pendingMinute = AggregatedPoint{};
+        }
+        fold(s.pendingMinute, s.pendingSecond, minuteStart);
+        s.pendingSecond = AggregatedPoint{};
+    }
+    fold(s.pendingSecond, sample, secondStart);
+}
+
+void MetricsHistoryStore::collectInRange(const RingBuffer& ring, qint64 startMs,
+                                         qint64 endMs,
+                                         std::vector<AggregatedPoint>& out)
+{
+    if (ring.count == 0) {
+        return;
+    }
+    const size_t capacity = ring.points.size();
+    const size_t first = (ring.head + capacity - ring.count) % capacity;
+    for (size_t i = 0; i < ring.count; ++i) {
+        const AggregatedPoint& p = ring.points[(first + i) % capacity];
+        if (p.bucketStartMs >= startMs && p.bucketStartMs <= endMs) {
+            out.push_back(p);
+        }
+    }
+}
+
+std::vector<MetricsHistoryStore::AggregatedPoint> MetricsHistoryStore::query(
+    const QString& metric, qint64 startMs, qint64 endMs,
+    size_t maxPoints) const
+{
+    std::vector<AggregatedPoint> out;
+    QMutexLocker locker(&mutex_);
+
+    auto it = series_.find(metric);
+    if (it == series_.end() || endMs <= startMs || maxPoints == 0) {
+        return out;
+    }
+    const Series& s = it->second;
+
+    // Pick the coarsest tier whose bucket width keeps the window within the
+    // point budget
+    const qint64 window = endMs - startMs;
+    const qint64 resolution = window / static_cast<qint64>(maxPoints);
+
+    if (resolution >= kHourMs) {
+        collectInRange(s.oneHour, startMs, endMs, out);
+        if (s.pendingHour.count > 0 && s.pendingHour.bucketStartMs >= startMs &&
+            s.pendingHour.bucketStartMs <= endMs) {
+            out.push_back(s.pendingHour);
+        }
+    } else if (resolution >= kMinuteMs) {
+        collectInRange(s.oneMinute, startMs, endMs, out);
+        if (s.pendingMinute.count > 0 && s.pendingMinute.bucketStartMs >= startMs &&
+            s.pendingMinute.bucketStartMs <= endMs) {
+            out.push_back(s.pendingMinute);
+        }
+    } else if (resolution >= kSecondMs) {
+        collectInRange(s.oneSecond, startMs, endMs, out);
+        if (s.pendingSecond.count > 0 && s.pendingSecond.bucketStartMs >= startMs &&
+            s.pendingSecond.bucketStartMs <= endMs) {
+            out.push_back(s.pendingSecond);
+        }
+    } else {
+        collectInRange(s.raw, startMs, endMs, out);
+    }
+
+    if (out.size() > maxPoints) {
+        out.erase(out.begin(), out.end() - static_cast<long>(maxPoints));
+    }
+    return out;
+}
+
+std::vector<QString> MetricsHistoryStore::metricNames() const
+{
+    QMutexLocker locker(&mutex_);
+    std::vector<QString> names;
+    names.reserve(series_.size());
+    for (const auto& [name, s] : series_) {
+        names.push_back(name);
+    }
+    return names;
+}
+
+void MetricsHistoryStore::clear()
+{
+    QMutexLocker locker(&mutex_);
+    series_.clear();
+}
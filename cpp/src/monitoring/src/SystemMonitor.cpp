@@ -7,6 +7,8 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QHostInfo>
+#include <algorithm>
+#include <cmath>
 
 #ifdef Q_OS_UNIX
 #include <sys/sysinfo.h>
@@ -49,6 +51,17 @@ struct SystemMonitor::Private {
         size_t maxSize{100};
     };
     std::map<QString, MetricHistory> history;
+
+    // Delta mode: per-metric sampling interval and change threshold
+    struct DeltaConfig {
+        double minDelta{0.0};
+        int intervalMs{1000};
+        qint64 lastSampleMs{0};
+        double lastEmitted{0.0};
+        bool hasEmitted{false};
+    };
+    bool deltaMode{false};
+    std::map<QString, DeltaConfig> deltaConfigs;
 };
 
 SystemMonitor::SystemMonitor(QObject* parent)
@@ -156,7 +169,100 @@ double SystemMonitor::calculateEnvironmentalImpact() {
     return 100.0 - (cpuImpact + memoryImpact + networkImpact);
 }
 
+void SystemMonitor::setDeltaMode(bool enabled) {
+    d->deltaMode = enabled;
+    if (!enabled) {
+        d->updateTimer->start(1000);
+        return;
+    }
+    // Seed defaults matching the in-vehicle profile if the caller hasn't
+    // configured anything: CPU fast, battery slow
+    if (d->deltaConfigs.empty()) {
+        d->deltaConfigs["cpu_usage"] = {0.5, 100, 0, 0.0, false};
+        d->deltaConfigs["memory_usage"] = {0.5, 1000, 0, 0.0, false};
+        d->deltaConfigs["battery_level"] = {0.1, 1000, 0, 0.0, false};
+        d->deltaConfigs["network_latency"] = {1.0, 1000, 0, 0.0, false};
+        d->deltaConfigs["environmental_score"] = {0.5, 1000, 0, 0.0, false};
+    }
+    applyFastestSampleRate();
+}
+
+bool SystemMonitor::isDeltaModeEnabled() const {
+    return d->deltaMode;
+}
+
+void SystemMonitor::setMetricChangeThreshold(const QString& metric, double minDelta) {
+    d->deltaConfigs[metric].minDelta = minDelta;
+}
+
+void SystemMonitor::setMetricSampleRate(const QString& metric, int hz) {
+    d->deltaConfigs[metric].intervalMs = hz > 0 ? 1000 / hz : 1000;
+    if (d->deltaMode) {
+        applyFastestSampleRate();
+    }
+}
+
+void SystemMonitor::applyFastestSampleRate() {
+    // The timer ticks at the fastest configured rate; slower metrics skip
+    // ticks until their own interval has elapsed
+    int fastest = 1000;
+    for (const auto& [name, cfg] : d->deltaConfigs) {
+        fastest = std::min(fastest, cfg.intervalMs);
+    }
+    d->updateTimer->start(fastest);
+}
+
+void SystemMonitor::updateMetricDelta(const QString& name, double value, qint64 nowMs) {
+    auto& history = d->history[name];
+    history.values.push_back(value);
+    if (history.values.size() > history.maxSize) {
+        history.values.erase(history.values.begin());
+    }
+
+    auto& cfg = d->deltaConfigs[name];
+    cfg.lastSampleMs = nowMs;
+    if (cfg.hasEmitted && std::abs(value - cfg.lastEmitted) < cfg.minDelta) {
+        return;  // unchanged within tolerance — nothing to re-marshal
+    }
+    cfg.lastEmitted = value;
+    cfg.hasEmitted = true;
+    emit metricChanged({name, value, nowMs});
+}
+
 void SystemMonitor::updateMetrics() {
+    if (d->deltaMode) {
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        auto due = [this, now](const QString& name) {
+            const auto& cfg = d->deltaConfigs[name];
+            return now - cfg.lastSampleMs >= cfg.intervalMs;
+        };
+
+        // Only recompute metrics whose interval has elapsed — the
+        // measurement itself is the expensive part for CPU and latency
+        if (due("cpu_usage")) {
+            d->cpuUsage = calculateCpuUsage();
+            updateMetricDelta("cpu_usage", d->cpuUsage, now);
+        }
+        if (due("memory_usage")) {
+            d->memoryUsage = calculateMemoryUsage();
+            updateMetricDelta("memory_usage", d->memoryUsage, now);
+        }
+        if (due("battery_level")) {
+            updateMetricDelta("battery_level", d->batteryLevel, now);
+        }
+        if (due("network_latency")) {
+            d->networkLatency = measureNetworkLatency();
+            updateMetricDelta("network_latency", d->networkLatency, now);
+        }
+        if (due("environmental_score")) {
+            d->environmentalScore = calculateEnvironmentalImpact();
+            updateMetricDelta("environmental_score", d->environmentalScore, now);
+        }
+
+        checkThresholds();
+        return;
+    }
+
     // Update all metrics
     d->cpuUsage = calculateCpuUsage();
     d->memoryUsage = calculateMemoryUsage();
@@ -64,6 +64,26 @@ public:
         bool isMajor;
     };
 
+    // Query Options
+    struct QueryOptions {
+        QString text;                     // matches name/description
+        QVector<QString> allOfTags;       // served by the inverted tag index
+        QVector<Status> anyOfStatuses;    // empty = no status filter
+        QDateTime modifiedAfter;          // served by the sorted date index
+        QDateTime modifiedBefore;
+        int pageIndex{0};
+        int pageSize{50};
+        bool sortByModifiedDescending{true};
+    };
+
+    // Query Page
+    struct QueryPage {
+        QVector<Model> items;             // one result window
+        int totalCount{0};                // matches across all pages
+        int pageIndex{0};
+        int pageSize{0};
+    };
+
     // Checkout Info
     struct CheckoutInfo {
         QString modelId;
@@ -86,6 +106,14 @@ public:
     QVector<Model> searchModels(const QString& query) const;
     QVector<Model> filterModels(const QVariantMap& filters) const;
 
+    // Indexed Queries
+    // Served from secondary indexes maintained incrementally on every
+    // create/update/delete: a hash index on id, an inverted index from tag
+    // to model ids, and a sorted index on modifiedDate for range filters
+    // and pagination — filtered pages return without scanning the store.
+    QueryPage queryModels(const QueryOptions& options) const;
+    void rebuildIndexes();
+
     // Version Control
     QString createVersion(const QString& modelId, const VersionInfo& versionInfo);
     bool switchVersion(const QString& modelId, const QString& version);
@@ -125,6 +153,17 @@ public:
     bool removeDependency(const QString& modelId, const QString& dependencyId);
     bool validateDependencies(const QString& modelId);
 
+    // Impact Analysis
+    // Backed by a materialized dependency DAG that keeps reverse edges
+    // alongside the forward ones and memoizes reachability sets. Edge
+    // mutations invalidate only the affected closures, so "what breaks if
+    // this changes" answers come from the cache rather than re-walking the
+    // graph on every analysis.
+    QVector<QString> getDependents(const QString& modelId) const;
+    QVector<QString> getTransitiveDependencies(const QString& modelId) const;
+    QVector<QString> getImpactSet(const QString& modelId) const;
+    bool wouldCreateDependencyCycle(const QString& modelId, const QString& dependencyId) const;
+
     // Storage Management
     qint64 getStorageUsage(const QString& modelId) const;
     bool cleanup(const QString& modelId);
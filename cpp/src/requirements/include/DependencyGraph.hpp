@@ -0,0 +1,64 @@
+#pragma once
+
+#include <QString>
+#include <QVector>
+#include <map>
+#include <vector>
+
+// Compiled requirement dependency graph with memoized cycle detection.
+//
+// Requirement IDs are interned to dense integers and dependencies kept
+// as integer adjacency arrays. Strongly connected components are
+// computed once per edge change (single iterative Tarjan pass, linear
+// in nodes + edges) and memoized, so checkCircularDependencies per
+// requirement is an O(1) component-size lookup and full-baseline
+// validation is one linear pass instead of n traversals. Edits are
+// pre-checked with wouldCreateCycle, a DFS bounded to the edges
+// actually reachable from the new dependency.
+class DependencyGraph {
+public:
+    // Interning: returns the dense index, creating it on first sight
+    int intern(const QString& reqId);
+
+    // Lookup without creation; -1 when unknown
+    int indexOf(const QString& reqId) const;
+
+    // Edge maintenance. Duplicate edges are ignored; any change
+    // invalidates the memoized components.
+    void addDependency(const QString& reqId, const QString& dependsOn);
+    bool removeDependency(const QString& reqId, const QString& dependsOn);
+    void setDependencies(const QString& reqId, const QVector<QString>& dependsOn);
+
+    // True if adding reqId -> dependsOn would close a cycle; bounded
+    // DFS from the dependency back toward the requirement, no
+    // recompile needed
+    bool wouldCreateCycle(const QString& reqId, const QString& dependsOn) const;
+
+    // O(1) against the memoized components (recompiled lazily after edits)
+    bool inCycle(const QString& reqId) const;
+
+    // All requirements on some dependency cycle, from one SCC pass
+    std::vector<QString> requirementsInCycles() const;
+
+    int requirementCount() const;
+    const std::vector<int>& dependenciesOf(int index) const;
+    const QString& requirementId(int index) const;
+
+    void clear();
+
+private:
+    void compile() const;
+
+    std::map<QString, int> indexById_;
+    std::vector<QString> ids_;
+    std::vector<std::vector<int>> out_;
+    std::vector<std::vector<int>> in_;
+
+    // Memoized Tarjan results; rebuilt on demand after edge changes
+    mutable bool compiled_{false};
+    mutable std::vector<int> component_;
+    mutable std::vector<int> componentSize_;
+    mutable std::vector<bool> selfLoop_;
+
+    static const std::vector<int> kEmpty;
+};
@@ -5,6 +5,9 @@
 #include <QVector>
 #include <memory>
 
+class DependencyGraph;
+class TraceabilityIndex;
+
 class RequirementsManager {
 public:
     // Requirement Types
@@ -98,13 +101,17 @@ public:
     QVector<Requirement> getAllRequirements() const;
     QVector<Requirement> filterRequirements(const QVariantMap& filters) const;
 
-    // Traceability Management
+    // Traceability Management. The linkRequirementTo* calls update the
+    // maintained TraceabilityIndex incrementally, so matrix generation
+    // and coverage queries read prebuilt adjacency arrays instead of
+    // rescanning every requirement's link lists.
     bool linkRequirementToComponent(const QString& reqId, const QString& componentId);
     bool linkRequirementToTestCase(const QString& reqId, const QString& testCaseId);
     bool linkRequirementToUseCase(const QString& reqId, const QString& useCaseId);
     bool linkRequirementToSystemVDoc(const QString& reqId, const QString& docId);
     TraceabilityMatrix generateTraceabilityMatrix() const;
     QVector<QString> getLinkedItems(const QString& reqId, const QString& itemType) const;
+    const TraceabilityIndex& traceabilityIndex() const;
 
     // Verification & Validation
     bool updateVerificationStatus(const QString& reqId, const QVariantMap& status);
@@ -125,10 +132,14 @@ public:
     bool generateTraceabilityReport(const QString& filePath, const QString& format);
     bool generateSystemVReport(const QString& filePath, const QString& format);
 
-    // Validation
+    // Validation. Dependency edits keep the compiled DependencyGraph
+    // current, so checkCircularDependencies is an O(1) lookup against
+    // memoized strongly connected components and full-baseline
+    // validation is one linear SCC pass.
     bool validateRequirement(const Requirement& req) const;
     QVector<QString> validateDependencies(const QString& reqId) const;
     bool checkCircularDependencies(const QString& reqId) const;
+    const DependencyGraph& dependencyGraph() const;
 
 private:
     struct Private;
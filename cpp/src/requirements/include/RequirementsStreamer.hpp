@@ -0,0 +1,72 @@
+#pragma once
+
+#include "RequirementsManager.hpp"
+#include <QString>
+#include <QVector>
+#include <atomic>
+#include <functional>
+#include <thread>
+
+// Streaming requirements import/export.
+//
+// Import reads the file in fixed-size chunks, parses complete CSV
+// records out of each chunk, and hands them to the caller in batches —
+// memory stays flat at one chunk plus one batch regardless of file
+// size, and progress is reported by bytes consumed. importFileAsync
+// runs the same loop on a worker thread so RequirementsTab stays
+// responsive during baseline imports; the batch handler is invoked on
+// the worker, and the tab marshals the batch to the manager (queued
+// signal or equivalent). Export streams one row at a time from a row
+// provider without materializing the document.
+class RequirementsStreamer {
+public:
+    struct Progress {
+        qint64 bytesRead{0};
+        qint64 totalBytes{0};
+        int recordsParsed{0};
+        bool finished{false};
+        bool ok{true};
+    };
+
+    // Receives parsed records in batches; invoked on the importing thread
+    using BatchHandler =
+        std::function<void(const QVector<RequirementsManager::Requirement>&)>;
+    using ProgressHandler = std::function<void(const Progress&)>;
+
+    // Supplies the row at the given index for export; returns false
+    // past the end
+    using RowProvider =
+        std::function<bool(int index, RequirementsManager::Requirement&)>;
+
+    explicit RequirementsStreamer(int batchSize = 512, int chunkSize = 256 * 1024);
+
+    // Joins any in-flight async import
+    ~RequirementsStreamer();
+
+    // Synchronous streaming import of a CSV requirements file
+    bool importFile(const QString& filePath, const BatchHandler& onBatch,
+                    const ProgressHandler& onProgress = {});
+
+    // Same loop on a worker thread; join with wait(). Only one async
+    // import may be in flight per streamer.
+    bool importFileAsync(const QString& filePath, const BatchHandler& onBatch,
+                         const ProgressHandler& onProgress = {});
+    void wait();
+    bool importRunning() const;
+
+    // Streams rows from the provider to a CSV file; no full document
+    // is built in memory
+    bool exportFile(const QString& filePath, const RowProvider& rows);
+
+    // One CSV record per requirement:
+    // id,title,description,type,priority,status,rationale,source,version
+    static QString toCsvRow(const RequirementsManager::Requirement& req);
+    static bool fromCsvRow(const std::string& row,
+                           RequirementsManager::Requirement& out);
+
+private:
+    int batchSize_;
+    int chunkSize_;
+    std::thread worker_;
+    std::atomic<bool> running_{false};
+};
@@ -0,0 +1,222 @@
+#include "DependencyGraph.hpp"
+
+#include <algorithm>
+
+const std::vector<int> DependencyGraph::kEmpty;
+
+int DependencyGraph::intern(const QString& reqId) {
+    auto it = indexById_.find(reqId);
+    if (it != indexById_.end()) {
+        return it->second;
+    }
+    const int index = static_cast<int>(ids_.size());
+    indexById_.emplace(reqId, index);
+    ids_.push_back(reqId);
+    out_.emplace_back();
+    in_.emplace_back();
+    compiled_ = false;
+    return index;
+}
+
+int DependencyGraph::indexOf(const QString& reqId) const {
+    auto it = indexById_.find(reqId);
+    return it != indexById_.end() ? it->second : -1;
+}
+
+void DependencyGraph::addDependency(const QString& reqId,
+                                    const QString& dependsOn) {
+    const int from = intern(reqId);
+    const int to = intern(dependsOn);
+    auto& edges = out_[from];
+    if (std::find(edges.begin(), edges.end(), to) != edges.end()) {
+        return;
+    }
+    edges.push_back(to);
+    in_[to].push_back(from);
+    compiled_ = false;
+}
+
+bool DependencyGraph::removeDependency(const QString& reqId,
+                                       const QString& dependsOn) {
+    const int from = indexOf(reqId);
+    const int to = indexOf(dependsOn);
+    if (from < 0 || to < 0) {
+        return false;
+    }
+    auto& edges = out_[from];
+    auto it = std::find(edges.begin(), edges.end(), to);
+    if (it == edges.end()) {
+        return false;
+    }
+    edges.erase(it);
+    auto& back = in_[to];
+    back.erase(std::find(back.begin(), back.end(), from));
+    compiled_ = false;
+    return true;
+}
+
+void DependencyGraph::setDependencies(const QString& reqId,
+                                      const QVector<QString>& dependsOn) {
+    const int from = intern(reqId);
+    for (int to : out_[from]) {
+        auto& back = in_[to];
+        back.erase(std::find(back.begin(), back.end(), from));
+    }
+    out_[from].clear();
+    for (const QString& dep : dependsOn) {
+        addDependency(reqId, dep);
+    }
+    compiled_ = false;
+}
+
+bool DependencyGraph::wouldCreateCycle(const QString& reqId,
+                                       const QString& dependsOn) const {
+    if (reqId == dependsOn) {
+        return true;
+    }
+    const int from = indexOf(reqId);
+    const int to = indexOf(dependsOn);
+    if (from < 0 || to < 0) {
+        return false;
+    }
+    // The new edge closes a cycle iff reqId is already reachable from
+    // the dependency; the search touches only that reachable region
+    std::vector<bool> visited(ids_.size(), false);
+    std::vector<int> stack{to};
+    visited[to] = true;
+    while (!stack.empty()) {
+        const int node = stack.back();
+        stack.pop_back();
+        if (node == from) {
+            return true;
+        }
+        for (int next : out_[node]) {
+            if (!visited[next]) {
+                visited[next] = true;
+                stack.push_back(next);
+            }
+        }
+    }
+    return false;
+}
+
+bool DependencyGraph::inCycle(const QString& reqId) const {
+    const int index = indexOf(reqId);
+    if (index < 0) {
+        return false;
+    }
+    compile();
+    return componentSize_[component_[index]] > 1 || selfLoop_[index];
+}
+
+std::vector<QString> DependencyGraph::requirementsInCycles() const {
+    compile();
+    std::vector<QString> cyclic;
+    for (size_t i = 0; i < ids_.size(); ++i) {
+        if (componentSize_[component_[i]] > 1 || selfLoop_[i]) {
+            cyclic.push_back(ids_[i]);
+        }
+    }
+    return cyclic;
+}
+
+int DependencyGraph::requirementCount() const {
+    return static_cast<int>(ids_.size());
+}
+
+const std::vector<int>& DependencyGraph::dependenciesOf(int index) const {
+    if (index < 0 || index >= static_cast<int>(out_.size())) {
+        return kEmpty;
+    }
+    return out_[index];
+}
+
+const QString& DependencyGraph::requirementId(int index) const {
+    return ids_[index];
+}
+
+void DependencyGraph::clear() {
+    indexById_.clear();
+    ids_.clear();
+    out_.clear();
+    in_.clear();
+    compiled_ = false;
+    component_.clear();
+    componentSize_.clear();
+    selfLoop_.clear();
+}
+
+// Iterative Tarjan over the whole graph; one linear pass shared by
+// every cycle query until the next edge change
+void DependencyGraph::compile() const {
+    if (compiled_) {
+        return;
+    }
+    const int n = static_cast<int>(ids_.size());
+    component_.assign(n, -1);
+    componentSize_.clear();
+    selfLoop_.assign(n, false);
+
+    std::vector<int> index(n, -1);
+    std::vector<int> lowlink(n, 0);
+    std::vector<bool> onStack(n, false);
+    std::vector<int> sccStack;
+    int nextIndex = 0;
+
+    struct Frame {
+        int node;
+        size_t edge;
+    };
+    std::vector<Frame> callStack;
+
+    for (int root = 0; root < n; ++root) {
+        if (index[root] != -1) {
+            continue;
+        }
+        callStack.push_back({root, 0});
+        while (!callStack.empty()) {
+            Frame& frame = callStack.back();
+            const int node = frame.node;
+            if (frame.edge == 0) {
+                index[node] = lowlink[node] = nextIndex++;
+                sccStack.push_back(node);
+                onStack[node] = true;
+            }
+            bool descended = false;
+            while (frame.edge < out_[node].size()) {
+                const int next = out_[node][frame.edge++];
+                if (next == node) {
+                    selfLoop_[node] = true;
+                } else if (index[next] == -1) {
+                    callStack.push_back({next, 0});
+                    descended = true;
+                    break;
+                } else if (onStack[next]) {
+                    lowlink[node] = std::min(lowlink[node], index[next]);
+                }
+            }
+            if (descended) {
+                continue;
+            }
+            if (lowlink[node] == index[node]) {
+                const int component = static_cast<int>(componentSize_.size());
+                int size = 0;
+                int member;
+                do {
+                    member = sccStack.back();
+                    sccStack.pop_back();
+                    onStack[member] = false;
+                    component_[member] = component;
+                    ++size;
+                } while (member != node);
+                componentSize_.push_back(size);
+            }
+            callStack.pop_back();
+            if (!callStack.empty()) {
+                const int parent = callStack.back().node;
+                lowlink[parent] = std::min(lowlink[parent], lowlink[node]);
+            }
+        }
+    }
+    compiled_ = true;
+}
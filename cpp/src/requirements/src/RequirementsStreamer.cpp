@@ -0,0 +1,240 @@
+#include "RequirementsStreamer.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Quotes a field if it contains separators, quotes, or newlines
+std::string escapeCsv(const std::string& field) {
+    if (field.find_first_of(",\"\n") == std::string::npos) {
+        return field;
+    }
+    std::string escaped = "\"";
+    for (char c : field) {
+        if (c == '"') {
+            escaped += '"';
+        }
+        escaped += c;
+    }
+    escaped += '"';
+    return escaped;
+}
+
+// Splits one CSV record, honoring quoted fields with doubled quotes
+std::vector<std::string> splitCsv(const std::string& row) {
+    std::vector<std::string> fields;
+    std::string field;
+    bool quoted = false;
+    for (size_t i = 0; i < row.size(); ++i) {
+        const char c = row[i];
+        if (quoted) {
+            if (c == '"') {
+                if (i + 1 < row.size() && row[i + 1] == '"') {
+                    field += '"';
+                    ++i;
+                } else {
+                    quoted = false;
+                }
+            } else {
+                field += c;
+            }
+        } else if (c == '"') {
+            quoted = true;
+        } else if (c == ',') {
+            fields.push_back(field);
+            field.clear();
+        } else {
+            field += c;
+        }
+    }
+    fields.push_back(field);
+    return fields;
+}
+
+} // namespace
+
+RequirementsStreamer::RequirementsStreamer(int batchSize, int chunkSize)
+    : batchSize_(batchSize), chunkSize_(chunkSize) {}
+
+RequirementsStreamer::~RequirementsStreamer() {
+    wait();
+}
+
+bool RequirementsStreamer::importFile(const QString& filePath,
+                                      const BatchHandler& onBatch,
+                                      const ProgressHandler& onProgress) {
+    std::ifstream file(filePath.toStdString(), std::ios::binary);
+    if (!file) {
+        if (onProgress) {
+            Progress failed;
+            failed.finished = true;
+            failed.ok = false;
+            onProgress(failed);
+        }
+        return false;
+    }
+    file.seekg(0, std::ios::end);
+    Progress progress;
+    progress.totalBytes = static_cast<qint64>(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    QVector<RequirementsManager::Requirement> batch;
+    std::string carry;  // partial record spanning a chunk boundary
+    std::vector<char> chunk(static_cast<size_t>(chunkSize_));
+
+    auto flush = [&]() {
+        if (!batch.empty()) {
+            onBatch(batch);
+            batch.clear();
+        }
+    };
+
+    while (file) {
+        file.read(chunk.data(), chunkSize_);
+        const std::streamsize got = file.gcount();
+        if (got <= 0) {
+            break;
+        }
+        progress.bytesRead += got;
+        carry.append(chunk.data(), static_cast<size_t>(got));
+
+        // Parse every complete record in the buffer; the remainder
+        // carries into the next chunk. A newline only terminates a
+        // record outside quoted fields, so multi-line descriptions
+        // survive the chunking.
+        size_t start = 0;
+        bool quoted = false;
+        size_t newline = std::string::npos;
+        for (size_t i = 0; i < carry.size(); ++i) {
+            if (carry[i] == '"') {
+                quoted = !quoted;
+            } else if (carry[i] == '\n' && !quoted) {
+                newline = i;
+            } else {
+                continue;
+            }
+            if (newline == std::string::npos) {
+                continue;
+            }
+            std::string line = carry.substr(start, newline - start);
+            if (!line.empty() && line.back() == '\r') {
+                line.pop_back();
+            }
+            start = newline + 1;
+            newline = std::string::npos;
+            RequirementsManager::Requirement req;
+            if (!line.empty() && fromCsvRow(line, req)) {
+                batch.push_back(req);
+                progress.recordsParsed++;
+                if (batch.size() >= batchSize_) {
+                    flush();
+                }
+            }
+        }
+        carry.erase(0, start);
+        if (onProgress) {
+            onProgress(progress);
+        }
+    }
+
+    // Final record without a trailing newline
+    if (!carry.empty()) {
+        RequirementsManager::Requirement req;
+        if (fromCsvRow(carry, req)) {
+            batch.push_back(req);
+            progress.recordsParsed++;
+        }
+    }
+    flush();
+
+    progress.finished = true;
+    if (onProgress) {
+        onProgress(progress);
+    }
+    return true;
+}
+
+bool RequirementsStreamer::importFileAsync(const QString& filePath,
+                                           const BatchHandler& onBatch,
+                                           const ProgressHandler& onProgress) {
+    if (running_.exchange(true)) {
+        return false;
+    }
+    // Reap the previous worker: it has finished (running_ was false)
+    // but stays joinable until joined, and assigning over a joinable
+    // thread terminates
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+    worker_ = std::thread([this, filePath, onBatch, onProgress]() {
+        importFile(filePath, onBatch, onProgress);
+        running_.store(false);
+    });
+    return true;
+}
+
+void RequirementsStreamer::wait() {
+    if (worker_.joinable()) {
+        worker_.join();
+    }
+}
+
+bool RequirementsStreamer::importRunning() const {
+    return running_.load();
+}
+
+bool RequirementsStreamer::exportFile(const QString& filePath,
+                                      const RowProvider& rows) {
+    std::ofstream file(filePath.toStdString(), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    RequirementsManager::Requirement req;
+    for (int index = 0; rows(index, req); ++index) {
+        file << toCsvRow(req).toStdString() << '\n';
+    }
+    return static_cast<bool>(file);
+}
+
+QString RequirementsStreamer::toCsvRow(
+    const RequirementsManager::Requirement& req) {
+    std::ostringstream row;
+    row << escapeCsv(req.id.toStdString()) << ','
+        << escapeCsv(req.title.toStdString()) << ','
+        << escapeCsv(req.description.toStdString()) << ','
+        << static_cast<int>(req.type) << ','
+        << static_cast<int>(req.priority) << ','
+        << static_cast<int>(req.status) << ','
+        << escapeCsv(req.rationale.toStdString()) << ','
+        << escapeCsv(req.source.toStdString()) << ','
+        << escapeCsv(req.version.toStdString());
+    return QString::fromStdString(row.str());
+}
+
+bool RequirementsStreamer::fromCsvRow(const std::string& row,
+                                      RequirementsManager::Requirement& out) {
+    const std::vector<std::string> fields = splitCsv(row);
+    if (fields.size() < 9 || fields[0].empty()) {
+        return false;
+    }
+    out.id = QString::fromStdString(fields[0]);
+    out.title = QString::fromStdString(fields[1]);
+    out.description = QString::fromStdString(fields[2]);
+    try {
+        out.type = static_cast<RequirementsManager::RequirementType>(
+            std::stoi(fields[3]));
+        out.priority = static_cast<RequirementsManager::Priority>(
+            std::stoi(fields[4]));
+        out.status = static_cast<RequirementsManager::Status>(
+            std::stoi(fields[5]));
+    } catch (const std::exception&) {
+        return false;
+    }
+    out.rationale = QString::fromStdString(fields[6]);
+    out.source = QString::fromStdString(fields[7]);
+    out.version = QString::fromStdString(fields[8]);
+    return true;
+}
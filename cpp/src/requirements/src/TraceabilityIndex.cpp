@@ -0,0 +1,195 @@
+#include "TraceabilityIndex.hpp"
+
+#include <algorithm>
+
+const std::vector<int> TraceabilityIndex::kEmpty;
+
+namespace {
+
+int internInto(std::map<QString, int>& indexById, std::vector<QString>& ids,
+               const QString& id) {
+    auto it = indexById.find(id);
+    if (it != indexById.end()) {
+        return it->second;
+    }
+    const int index = static_cast<int>(ids.size());
+    indexById.emplace(id, index);
+    ids.push_back(id);
+    return index;
+}
+
+} // namespace
+
+int TraceabilityIndex::internRequirement(const QString& reqId) {
+    const int index = internInto(requirements_.indexById, requirements_.ids, reqId);
+    for (int kind = 0; kind < kArtifactKinds; ++kind) {
+        if (forward_[kind].size() < requirements_.ids.size()) {
+            forward_[kind].resize(requirements_.ids.size());
+        }
+    }
+    return index;
+}
+
+int TraceabilityIndex::internArtifact(Artifact kind, const QString& artifactId) {
+    Side& side = artifacts_[static_cast<int>(kind)];
+    const int index = internInto(side.indexById, side.ids, artifactId);
+    auto& reverse = reverse_[static_cast<int>(kind)];
+    if (reverse.size() < side.ids.size()) {
+        reverse.resize(side.ids.size());
+    }
+    return index;
+}
+
+int TraceabilityIndex::requirementIndex(const QString& reqId) const {
+    auto it = requirements_.indexById.find(reqId);
+    return it != requirements_.indexById.end() ? it->second : -1;
+}
+
+int TraceabilityIndex::artifactIndex(Artifact kind, const QString& artifactId) const {
+    const Side& side = artifacts_[static_cast<int>(kind)];
+    auto it = side.indexById.find(artifactId);
+    return it != side.indexById.end() ? it->second : -1;
+}
+
+void TraceabilityIndex::addLink(const QString& reqId, Artifact kind,
+                                const QString& artifactId) {
+    const int req = internRequirement(reqId);
+    const int art = internArtifact(kind, artifactId);
+    auto& forward = forward_[static_cast<int>(kind)][req];
+    if (std::find(forward.begin(), forward.end(), art) != forward.end()) {
+        return;
+    }
+    forward.push_back(art);
+    reverse_[static_cast<int>(kind)][art].push_back(req);
+}
+
+bool TraceabilityIndex::removeLink(const QString& reqId, Artifact kind,
+                                   const QString& artifactId) {
+    const int req = requirementIndex(reqId);
+    const int art = artifactIndex(kind, artifactId);
+    if (req < 0 || art < 0) {
+        return false;
+    }
+    auto& forward = forward_[static_cast<int>(kind)][req];
+    auto it = std::find(forward.begin(), forward.end(), art);
+    if (it == forward.end()) {
+        return false;
+    }
+    forward.erase(it);
+    auto& reverse = reverse_[static_cast<int>(kind)][art];
+    reverse.erase(std::find(reverse.begin(), reverse.end(), req));
+    return true;
+}
+
+const std::vector<int>& TraceabilityIndex::artifactsOf(int requirementIndex,
+                                                       Artifact kind) const {
+    const auto& forward = forward_[static_cast<int>(kind)];
+    if (requirementIndex < 0 ||
+        requirementIndex >= static_cast<int>(forward.size())) {
+        return kEmpty;
+    }
+    return forward[requirementIndex];
+}
+
+const std::vector<int>& TraceabilityIndex::requirementsOf(Artifact kind,
+                                                          int artifactIndex) const {
+    const auto& reverse = reverse_[static_cast<int>(kind)];
+    if (artifactIndex < 0 || artifactIndex >= static_cast<int>(reverse.size())) {
+        return kEmpty;
+    }
+    return reverse[artifactIndex];
+}
+
+const QString& TraceabilityIndex::requirementId(int index) const {
+    return requirements_.ids[index];
+}
+
+const QString& TraceabilityIndex::artifactId(Artifact kind, int index) const {
+    return artifacts_[static_cast<int>(kind)].ids[index];
+}
+
+int TraceabilityIndex::requirementCount() const {
+    return static_cast<int>(requirements_.ids.size());
+}
+
+int TraceabilityIndex::artifactCount(Artifact kind) const {
+    return static_cast<int>(artifacts_[static_cast<int>(kind)].ids.size());
+}
+
+bool TraceabilityIndex::isCovered(const QString& reqId, Artifact kind) const {
+    return !artifactsOf(requirementIndex(reqId), kind).empty();
+}
+
+std::vector<QString> TraceabilityIndex::uncoveredRequirements(Artifact kind) const {
+    std::vector<QString> uncovered;
+    const auto& forward = forward_[static_cast<int>(kind)];
+    for (size_t i = 0; i < requirements_.ids.size(); ++i) {
+        if (i >= forward.size() || forward[i].empty()) {
+            uncovered.push_back(requirements_.ids[i]);
+        }
+    }
+    return uncovered;
+}
+
+double TraceabilityIndex::coverageRatio(Artifact kind) const {
+    if (requirements_.ids.empty()) {
+        return 0.0;
+    }
+    const size_t total = requirements_.ids.size();
+    return 1.0 - static_cast<double>(uncoveredRequirements(kind).size()) /
+                     static_cast<double>(total);
+}
+
+RequirementsManager::TraceabilityMatrix TraceabilityIndex::buildMatrix() const {
+    RequirementsManager::TraceabilityMatrix matrix;
+    for (const QString& id : requirements_.ids) {
+        matrix.requirements.push_back(id);
+    }
+    for (const QString& id : artifacts_[static_cast<int>(Artifact::Component)].ids) {
+        matrix.components.push_back(id);
+    }
+    for (const QString& id : artifacts_[static_cast<int>(Artifact::TestCase)].ids) {
+        matrix.testCases.push_back(id);
+    }
+    for (const QString& id : artifacts_[static_cast<int>(Artifact::UseCase)].ids) {
+        matrix.useCases.push_back(id);
+    }
+    for (const QString& id : artifacts_[static_cast<int>(Artifact::SystemVDoc)].ids) {
+        matrix.systemVDocs.push_back(id);
+    }
+
+    // Column layout: components | testCases | useCases | systemVDocs
+    const int columnCounts[kArtifactKinds] = {
+        artifactCount(Artifact::Component),
+        artifactCount(Artifact::TestCase),
+        artifactCount(Artifact::UseCase),
+        artifactCount(Artifact::SystemVDoc)
+    };
+    int totalColumns = 0;
+    int columnOffsets[kArtifactKinds];
+    for (int kind = 0; kind < kArtifactKinds; ++kind) {
+        columnOffsets[kind] = totalColumns;
+        totalColumns += columnCounts[kind];
+    }
+
+    matrix.relationships.resize(requirementCount());
+    for (int req = 0; req < requirementCount(); ++req) {
+        QVector<bool> row(totalColumns, false);
+        for (int kind = 0; kind < kArtifactKinds; ++kind) {
+            for (int art : artifactsOf(req, static_cast<Artifact>(kind))) {
+                row[columnOffsets[kind] + art] = true;
+            }
+        }
+        matrix.relationships[req] = row;
+    }
+    return matrix;
+}
+
+void TraceabilityIndex::clear() {
+    requirements_ = Side();
+    for (int kind = 0; kind < kArtifactKinds; ++kind) {
+        artifacts_[kind] = Side();
+        forward_[kind].clear();
+        reverse_[kind].clear();
+    }
+}
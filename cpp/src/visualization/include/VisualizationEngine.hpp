@@ -76,6 +76,20 @@ public:
     void enableGPUAcceleration(bool enable);
     QMap<QString, QVariant> getPerformanceMetrics(const QString& sceneId);
 
+    // Instanced rendering
+    // Identical meshes (fasteners, battery cells) are grouped by geometry;
+    // per-instance transforms live in one GPU buffer and each group renders
+    // with a single instanced draw. Frustum culling rebuilds the buffers
+    // from visible instances only, so off-screen assemblies cost nothing.
+    void enableInstancedRendering(const QString& sceneId, bool enable);
+    QString createInstanceGroup(const QString& sceneId, Qt3DRender::QGeometryRenderer* mesh,
+                                Qt3DRender::QMaterial* material, float boundingRadius);
+    int addInstance(const QString& sceneId, const QString& groupId, const QMatrix4x4& transform);
+    void updateInstanceTransform(const QString& sceneId, const QString& groupId,
+                                 int instanceIndex, const QMatrix4x4& transform);
+    void removeInstance(const QString& sceneId, const QString& groupId, int instanceIndex);
+    void setFrustumCullingEnabled(const QString& sceneId, bool enable);
+
 signals:
     void sceneCreated(const QString& sceneId);
     void sceneUpdated(const QString& sceneId);
@@ -93,13 +107,27 @@ private:
     VisualizationEngine(const VisualizationEngine&) = delete;
     VisualizationEngine& operator=(const VisualizationEngine&) = delete;
 
+    struct InstanceGroup {
+        Qt3DRender::QGeometryRenderer* mesh{nullptr};
+        Qt3DRender::QMaterial* material{nullptr};
+        Qt3DCore::QEntity* entity{nullptr};
+        Qt3DRender::QBuffer* instanceBuffer{nullptr};
+        QVector<QMatrix4x4> transforms;       // all instances
+        QVector<int> visibleIndices;          // survivors of the last cull
+        float boundingRadius{0.0f};
+        bool buffersDirty{true};
+    };
+
     struct Scene {
         Qt3DCore::QEntity* root;
         Qt3DRender::QCamera* camera;
         QVector<Qt3DCore::QEntity*> lights;
         QMap<QString, Qt3DCore::QEntity*> objects;
         QMap<QString, Qt3DCore::QEntity*> animations;
+        QMap<QString, InstanceGroup> instanceGroups;
         VisConfig config;
+        bool instancedRendering{false};
+        bool frustumCulling{true};
     };
 
     // Internal methods
@@ -108,6 +136,8 @@ private:
     void setupPostProcessing(Scene* scene);
     void optimizeScene(Scene* scene);
     void updateSceneGraph(Scene* scene);
+    void cullInstances(Scene* scene);
+    void uploadInstanceBuffers(Scene* scene);
     
     // State
     QMap<QString, std::unique_ptr<Scene>> scenes_;
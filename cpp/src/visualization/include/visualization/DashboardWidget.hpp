@@ -30,6 +30,15 @@ public:
     void setMaxDataPoints(int points);
     void setTheme(const QString& theme);
 
+    // Diff-based updates
+    // Gauges register value bindings; metric changes are coalesced into a
+    // per-frame dirty set and one flush repaints only the bounding regions
+    // of gauges whose values moved past their threshold, instead of
+    // invalidating whole panels on every update.
+    void setDiffUpdatesEnabled(bool enabled);
+    void registerBinding(const QString& metric, QWidget* gauge, double minDelta = 0.0);
+    void unregisterBinding(const QString& metric);
+
 public slots:
     void exportData(const QString& format = "csv");
     void saveScreenshot(const QString& filename = QString());
@@ -65,6 +74,10 @@ private:
     void calculateStatistics();
     void detectAnomalies();
 
+    // Diff-based update path
+    void queueMetricChange(const QString& metric, double value);
+    void flushDirtyGauges();
+
     // Styling
     void applyTheme(const QString& theme);
     void updateColorScheme();
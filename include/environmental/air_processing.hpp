@@ -3,6 +3,8 @@
 #include "evehicle/types.hpp"
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <vector>
 
 namespace evehicle {
 namespace environmental {
@@ -69,6 +71,77 @@ struct AirProcessorConfig {
     }
 };
 
+// Non-owning view of one acquisition frame: sampleCount consecutive
+// samples for each of channelCount sensors, stored channel-major
+// (channel c starts at samples + c * sampleCount)
+struct SensorFrame {
+    const double* samples;
+    std::size_t sampleCount;
+    std::size_t channelCount;
+};
+
+// Aggregated result emitted once per frame instead of once per sample
+struct FrameQualityMetrics {
+    double airQualityIndex;       // frame-aggregate AQI
+    double worstChannelMean;      // highest filtered channel mean
+    std::size_t worstChannel;
+    std::size_t samplesProcessed;
+};
+
+// Block-processing stage for the high-rate sensor array. The filter
+// chain (per-channel exponential smoothing) runs over a whole frame in
+// contiguous inner loops, so the per-sample cost is a handful of
+// multiply-adds and quality metrics are computed once per frame rather
+// than per sample.
+class FrameProcessor {
+public:
+    explicit FrameProcessor(double smoothing = 0.1)
+        : smoothing_(smoothing) {}
+
+    FrameQualityMetrics processFrame(const SensorFrame& frame) {
+        if (filtered_.size() != frame.channelCount) {
+            filtered_.assign(frame.channelCount, 0.0);
+            primed_.assign(frame.channelCount, false);
+        }
+
+        FrameQualityMetrics metrics{};
+        metrics.samplesProcessed = frame.sampleCount * frame.channelCount;
+
+        double sum = 0.0;
+        for (std::size_t c = 0; c < frame.channelCount; ++c) {
+            const double* channel = frame.samples + c * frame.sampleCount;
+            double state = primed_[c] ? filtered_[c] : channel[0];
+            // Contiguous inner loop: one multiply-add per sample
+            for (std::size_t i = 0; i < frame.sampleCount; ++i) {
+                state += smoothing_ * (channel[i] - state);
+            }
+            filtered_[c] = state;
+            primed_[c] = true;
+            sum += state;
+            if (state > metrics.worstChannelMean || c == 0) {
+                metrics.worstChannelMean = state;
+                metrics.worstChannel = c;
+            }
+        }
+
+        // AQI scale: 0 contamination -> 100, saturating at heavy load
+        const double meanContamination =
+            frame.channelCount > 0 ? sum / frame.channelCount : 0.0;
+        metrics.airQualityIndex = 100.0 / (1.0 + meanContamination);
+        return metrics;
+    }
+
+    void reset() {
+        filtered_.clear();
+        primed_.clear();
+    }
+
+private:
+    double smoothing_;
+    std::vector<double> filtered_;   // per-channel filter state
+    std::vector<bool> primed_;
+};
+
 class AirProcessor {
 public:
     AirProcessor();
@@ -85,6 +158,10 @@ public:
     // Air quality control
     double getAirQualityIndex() const;
     void setAirQualityTarget(double target);
+
+    // Batched path for the 64-channel array: runs the filter chain over
+    // a whole frame and folds the result into the quality index once
+    FrameQualityMetrics processSampleFrame(const SensorFrame& frame);
     
     // Processing control
     void startProcessing();
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "evehicle/types.hpp"
+#include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 
 namespace evehicle {
 namespace environmental {
@@ -43,6 +46,83 @@ struct CO2CaptureConfig {
     }
 };
 
+// Predictive scheduler for sorbent regeneration. CO2 load observations
+// from the environmental history feed per-hour exponential averages;
+// regeneration is then steered into predicted low-load windows instead
+// of firing reactively when a capacity threshold trips, so capture
+// throughput stays high while the cabin is loaded.
+class RegenerationScheduler {
+public:
+    // Regenerate opportunistically above the soft threshold, always
+    // above the hard one
+    static constexpr double kSoftCapacityThreshold = 0.60;
+    static constexpr double kHardCapacityThreshold = 0.90;
+
+    void observe(double co2Ppm, std::int64_t timestampMs) {
+        const std::size_t bucket = hourBucket(timestampMs);
+        if (primed_[bucket]) {
+            hourlyLoad_[bucket] += kSmoothing * (co2Ppm - hourlyLoad_[bucket]);
+        } else {
+            hourlyLoad_[bucket] = co2Ppm;
+            primed_[bucket] = true;
+        }
+        if (overallPrimed_) {
+            overallLoad_ += kSmoothing * (co2Ppm - overallLoad_);
+        } else {
+            overallLoad_ = co2Ppm;
+            overallPrimed_ = true;
+        }
+    }
+
+    // Forecast for a future instant: the learned hour-of-day average,
+    // falling back to the overall average before that hour has history
+    double forecastLoad(std::int64_t timestampMs) const {
+        const std::size_t bucket = hourBucket(timestampMs);
+        return primed_[bucket] ? hourlyLoad_[bucket] : overallLoad_;
+    }
+
+    // True when regeneration should run now: forced above the hard
+    // threshold, or above the soft threshold while the forecast says
+    // the current hour is a below-average load window
+    bool shouldRegenerate(double capacityUsed, std::int64_t nowMs) const {
+        if (capacityUsed >= kHardCapacityThreshold) {
+            return true;
+        }
+        if (capacityUsed < kSoftCapacityThreshold || !overallPrimed_) {
+            return false;
+        }
+        return forecastLoad(nowMs) < overallLoad_;
+    }
+
+    // Start of the lowest-forecast hour within the horizon, for
+    // planning a deferred regeneration cycle
+    std::int64_t nextLowLoadWindowMs(std::int64_t nowMs, std::int64_t horizonMs) const {
+        std::int64_t best = nowMs;
+        double bestLoad = forecastLoad(nowMs);
+        for (std::int64_t t = nowMs; t <= nowMs + horizonMs; t += kHourMs) {
+            const double load = forecastLoad(t);
+            if (load < bestLoad) {
+                bestLoad = load;
+                best = t;
+            }
+        }
+        return best;
+    }
+
+private:
+    static constexpr std::int64_t kHourMs = 60 * 60 * 1000;
+    static constexpr double kSmoothing = 0.2;
+
+    static std::size_t hourBucket(std::int64_t timestampMs) {
+        return static_cast<std::size_t>((timestampMs / kHourMs) % 24);
+    }
+
+    std::array<double, 24> hourlyLoad_{};
+    std::array<bool, 24> primed_{};
+    double overallLoad_ = 0.0;
+    bool overallPrimed_ = false;
+};
+
 class CO2Capture {
 public:
     using Mode = CaptureMode;
@@ -76,10 +156,16 @@ public:
     // Mode control
     void setOperatingMode(Mode mode);
 
+    // Regeneration scheduling: feed observations from the history loop
+    // and consult the forecast before triggering a sorbent cycle
+    RegenerationScheduler& regenerationScheduler() { return regenScheduler_; }
+    const RegenerationScheduler& regenerationScheduler() const { return regenScheduler_; }
+
 private:
     void applyMode();
     StatusCode determineStatus() const;
 
+    RegenerationScheduler regenScheduler_;
     CO2CaptureConfig config_;
     bool isOperational_ = false;
     bool isCapturing_ = false;
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "evehicle/types.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -65,6 +68,101 @@ struct ImpactReport {
     Json toJson() const;
 };
 
+// Columnar environmental history: one contiguous array per field
+// instead of an array of record structs. Month-scale rollups touch
+// only the columns they need and the reduction loops run at memory
+// bandwidth; timestamps are appended in order, so range queries are
+// two binary searches plus tight per-column loops.
+class ColumnarHistory {
+public:
+    struct ColumnSummary {
+        double min = 0.0;
+        double max = 0.0;
+        double mean = 0.0;
+        double sum = 0.0;
+    };
+
+    struct ImpactSummary {
+        ColumnSummary co2Level;
+        ColumnSummary o2Level;
+        ColumnSummary efficiency;
+        ColumnSummary powerConsumption;
+        std::size_t sampleCount = 0;
+    };
+
+    void reserve(std::size_t capacity) {
+        timestampsMs_.reserve(capacity);
+        co2Level_.reserve(capacity);
+        o2Level_.reserve(capacity);
+        efficiency_.reserve(capacity);
+        powerConsumption_.reserve(capacity);
+    }
+
+    void append(std::int64_t timestampMs, double co2Level, double o2Level,
+                double efficiency, double powerConsumption) {
+        timestampsMs_.push_back(timestampMs);
+        co2Level_.push_back(co2Level);
+        o2Level_.push_back(o2Level);
+        efficiency_.push_back(efficiency);
+        powerConsumption_.push_back(powerConsumption);
+    }
+
+    std::size_t size() const { return timestampsMs_.size(); }
+
+    ImpactSummary summarize(std::int64_t startMs, std::int64_t endMs) const {
+        ImpactSummary summary;
+        const auto first = std::lower_bound(timestampsMs_.begin(),
+                                            timestampsMs_.end(), startMs);
+        const auto last = std::upper_bound(timestampsMs_.begin(),
+                                           timestampsMs_.end(), endMs);
+        const std::size_t begin = static_cast<std::size_t>(first - timestampsMs_.begin());
+        const std::size_t end = static_cast<std::size_t>(last - timestampsMs_.begin());
+        if (begin >= end) {
+            return summary;
+        }
+        summary.sampleCount = end - begin;
+        summary.co2Level = reduce(co2Level_, begin, end);
+        summary.o2Level = reduce(o2Level_, begin, end);
+        summary.efficiency = reduce(efficiency_, begin, end);
+        summary.powerConsumption = reduce(powerConsumption_, begin, end);
+        return summary;
+    }
+
+    const std::vector<double>& co2Column() const { return co2Level_; }
+    const std::vector<double>& o2Column() const { return o2Level_; }
+    const std::vector<double>& efficiencyColumn() const { return efficiency_; }
+    const std::vector<double>& powerColumn() const { return powerConsumption_; }
+
+private:
+    // Single pass over one contiguous column; no branches beyond
+    // min/max selects, so the compiler vectorizes the loop
+    static ColumnSummary reduce(const std::vector<double>& column,
+                                std::size_t begin, std::size_t end) {
+        ColumnSummary s;
+        const double* data = column.data();
+        double minValue = data[begin];
+        double maxValue = data[begin];
+        double sum = 0.0;
+        for (std::size_t i = begin; i < end; ++i) {
+            const double v = data[i];
+            minValue = v < minValue ? v : minValue;
+            maxValue = v > maxValue ? v : maxValue;
+            sum += v;
+        }
+        s.min = minValue;
+        s.max = maxValue;
+        s.sum = sum;
+        s.mean = sum / static_cast<double>(end - begin);
+        return s;
+    }
+
+    std::vector<std::int64_t> timestampsMs_;
+    std::vector<double> co2Level_;
+    std::vector<double> o2Level_;
+    std::vector<double> efficiency_;
+    std::vector<double> powerConsumption_;
+};
+
 // Analyzer configuration
 struct ImpactAnalyzerConfig {
     std::chrono::seconds samplingInterval;
@@ -104,6 +202,9 @@ public:
     std::vector<Recommendation> getRecommendations() const;
 
     // Data collection
+    // Month-scale summaries read the columnar store instead of
+    // iterating record structs
+    void setHistory(std::shared_ptr<const ColumnarHistory> history);
     void startDataCollection();
     void stopDataCollection();
     bool isCollectingData() const;
@@ -2,6 +2,9 @@
 
 #include "evehicle/types.hpp"
 #include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <vector>
 
 namespace evehicle {
 namespace environmental {
@@ -43,6 +46,99 @@ struct O2GeneratorConfig {
     }
 };
 
+// Electrolysis efficiency model with a precomputed fast path. The
+// analytic curve depends on temperature, pressure and current density;
+// within the known operating envelope it is sampled into a
+// temperature × current-density grid at startup (pressure separates
+// out as a multiplicative correction), and runtime queries become one
+// bilinear lookup. Outside the table bounds the analytic path is used
+// automatically, so the fast path never changes behaviour at the
+// envelope edges.
+class ElectrolysisModel {
+public:
+    // Reference analytic model: thermal activation gain, ohmic and
+    // activation losses growing with current density, Nernst pressure
+    // penalty
+    static double analyticEfficiency(double temperatureC, double pressureBar,
+                                     double currentDensity) {
+        return thermalTerm(temperatureC, currentDensity) * pressureTerm(pressureBar);
+    }
+
+    // Samples the analytic model over the operating envelope; called
+    // once at startup
+    void buildTable(double temperatureMinC, double temperatureMaxC,
+                    std::size_t temperatureSteps,
+                    double currentDensityMin, double currentDensityMax,
+                    std::size_t currentDensitySteps) {
+        temperatureMin_ = temperatureMinC;
+        temperatureMax_ = temperatureMaxC;
+        currentMin_ = currentDensityMin;
+        currentMax_ = currentDensityMax;
+        temperatureSteps_ = temperatureSteps;
+        currentSteps_ = currentDensitySteps;
+        table_.resize(temperatureSteps * currentDensitySteps);
+        for (std::size_t t = 0; t < temperatureSteps; ++t) {
+            const double temperature = temperatureMin_ +
+                (temperatureMax_ - temperatureMin_) * t / (temperatureSteps - 1);
+            for (std::size_t j = 0; j < currentDensitySteps; ++j) {
+                const double current = currentMin_ +
+                    (currentMax_ - currentMin_) * j / (currentDensitySteps - 1);
+                table_[t * currentDensitySteps + j] = thermalTerm(temperature, current);
+            }
+        }
+    }
+
+    bool hasTable() const { return !table_.empty(); }
+
+    // Bilinear fast path inside the envelope, analytic fallback outside
+    double efficiency(double temperatureC, double pressureBar,
+                      double currentDensity) const {
+        if (table_.empty() ||
+            temperatureC < temperatureMin_ || temperatureC > temperatureMax_ ||
+            currentDensity < currentMin_ || currentDensity > currentMax_) {
+            return analyticEfficiency(temperatureC, pressureBar, currentDensity);
+        }
+        const double tPos = (temperatureC - temperatureMin_) /
+            (temperatureMax_ - temperatureMin_) * (temperatureSteps_ - 1);
+        const double jPos = (currentDensity - currentMin_) /
+            (currentMax_ - currentMin_) * (currentSteps_ - 1);
+        const std::size_t t0 = static_cast<std::size_t>(tPos);
+        const std::size_t j0 = static_cast<std::size_t>(jPos);
+        const std::size_t t1 = t0 + 1 < temperatureSteps_ ? t0 + 1 : t0;
+        const std::size_t j1 = j0 + 1 < currentSteps_ ? j0 + 1 : j0;
+        const double tFrac = tPos - t0;
+        const double jFrac = jPos - j0;
+        const double low = table_[t0 * currentSteps_ + j0] * (1.0 - jFrac) +
+                           table_[t0 * currentSteps_ + j1] * jFrac;
+        const double high = table_[t1 * currentSteps_ + j0] * (1.0 - jFrac) +
+                            table_[t1 * currentSteps_ + j1] * jFrac;
+        return (low * (1.0 - tFrac) + high * tFrac) * pressureTerm(pressureBar);
+    }
+
+private:
+    static double thermalTerm(double temperatureC, double currentDensity) {
+        // Warmer cells conduct better; higher current density costs
+        // overpotential. Clamped to a physical 0..1 efficiency.
+        const double thermal = 0.70 + 0.002 * (temperatureC - 25.0);
+        const double losses = 0.08 * currentDensity + 0.02 * currentDensity * currentDensity;
+        const double eff = thermal - losses;
+        return eff < 0.0 ? 0.0 : (eff > 1.0 ? 1.0 : eff);
+    }
+
+    static double pressureTerm(double pressureBar) {
+        // Nernst penalty relative to 1 bar operation
+        return 1.0 - 0.015 * std::log(pressureBar < 0.1 ? 0.1 : pressureBar);
+    }
+
+    std::vector<double> table_;
+    double temperatureMin_ = 0.0;
+    double temperatureMax_ = 0.0;
+    double currentMin_ = 0.0;
+    double currentMax_ = 0.0;
+    std::size_t temperatureSteps_ = 0;
+    std::size_t currentSteps_ = 0;
+};
+
 class O2Generator {
 public:
     using Mode = PowerMode;
@@ -76,10 +172,16 @@ public:
     // Mode control
     void setPowerMode(Mode mode);
 
+    // Electrolysis model used by the per-tick controller; initialize()
+    // builds its lookup table for the configured operating envelope
+    ElectrolysisModel& electrolysisModel() { return electrolysisModel_; }
+    const ElectrolysisModel& electrolysisModel() const { return electrolysisModel_; }
+
 private:
     void applyMode();
     StatusCode determineStatus() const;
 
+    ElectrolysisModel electrolysisModel_;
     O2GeneratorConfig config_;
     bool isOperational_ = false;
     bool isGenerating_ = false;
@@ -4,6 +4,11 @@
 #include "evehicle/environmental/air_processing.hpp"
 #include "evehicle/environmental/co2_capture.hpp"
 #include "evehicle/environmental/o2_generation.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <chrono>
 #include <vector>
@@ -43,6 +48,72 @@ struct EnvironmentalRecord {
     Json toJson() const;
 };
 
+// Trivially copyable mirror of EnvironmentalStatus for placement in a
+// shared-memory segment: fixed-size message buffer, enums and the
+// timestamp flattened to integers, no pointers
+struct TelemetrySnapshot {
+    double co2Level;
+    double o2Level;
+    double airQuality;
+    std::int32_t status;          // StatusCode
+    std::int32_t currentMode;     // OperatingMode
+    std::int64_t timestampMs;
+    char message[64];
+};
+
+// Seqlock-protected telemetry cell. The system publishes each status
+// update in place; local consumers (the 10 Hz dashboard) read it with
+// two loads and a memcpy — no syscalls, no serialization. An odd
+// sequence marks a write in progress; readers retry until they see the
+// same even sequence on both sides of the copy. JSON remains the
+// off-board export format only.
+class TelemetryCell {
+public:
+    void publish(const EnvironmentalStatus& status) {
+        const std::uint32_t seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1, std::memory_order_release);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        snapshot_.co2Level = status.co2Level;
+        snapshot_.o2Level = status.o2Level;
+        snapshot_.airQuality = status.airQuality;
+        snapshot_.status = static_cast<std::int32_t>(status.status);
+        snapshot_.currentMode = static_cast<std::int32_t>(status.currentMode);
+        snapshot_.timestampMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+            status.timestamp.time_since_epoch()).count();
+        const std::size_t length = status.message.size() < sizeof(snapshot_.message) - 1
+            ? status.message.size() : sizeof(snapshot_.message) - 1;
+        std::memcpy(snapshot_.message, status.message.data(), length);
+        snapshot_.message[length] = '\0';
+
+        std::atomic_thread_fence(std::memory_order_release);
+        sequence_.store(seq + 2, std::memory_order_release);
+    }
+
+    // Copies a consistent snapshot; returns false only if a writer was
+    // mid-update for every attempt (practically never at 10 Hz)
+    bool read(TelemetrySnapshot& out, unsigned maxRetries = 8) const {
+        for (unsigned attempt = 0; attempt < maxRetries; ++attempt) {
+            const std::uint32_t before = sequence_.load(std::memory_order_acquire);
+            if (before & 1u) {
+                continue;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            TelemetrySnapshot copy = snapshot_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence_.load(std::memory_order_acquire) == before) {
+                out = copy;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    std::atomic<std::uint32_t> sequence_{0};
+    TelemetrySnapshot snapshot_{};
+};
+
 // Environmental system configuration
 struct EnvironmentalSystemConfig {
     AirProcessorConfig airConfig;
@@ -60,6 +131,129 @@ struct EnvironmentalSystemConfig {
     }
 };
 
+// Precision policies for the per-tick control math. DoublePrecision is
+// the reference; Float32Precision and FixedPointPrecision are the fast
+// paths for MCU-class boards without fast double units. Policies only
+// define the scalar type and conversions, so the control loop template
+// below compiles to plain arithmetic in the chosen representation.
+struct DoublePrecision {
+    using Scalar = double;
+    static constexpr Scalar fromDouble(double v) { return v; }
+    static constexpr double toDouble(Scalar v) { return v; }
+    static constexpr Scalar mul(Scalar a, Scalar b) { return a * b; }
+};
+
+struct Float32Precision {
+    using Scalar = float;
+    static constexpr Scalar fromDouble(double v) { return static_cast<float>(v); }
+    static constexpr double toDouble(Scalar v) { return v; }
+    static constexpr Scalar mul(Scalar a, Scalar b) { return a * b; }
+};
+
+// Q16.16 fixed point: integer ALU only, enough range for ppm-scale CO2
+// levels and percent-scale O2/quality values
+struct FixedPointPrecision {
+    using Scalar = std::int32_t;
+    static constexpr int kFractionalBits = 16;
+    static constexpr Scalar fromDouble(double v) {
+        return static_cast<Scalar>(v * (1 << kFractionalBits));
+    }
+    static constexpr double toDouble(Scalar v) {
+        return static_cast<double>(v) / (1 << kFractionalBits);
+    }
+    static constexpr Scalar mul(Scalar a, Scalar b) {
+        return static_cast<Scalar>(
+            (static_cast<std::int64_t>(a) * b) >> kFractionalBits);
+    }
+};
+
+// Per-tick proportional control in the policy's representation. The
+// gains and targets are converted once at configuration time; tick()
+// is branch-free scalar math that fits the 1 ms ECO-mode budget on
+// low-power boards.
+template <typename PrecisionPolicy>
+class ControlLoop {
+public:
+    using Scalar = typename PrecisionPolicy::Scalar;
+
+    struct Targets {
+        double co2Ppm = 400.0;
+        double o2Percent = 20.9;
+        double airQuality = 95.0;
+    };
+
+    struct Gains {
+        double co2 = 0.05;
+        double o2 = 0.10;
+        double airQuality = 0.08;
+    };
+
+    struct Corrections {
+        double co2Capture;     // demanded capture rate adjustment
+        double o2Generation;   // demanded generation rate adjustment
+        double airProcessing;  // demanded processing power adjustment
+    };
+
+    void configure(const Targets& targets, const Gains& gains) {
+        co2Target_ = PrecisionPolicy::fromDouble(targets.co2Ppm);
+        o2Target_ = PrecisionPolicy::fromDouble(targets.o2Percent);
+        qualityTarget_ = PrecisionPolicy::fromDouble(targets.airQuality);
+        co2Gain_ = PrecisionPolicy::fromDouble(gains.co2);
+        o2Gain_ = PrecisionPolicy::fromDouble(gains.o2);
+        qualityGain_ = PrecisionPolicy::fromDouble(gains.airQuality);
+    }
+
+    Corrections tick(double co2Ppm, double o2Percent, double airQuality) const {
+        const Scalar co2Error = PrecisionPolicy::fromDouble(co2Ppm) - co2Target_;
+        const Scalar o2Error = o2Target_ - PrecisionPolicy::fromDouble(o2Percent);
+        const Scalar qualityError = qualityTarget_ - PrecisionPolicy::fromDouble(airQuality);
+        return {
+            PrecisionPolicy::toDouble(PrecisionPolicy::mul(co2Gain_, co2Error)),
+            PrecisionPolicy::toDouble(PrecisionPolicy::mul(o2Gain_, o2Error)),
+            PrecisionPolicy::toDouble(PrecisionPolicy::mul(qualityGain_, qualityError))
+        };
+    }
+
+private:
+    Scalar co2Target_{};
+    Scalar o2Target_{};
+    Scalar qualityTarget_{};
+    Scalar co2Gain_{};
+    Scalar o2Gain_{};
+    Scalar qualityGain_{};
+};
+
+// Statically allocated history ring: no heap traffic on the control
+// path, oldest records overwritten once the capacity is reached
+template <std::size_t Capacity>
+class StaticHistoryRing {
+public:
+    void push(const EnvironmentalRecord& record) {
+        records_[head_] = record;
+        head_ = (head_ + 1) % Capacity;
+        if (count_ < Capacity) {
+            ++count_;
+        }
+    }
+
+    std::size_t size() const { return count_; }
+    constexpr std::size_t capacity() const { return Capacity; }
+
+    // Visits records oldest-first
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        const std::size_t start = (head_ + Capacity - count_) % Capacity;
+        for (std::size_t i = 0; i < count_; ++i) {
+            visit(records_[(start + i) % Capacity]);
+        }
+    }
+
+private:
+    std::array<EnvironmentalRecord, Capacity> records_{};
+    std::size_t head_ = 0;
+    std::size_t count_ = 0;
+};
+
 class System {
 public:
     System();
@@ -75,6 +269,10 @@ public:
 
     // Monitoring
     void setMonitoringCallback(std::function<void(const EnvironmentalStatus&)> callback);
+
+    // Publishes every status update into the given cell (typically
+    // placed in a shared-memory segment) for local zero-copy consumers
+    void attachTelemetryCell(TelemetryCell* cell);
     std::vector<EnvironmentalRecord> getHistoricalData(
         std::chrono::system_clock::time_point start,
         std::chrono::system_clock::time_point end) const;
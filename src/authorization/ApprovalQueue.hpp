@@ -0,0 +1,146 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include "Request.hpp"
+
+namespace ja {
+namespace auth {
+
+// Bounded multi-producer/multi-consumer queue for manual-review
+// requests. Worker threads enqueue without taking a global lock (each
+// ring cell carries its own sequence counter), the review side drains
+// in batches, and a full ring reports backpressure to the caller
+// instead of growing without bound.
+//
+// Two lanes: SLA-sensitive requests go to the urgent lane, which
+// takeBatch() always drains first.
+class ApprovalQueue {
+public:
+    enum class Lane {
+        Normal,
+        Urgent
+    };
+
+    static constexpr std::size_t kLaneCapacity = 1024;  // power of two
+
+    ApprovalQueue()
+        : normal_(kLaneCapacity)
+        , urgent_(kLaneCapacity) {}
+
+    // Returns false when the lane is full — the caller should shed load
+    // or fall back to synchronous denial rather than block
+    bool tryEnqueue(const Request& request, Lane lane) {
+        Ring& ring = (lane == Lane::Urgent) ? urgent_ : normal_;
+        return ring.tryPush(std::make_shared<Request>(request));
+    }
+
+    // Drains up to maxItems in one call, urgent lane first, so the
+    // review UI stops paying per-item synchronization costs
+    std::vector<Request> takeBatch(std::size_t maxItems) {
+        std::vector<Request> batch;
+        batch.reserve(maxItems);
+        drainLane(urgent_, batch, maxItems);
+        drainLane(normal_, batch, maxItems);
+        return batch;
+    }
+
+    // Approximate — counters are sampled independently of the cells
+    std::size_t approximateSize() const {
+        return normal_.approximateSize() + urgent_.approximateSize();
+    }
+
+private:
+    // Bounded MPMC ring with a per-cell sequence counter: producers and
+    // consumers claim positions with fetch_add and synchronize on the
+    // cell, never on each other
+    class Ring {
+    public:
+        explicit Ring(std::size_t capacity)
+            : cells_(capacity)
+            , mask_(capacity - 1) {
+            for (std::size_t i = 0; i < capacity; ++i) {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool tryPush(std::shared_ptr<Request> item) {
+            std::size_t pos = tail_.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = cells_[pos & mask_];
+                const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t diff =
+                    static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+                if (diff == 0) {
+                    if (tail_.compare_exchange_weak(pos, pos + 1,
+                                                    std::memory_order_relaxed)) {
+                        cell.item = std::move(item);
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;  // full — signal backpressure
+                } else {
+                    pos = tail_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool tryPop(std::shared_ptr<Request>& item) {
+            std::size_t pos = head_.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = cells_[pos & mask_];
+                const std::size_t seq = cell.sequence.load(std::memory_order_acquire);
+                const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) -
+                    static_cast<std::ptrdiff_t>(pos + 1);
+                if (diff == 0) {
+                    if (head_.compare_exchange_weak(pos, pos + 1,
+                                                    std::memory_order_relaxed)) {
+                        item = std::move(cell.item);
+                        cell.sequence.store(pos + mask_ + 1,
+                                            std::memory_order_release);
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;  // empty
+                } else {
+                    pos = head_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        std::size_t approximateSize() const {
+            const std::size_t tail = tail_.load(std::memory_order_relaxed);
+            const std::size_t head = head_.load(std::memory_order_relaxed);
+            return tail >= head ? tail - head : 0;
+        }
+
+    private:
+        struct Cell {
+            std::atomic<std::size_t> sequence{0};
+            std::shared_ptr<Request> item;
+        };
+
+        std::vector<Cell> cells_;
+        std::size_t mask_;
+        std::atomic<std::size_t> head_{0};
+        std::atomic<std::size_t> tail_{0};
+    };
+
+    static void drainLane(Ring& ring, std::vector<Request>& batch,
+                          std::size_t maxItems) {
+        std::shared_ptr<Request> item;
+        while (batch.size() < maxItems && ring.tryPop(item)) {
+            batch.push_back(*item);
+            item.reset();
+        }
+    }
+
+    Ring normal_;
+    Ring urgent_;
+};
+
+} // namespace auth
+} // namespace ja
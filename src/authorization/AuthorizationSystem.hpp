@@ -2,12 +2,14 @@
 
 #include <memory>
 #include <map>
-#include <queue>
 #include <string>
 #include <functional>
 #include "Request.hpp"
 #include "Rule.hpp"
 #include "AutomatedBot.hpp"
+#include "ApprovalQueue.hpp"
+#include "DecisionCache.hpp"
+#include "LatencyMetrics.hpp"
 
 namespace ja {
 namespace auth {
@@ -24,22 +26,82 @@ public:
             return false;
         }
 
+        // Each decision path records its end-to-end latency; recording
+        // is two relaxed increments into a per-thread shard, cheap
+        // enough to leave on in production (see LatencyMetrics.hpp)
+        auto& metrics = DecisionLatencyMetrics::getInstance();
+        const auto started = std::chrono::steady_clock::now();
+
+        // Read-through decision cache: repeat (user, resource, action)
+        // requests resolve with one hash probe instead of the rule
+        // pipeline
+        const std::uint64_t key = DecisionCache::digest(request);
+        if (auto cached = decisionCache_.lookup(key)) {
+            metrics.recordPath(DecisionLatencyMetrics::Path::CacheHit,
+                               DecisionLatencyMetrics::elapsedNanos(started));
+            return *cached;
+        }
+
         // Check if request can be handled by automated rules
         if (automatedBot_->canHandle(request)) {
-            return automatedBot_->processRequest(request).approved;
+            Decision decision = automatedBot_->processRequest(request);
+            decisionCache_.store(key, decision.approved, decision.ruleName);
+            metrics.recordPath(DecisionLatencyMetrics::Path::AutomatedRule,
+                               DecisionLatencyMetrics::elapsedNanos(started));
+            return decision.approved;
         }
 
-        // Add to approval queue if manual review needed
-        approvalQueue_.push(request);
+        // Add to approval queue if manual review needed; SLA-sensitive
+        // types take the urgent lane. A full lane signals backpressure
+        // to the caller instead of queueing unboundedly.
+        if (!approvalQueue_.tryEnqueue(request, laneFor(request))) {
+            if (overflowHandler_) {
+                overflowHandler_(request);
+            }
+        }
+        metrics.recordPath(DecisionLatencyMetrics::Path::ManualQueue,
+                           DecisionLatencyMetrics::elapsedNanos(started));
         return false;
     }
 
+    // Point-in-time latency histograms per decision path and per rule
+    DecisionLatencyMetrics::Snapshot latencySnapshot() {
+        return DecisionLatencyMetrics::getInstance().scrape();
+    }
+
+    // Batched drain for the review side: one call returns up to
+    // maxItems, urgent lane first
+    std::vector<Request> takeApprovalBatch(std::size_t maxItems) {
+        return approvalQueue_.takeBatch(maxItems);
+    }
+
+    std::size_t pendingApprovals() const {
+        return approvalQueue_.approximateSize();
+    }
+
+    // Invoked when a request cannot be queued because the lane is full
+    void setOverflowHandler(std::function<void(const Request&)> handler) {
+        overflowHandler_ = std::move(handler);
+    }
+
     void addAutomatedRule(std::shared_ptr<Rule> rule) {
         automatedBot_->addRule(rule);
+        decisionCache_.invalidateAll();
     }
 
     void setUserContext(const UserContext& context) {
         automatedBot_->updateContext(context);
+        decisionCache_.invalidateAll();
+    }
+
+    // Cached decisions expire after the default TTL unless the rule
+    // that produced them registered a tighter one
+    void setDecisionTtl(std::int64_t ttlMs) {
+        decisionCache_.setDefaultTtl(ttlMs);
+    }
+
+    void setDecisionTtlForRule(const std::string& ruleName, std::int64_t ttlMs) {
+        decisionCache_.setRuleTtl(ruleName, ttlMs);
     }
 
 private:
@@ -49,8 +111,20 @@ private:
     AuthorizationSystem(const AuthorizationSystem&) = delete;
     AuthorizationSystem& operator=(const AuthorizationSystem&) = delete;
 
+    static ApprovalQueue::Lane laneFor(const Request& request) {
+        switch (request.getType()) {
+            case RequestType::SECURITY_OVERRIDE:
+            case RequestType::SYSTEM_MODIFICATION:
+                return ApprovalQueue::Lane::Urgent;
+            default:
+                return ApprovalQueue::Lane::Normal;
+        }
+    }
+
     std::unique_ptr<AutomatedBot> automatedBot_;
-    std::queue<Request> approvalQueue_;
+    DecisionCache decisionCache_;
+    ApprovalQueue approvalQueue_;
+    std::function<void(const Request&)> overflowHandler_;
     std::map<std::string, Role> userRoles_;
 };
 
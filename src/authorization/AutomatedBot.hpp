@@ -1,11 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <map>
 #include <vector>
 #include <memory>
 #include "Rule.hpp"
 #include "Request.hpp"
 #include "UserContext.hpp"
 #include "DecisionHistory.hpp"
+#include "LatencyMetrics.hpp"
 
 namespace ja {
 namespace auth {
@@ -14,6 +18,7 @@ struct Decision {
     bool approved;
     std::string reason;
     std::chrono::system_clock::time_point timestamp;
+    std::string ruleName;  // empty when no rule matched
 };
 
 class AutomatedBot {
@@ -31,19 +36,27 @@ public:
             return decision;
         }
 
-        // Sort rules by priority
-        std::sort(rules_.begin(), rules_.end(),
-            [](const auto& a, const auto& b) {
-                return a->getPriority() > b->getPriority();
-            });
-
-        // Evaluate rules in priority order
-        for (const auto& rule : rules_) {
-            if (rule->evaluate(request, context_)) {
-                decision.approved = true;
-                decision.reason = "Approved by rule: " + rule->getName();
-                rule->execute(request);
-                break;
+        // Evaluate only the bucket for this request type; buckets are
+        // pre-sorted by priority when the index is compiled, so there is
+        // no per-request sort
+        auto bucket = ruleBuckets_.find(request.getType());
+        if (bucket != ruleBuckets_.end()) {
+            for (const auto& rule : bucket->second) {
+                // Every evaluation is timed per rule, so slow Rule
+                // implementations show up in the latency snapshot even
+                // when a higher-priority rule wins the decision
+                const auto ruleStart = std::chrono::steady_clock::now();
+                const bool matched = rule->evaluate(request, context_);
+                DecisionLatencyMetrics::getInstance().recordRule(
+                    rule->getName(),
+                    DecisionLatencyMetrics::elapsedNanos(ruleStart));
+                if (matched) {
+                    decision.approved = true;
+                    decision.reason = "Approved by rule: " + rule->getName();
+                    decision.ruleName = rule->getName();
+                    rule->execute(request);
+                    break;
+                }
             }
         }
 
@@ -61,15 +74,17 @@ public:
             return true;
         }
 
-        // Check if we have rules that can handle this type of request
-        return std::any_of(rules_.begin(), rules_.end(),
-            [&request](const auto& rule) {
-                return rule->canHandle(request.getType());
-            });
+        // Bloom front: one 64-bit test rejects types no rule group
+        // covers without touching the bucket map
+        if (!bloomMightHandle(request.getType())) {
+            return false;
+        }
+        return ruleBuckets_.find(request.getType()) != ruleBuckets_.end();
     }
 
     void addRule(std::shared_ptr<Rule> rule) {
         rules_.push_back(std::move(rule));
+        compileRuleIndex();
     }
 
     void updateContext(const UserContext& context) {
@@ -82,7 +97,53 @@ private:
         // Log format: timestamp | requestId | type | decision | reason
     }
 
+    // Rebuilds the type-bucketed index and its Bloom front. Called on
+    // every addRule(); rule registration is rare and request evaluation
+    // is hot, so all sorting happens here instead of per request.
+    void compileRuleIndex() {
+        ruleBuckets_.clear();
+        ruleBloom_ = 0;
+        static constexpr RequestType kAllTypes[] = {
+            RequestType::FILE_ACCESS,
+            RequestType::SYSTEM_MODIFICATION,
+            RequestType::CONFIGURATION_CHANGE,
+            RequestType::RESOURCE_ALLOCATION,
+            RequestType::SECURITY_OVERRIDE
+        };
+        for (const auto& rule : rules_) {
+            for (RequestType type : kAllTypes) {
+                if (rule->canHandle(type)) {
+                    ruleBuckets_[type].push_back(rule);
+                    ruleBloom_ |= bloomMask(type);
+                }
+            }
+        }
+        for (auto& [type, bucket] : ruleBuckets_) {
+            std::sort(bucket.begin(), bucket.end(),
+                [](const auto& a, const auto& b) {
+                    return a->getPriority() > b->getPriority();
+                });
+        }
+    }
+
+    // Two hash positions in a 64-bit filter; with a handful of request
+    // types this never false-positives in practice, and a miss skips the
+    // bucket lookup entirely
+    static std::uint64_t bloomMask(RequestType type) {
+        const std::uint64_t v = static_cast<std::uint64_t>(type);
+        const std::uint64_t h1 = (v * 0x9E3779B97F4A7C15ull) >> 58;
+        const std::uint64_t h2 = (v * 0xC2B2AE3D27D4EB4Full) >> 58;
+        return (1ull << h1) | (1ull << h2);
+    }
+
+    bool bloomMightHandle(RequestType type) const {
+        const std::uint64_t mask = bloomMask(type);
+        return (ruleBloom_ & mask) == mask;
+    }
+
     std::vector<std::shared_ptr<Rule>> rules_;
+    std::map<RequestType, std::vector<std::shared_ptr<Rule>>> ruleBuckets_;
+    std::uint64_t ruleBloom_{0};
     UserContext context_;
 };
 
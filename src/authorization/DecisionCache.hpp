@@ -0,0 +1,147 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include "Request.hpp"
+
+namespace ja {
+namespace auth {
+
+// Sharded, lock-free read-through cache for authorization decisions.
+// Requests are keyed on a canonical digest of (user, resource, action);
+// a hit is a single hash probe against fixed-size shards of atomic
+// slots, so repeat requests skip the rule pipeline entirely.
+//
+// Entries carry a TTL (per-rule overrides over a default) and an epoch
+// tag: invalidateAll() bumps the global epoch, which logically expires
+// every cached decision without touching the slots, so rule or context
+// changes take effect immediately.
+class DecisionCache {
+public:
+    static constexpr std::int64_t kDefaultTtlMs = 60 * 1000;
+
+    // Canonical digest of the fields that identify a decision: FNV-1a
+    // over user, resource and request type
+    static std::uint64_t digest(const Request& request) {
+        std::uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const std::string& s) {
+            for (unsigned char c : s) {
+                hash ^= c;
+                hash *= 1099511628211ull;
+            }
+            hash ^= 0xFF;
+            hash *= 1099511628211ull;
+        };
+        mix(request.getMetadata().userId);
+        mix(request.getMetadata().resourceId);
+        hash ^= static_cast<std::uint64_t>(request.getType());
+        hash *= 1099511628211ull;
+        // Digest 0 is reserved to mean "empty slot"
+        return hash == 0 ? 1 : hash;
+    }
+
+    // Single probe sequence: shard by low bits, then a short linear
+    // probe within the shard. Returns the cached outcome, or nothing on
+    // miss / expiry / stale epoch.
+    std::optional<bool> lookup(std::uint64_t key) const {
+        const Shard& shard = shards_[key & (kShardCount - 1)];
+        const std::uint32_t epoch = epoch_.load(std::memory_order_acquire);
+        const std::int64_t now = nowMs();
+        std::size_t slot = (key >> kShardBits) & (kSlotsPerShard - 1);
+        for (std::size_t probe = 0; probe < kMaxProbes; ++probe) {
+            const Slot& s = shard.slots[(slot + probe) & (kSlotsPerShard - 1)];
+            if (s.key.load(std::memory_order_acquire) != key) {
+                continue;
+            }
+            if (s.epoch.load(std::memory_order_relaxed) != epoch ||
+                s.expiresAtMs.load(std::memory_order_relaxed) <= now) {
+                return std::nullopt;
+            }
+            // Re-check the key so a concurrent overwrite of this slot
+            // cannot pair our payload with a different digest
+            const bool approved = s.approved.load(std::memory_order_relaxed);
+            if (s.key.load(std::memory_order_acquire) != key) {
+                return std::nullopt;
+            }
+            return approved;
+        }
+        return std::nullopt;
+    }
+
+    // Publishes a decision; the slot key is stored last with release
+    // ordering so readers never observe a half-written entry. ruleName
+    // selects a per-rule TTL when one is registered.
+    void store(std::uint64_t key, bool approved, const std::string& ruleName) {
+        Shard& shard = shards_[key & (kShardCount - 1)];
+        std::size_t base = (key >> kShardBits) & (kSlotsPerShard - 1);
+        std::size_t victim = base;
+        for (std::size_t probe = 0; probe < kMaxProbes; ++probe) {
+            const std::size_t idx = (base + probe) & (kSlotsPerShard - 1);
+            const std::uint64_t existing =
+                shard.slots[idx].key.load(std::memory_order_relaxed);
+            if (existing == key || existing == 0) {
+                victim = idx;
+                break;
+            }
+        }
+        Slot& s = shard.slots[victim];
+        s.key.store(0, std::memory_order_release);
+        s.approved.store(approved, std::memory_order_relaxed);
+        s.expiresAtMs.store(nowMs() + ttlFor(ruleName), std::memory_order_relaxed);
+        s.epoch.store(epoch_.load(std::memory_order_relaxed),
+                      std::memory_order_relaxed);
+        s.key.store(key, std::memory_order_release);
+    }
+
+    // Logically expires every entry in O(1); called when rules or the
+    // user context change
+    void invalidateAll() {
+        epoch_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    void setDefaultTtl(std::int64_t ttlMs) { defaultTtlMs_ = ttlMs; }
+
+    void setRuleTtl(const std::string& ruleName, std::int64_t ttlMs) {
+        ruleTtlsMs_[ruleName] = ttlMs;
+    }
+
+private:
+    static constexpr std::size_t kShardBits = 4;
+    static constexpr std::size_t kShardCount = 1u << kShardBits;
+    static constexpr std::size_t kSlotsPerShard = 256;
+    static constexpr std::size_t kMaxProbes = 4;
+
+    struct Slot {
+        std::atomic<std::uint64_t> key{0};
+        std::atomic<std::int64_t> expiresAtMs{0};
+        std::atomic<std::uint32_t> epoch{0};
+        std::atomic<bool> approved{false};
+    };
+
+    struct Shard {
+        std::array<Slot, kSlotsPerShard> slots;
+    };
+
+    static std::int64_t nowMs() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    std::int64_t ttlFor(const std::string& ruleName) const {
+        auto it = ruleTtlsMs_.find(ruleName);
+        return it != ruleTtlsMs_.end() ? it->second : defaultTtlMs_;
+    }
+
+    std::array<Shard, kShardCount> shards_;
+    std::atomic<std::uint32_t> epoch_{0};
+    std::int64_t defaultTtlMs_{kDefaultTtlMs};
+    std::map<std::string, std::int64_t> ruleTtlsMs_;  // rule TTLs are set at startup
+};
+
+} // namespace auth
+} // namespace ja
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 #include <map>
 #include <vector>
 #include <chrono>
@@ -20,39 +21,66 @@ struct HistoricalDecision {
 
 class DecisionHistory {
 public:
+    // Bounded record store: memory stays flat no matter how long the
+    // system runs, and aggregates are maintained incrementally so
+    // LearningRule never replays the raw records
+    static constexpr std::size_t kHistoryCapacity = 65536;
+
+    // Running per-pattern summary, updated on every recordDecision
+    struct PatternStats {
+        int totalDecisions = 0;
+        int approvals = 0;
+        std::int64_t totalLatencyUs = 0;
+    };
+
     static DecisionHistory& getInstance() {
         static DecisionHistory instance;
         return instance;
     }
 
-    void recordDecision(const Request& request, bool approved) {
+    void recordDecision(const Request& request, bool approved,
+                        std::int64_t latencyUs = 0) {
         std::unique_lock lock(mutex_);
-        
+
         // Create pattern from request
         std::string pattern = createPattern(request);
-        
-        // Record the decision
-        history_.push_back({
-            pattern,
-            approved,
-            std::chrono::system_clock::now(),
-            extractContext(request)
-        });
-
-        // Update pattern statistics
+        const std::uint32_t patternId = internPattern(pattern);
+
+        // Append into the columnar ring, overwriting the oldest record
+        // once the window is full
+        const std::size_t slot = head_;
+        head_ = (head_ + 1) % kHistoryCapacity;
+        if (count_ < kHistoryCapacity) {
+            ++count_;
+        }
+        patternIds_[slot] = patternId;
+        outcomes_[slot] = approved ? 1 : 0;
+        latenciesUs_[slot] = latencyUs;
+        timestampsMs_[slot] = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        // Update running aggregates
         auto& stats = patternStats_[pattern];
         stats.totalDecisions++;
+        stats.totalLatencyUs += latencyUs;
         if (approved) {
             stats.approvals++;
+            // Track, per request type, how many patterns have reached
+            // the consistent-approval threshold; checkSimilarPatterns
+            // then reads one counter instead of replaying the history
+            if (stats.approvals == kSimilarApprovalThreshold &&
+                stats.approvals == stats.totalDecisions) {
+                consistentPatternsByType_[typePrefix(pattern)]++;
+            }
         }
     }
 
     bool shouldAutoApprove(const Request& request) const {
         std::shared_lock lock(mutex_);
-        
+
         std::string pattern = createPattern(request);
         auto it = patternStats_.find(pattern);
-        
+
         if (it != patternStats_.end()) {
             const auto& stats = it->second;
             // Auto-approve if we have seen this pattern before and it was always approved
@@ -60,22 +88,46 @@ public:
                 return true;
             }
         }
-        
+
         // Check similar patterns
-        return checkSimilarPatterns(request);
+        return checkSimilarPatterns(pattern);
+    }
+
+    // O(1) summary lookup for the learning pipeline
+    PatternStats patternAggregate(const Request& request) const {
+        std::shared_lock lock(mutex_);
+        auto it = patternStats_.find(createPattern(request));
+        return it != patternStats_.end() ? it->second : PatternStats{};
+    }
+
+    std::size_t recordCount() const {
+        std::shared_lock lock(mutex_);
+        return count_;
     }
 
 private:
-    DecisionHistory() = default;
+    DecisionHistory()
+        : patternIds_(kHistoryCapacity, 0)
+        , outcomes_(kHistoryCapacity, 0)
+        , latenciesUs_(kHistoryCapacity, 0)
+        , timestampsMs_(kHistoryCapacity, 0) {}
 
-    struct PatternStats {
-        int totalDecisions = 0;
-        int approvals = 0;
-    };
+    static constexpr int kSimilarApprovalThreshold = 3;
+
+    std::uint32_t internPattern(const std::string& pattern) {
+        auto it = patternIdByName_.find(pattern);
+        if (it != patternIdByName_.end()) {
+            return it->second;
+        }
+        const std::uint32_t id = static_cast<std::uint32_t>(patternNames_.size());
+        patternIdByName_[pattern] = id;
+        patternNames_.push_back(pattern);
+        return id;
+    }
 
     std::string createPattern(const Request& request) const {
         std::string pattern = std::to_string(static_cast<int>(request.getType()));
-        
+
         // Add key characteristics to pattern
         for (const auto& [key, value] : request.getData()) {
             try {
@@ -84,53 +136,48 @@ private:
                 }
             } catch (...) {}
         }
-        
+
         return pattern;
     }
 
     std::map<std::string, std::string> extractContext(const Request& request) const {
         std::map<std::string, std::string> context;
         const auto& metadata = request.getMetadata();
-        
+
         context["userId"] = metadata.userId;
         context["resourceId"] = metadata.resourceId;
         for (const auto& tag : metadata.tags) {
             context["tag:" + tag] = "true";
         }
-        
+
         return context;
     }
 
-    bool checkSimilarPatterns(const Request& request) const {
-        std::string currentPattern = createPattern(request);
-        std::map<std::string, int> similarPatternApprovals;
-        
-        for (const auto& decision : history_) {
-            if (isSimilarPattern(currentPattern, decision.requestPattern)) {
-                if (decision.approved) {
-                    similarPatternApprovals[decision.requestPattern]++;
-                }
-            }
-        }
-        
-        // If we have similar patterns that were consistently approved
-        for (const auto& [pattern, approvals] : similarPatternApprovals) {
-            if (approvals >= 3) {  // Require at least 3 similar approved patterns
-                return true;
-            }
-        }
-        
-        return false;
+    static std::string typePrefix(const std::string& pattern) {
+        return pattern.substr(0, pattern.find('|'));
     }
 
-    bool isSimilarPattern(const std::string& pattern1, const std::string& pattern2) const {
-        // Simple similarity check - patterns share the same request type
-        return pattern1.substr(0, pattern1.find('|')) == pattern2.substr(0, pattern2.find('|'));
+    // Same similarity rule as before (patterns share the request type),
+    // but answered from the maintained counter instead of a full scan
+    bool checkSimilarPatterns(const std::string& pattern) const {
+        auto it = consistentPatternsByType_.find(typePrefix(pattern));
+        return it != consistentPatternsByType_.end() && it->second > 0;
     }
 
     mutable std::shared_mutex mutex_;
-    std::vector<HistoricalDecision> history_;
+
+    // Columnar ring: one array per field, indexed by slot
+    std::vector<std::uint32_t> patternIds_;
+    std::vector<std::uint8_t> outcomes_;
+    std::vector<std::int64_t> latenciesUs_;
+    std::vector<std::int64_t> timestampsMs_;
+    std::size_t head_ = 0;
+    std::size_t count_ = 0;
+
+    std::map<std::string, std::uint32_t> patternIdByName_;
+    std::vector<std::string> patternNames_;
     std::map<std::string, PatternStats> patternStats_;
+    std::map<std::string, int> consistentPatternsByType_;
 };
 
 } // namespace auth
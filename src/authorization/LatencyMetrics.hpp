@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ja {
+namespace auth {
+
+// HDR-style latency histogram: nanosecond values are bucketed by power
+// of two with 16 linear sub-buckets per power, so the relative error of
+// any reported percentile is at most ~6% while the whole histogram is a
+// fixed flat array of counters. Counters are atomics because a scrape
+// reads them while the owning thread keeps recording; the owner is the
+// only writer, so increments never contend.
+class LatencyHistogram {
+public:
+    static constexpr int kSubBits = 4;
+    static constexpr std::size_t kSubBuckets = 1ull << kSubBits;
+    static constexpr std::size_t kBucketCount = (64 - kSubBits) * kSubBuckets;
+
+    void record(std::uint64_t nanos) {
+        counts_[bucketFor(nanos)].fetch_add(1, std::memory_order_relaxed);
+        std::uint64_t seen = maxValue_.load(std::memory_order_relaxed);
+        while (nanos > seen &&
+               !maxValue_.compare_exchange_weak(seen, nanos,
+                                                std::memory_order_relaxed)) {
+        }
+    }
+
+    static std::size_t bucketFor(std::uint64_t nanos) {
+        if (nanos < kSubBuckets) {
+            return static_cast<std::size_t>(nanos);  // exact for tiny values
+        }
+        const int msb = 63 - __builtin_clzll(nanos);
+        const std::size_t group = msb - kSubBits + 1;
+        const std::size_t sub =
+            (nanos >> (msb - kSubBits)) & (kSubBuckets - 1);
+        const std::size_t index = group * kSubBuckets + sub;
+        return index < kBucketCount ? index : kBucketCount - 1;
+    }
+
+    // Midpoint of a bucket, the value percentiles are reported in
+    static std::uint64_t bucketMidpoint(std::size_t bucket) {
+        if (bucket < kSubBuckets) {
+            return bucket;
+        }
+        const int msb =
+            static_cast<int>(bucket / kSubBuckets) + kSubBits - 1;
+        const std::uint64_t sub = bucket & (kSubBuckets - 1);
+        const std::uint64_t low =
+            (1ull << msb) + (sub << (msb - kSubBits));
+        return low + (1ull << (msb - kSubBits)) / 2;
+    }
+
+    std::uint64_t countAt(std::size_t bucket) const {
+        return counts_[bucket].load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t maxValue() const {
+        return maxValue_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, kBucketCount> counts_{};
+    std::atomic<std::uint64_t> maxValue_{0};
+};
+
+// Point-in-time merge of one or more histograms, produced by a scrape;
+// plain counters, safe to copy and query off the hot path
+class HistogramSnapshot {
+public:
+    void merge(const LatencyHistogram& histogram) {
+        for (std::size_t i = 0; i < LatencyHistogram::kBucketCount; ++i) {
+            const std::uint64_t n = histogram.countAt(i);
+            counts_[i] += n;
+            total_ += n;
+        }
+        maxValue_ = std::max(maxValue_, histogram.maxValue());
+    }
+
+    std::uint64_t count() const { return total_; }
+    std::uint64_t maxValue() const { return maxValue_; }
+
+    // Latency (ns) at the given percentile, e.g. 50.0 or 99.0
+    std::uint64_t percentile(double p) const {
+        if (total_ == 0) {
+            return 0;
+        }
+        const std::uint64_t rank = static_cast<std::uint64_t>(
+            p / 100.0 * static_cast<double>(total_) + 0.5);
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank && counts_[i] > 0) {
+                return LatencyHistogram::bucketMidpoint(i);
+            }
+        }
+        return maxValue_;
+    }
+
+private:
+    std::array<std::uint64_t, LatencyHistogram::kBucketCount> counts_{};
+    std::uint64_t total_{0};
+    std::uint64_t maxValue_{0};
+};
+
+// Latency surface for authorization decisions: one histogram per
+// decision path and one per automated rule, recorded into per-thread
+// shards so the hot path is a couple of relaxed atomic increments with
+// no lock and no shared cache line between request threads. scrape()
+// merges every shard into a snapshot; the registry mutex is taken only
+// there and on first use of a thread.
+class DecisionLatencyMetrics {
+public:
+    enum class Path { CacheHit = 0, AutomatedRule = 1, ManualQueue = 2 };
+    static constexpr std::size_t kPathCount = 3;
+    static constexpr std::size_t kMaxRules = 16;
+
+    static DecisionLatencyMetrics& getInstance() {
+        static DecisionLatencyMetrics instance;
+        return instance;
+    }
+
+    static std::uint64_t elapsedNanos(
+        std::chrono::steady_clock::time_point start) {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count());
+    }
+
+    void recordPath(Path path, std::uint64_t nanos) {
+        shard().paths[static_cast<std::size_t>(path)].record(nanos);
+    }
+
+    void recordRule(const std::string& ruleName, std::uint64_t nanos) {
+        shard().ruleHistogram(ruleName).record(nanos);
+    }
+
+    struct Snapshot {
+        std::array<HistogramSnapshot, kPathCount> paths;
+        std::map<std::string, HistogramSnapshot> rules;
+
+        const HistogramSnapshot& path(Path p) const {
+            return paths[static_cast<std::size_t>(p)];
+        }
+    };
+
+    // Merges all thread shards; threads keep recording while this runs
+    Snapshot scrape() {
+        Snapshot snapshot;
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        for (const auto& shard : shards_) {
+            for (std::size_t p = 0; p < kPathCount; ++p) {
+                snapshot.paths[p].merge(shard->paths[p]);
+            }
+            const std::size_t ruleCount =
+                shard->ruleCount.load(std::memory_order_acquire);
+            for (std::size_t r = 0; r < ruleCount; ++r) {
+                snapshot.rules[shard->ruleNames[r]].merge(shard->ruleHists[r]);
+            }
+            if (shard->ruleOverflow.maxValue() > 0) {
+                snapshot.rules["<other>"].merge(shard->ruleOverflow);
+            }
+        }
+        return snapshot;
+    }
+
+private:
+    struct Shard {
+        std::array<LatencyHistogram, kPathCount> paths;
+
+        // Rule slots are append-only and published with a release store
+        // of ruleCount, so the scraper can walk them without a lock.
+        // The handful of rules beyond the fixed capacity fold into the
+        // overflow histogram rather than growing (and moving) storage.
+        std::array<std::string, kMaxRules> ruleNames;
+        std::array<LatencyHistogram, kMaxRules> ruleHists;
+        std::atomic<std::size_t> ruleCount{0};
+        LatencyHistogram ruleOverflow;
+
+        LatencyHistogram& ruleHistogram(const std::string& name) {
+            const std::size_t n = ruleCount.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < n; ++i) {
+                if (ruleNames[i] == name) {
+                    return ruleHists[i];
+                }
+            }
+            if (n == kMaxRules) {
+                return ruleOverflow;
+            }
+            ruleNames[n] = name;
+            ruleCount.store(n + 1, std::memory_order_release);
+            return ruleHists[n];
+        }
+    };
+
+    DecisionLatencyMetrics() = default;
+    DecisionLatencyMetrics(const DecisionLatencyMetrics&) = delete;
+    DecisionLatencyMetrics& operator=(const DecisionLatencyMetrics&) = delete;
+
+    // Shards outlive their threads so counts survive into later scrapes
+    Shard& shard() {
+        thread_local Shard* local = nullptr;
+        if (!local) {
+            auto owned = std::make_unique<Shard>();
+            local = owned.get();
+            std::lock_guard<std::mutex> lock(registryMutex_);
+            shards_.push_back(std::move(owned));
+        }
+        return *local;
+    }
+
+    std::mutex registryMutex_;
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace auth
+} // namespace ja
@@ -2,8 +2,11 @@
 
 #include "Rule.hpp"
 #include "DecisionHistory.hpp"
+#include <algorithm>
+#include <cstddef>
 #include <string>
 #include <map>
+#include <thread>
 #include <vector>
 
 namespace ja {
@@ -38,6 +41,75 @@ public:
         return true;
     }
 
+    // Feature columns for replay scoring, one contiguous array per
+    // feature (SoA) so the inner scoring loop streams sequentially and
+    // auto-vectorizes. All columns must have `count` entries.
+    struct FeatureBatch {
+        std::size_t count = 0;
+        std::vector<float> securityLevel;   // caller's security level
+        std::vector<float> typeRisk;        // risk weight of the request type
+        std::vector<float> approvalRate;    // historical approvals / decisions
+        std::vector<float> recency;         // 0..1, 1 = seen just now
+    };
+
+    struct ScoringWeights {
+        float securityLevel = 0.20f;
+        float typeRisk = -0.35f;
+        float approvalRate = 0.50f;
+        float recency = 0.15f;
+        float bias = 0.0f;
+    };
+
+    // Scores a whole batch in one call. The per-row work is a fixed
+    // multiply-add chain over the four columns with no branches, so the
+    // compiler vectorizes it; numThreads > 1 splits the batch into
+    // contiguous chunks for the nightly multi-million-row replays.
+    static void scoreBatch(const FeatureBatch& batch,
+                           const ScoringWeights& weights,
+                           std::vector<float>& scores,
+                           unsigned numThreads = 1) {
+        scores.resize(batch.count);
+        if (batch.count == 0) {
+            return;
+        }
+
+        auto scoreRange = [&](std::size_t begin, std::size_t end) {
+            const float* security = batch.securityLevel.data();
+            const float* risk = batch.typeRisk.data();
+            const float* approval = batch.approvalRate.data();
+            const float* recency = batch.recency.data();
+            float* out = scores.data();
+            for (std::size_t i = begin; i < end; ++i) {
+                out[i] = weights.bias
+                       + weights.securityLevel * security[i]
+                       + weights.typeRisk * risk[i]
+                       + weights.approvalRate * approval[i]
+                       + weights.recency * recency[i];
+            }
+        };
+
+        numThreads = std::max(1u, std::min<unsigned>(numThreads,
+            static_cast<unsigned>(batch.count)));
+        if (numThreads == 1) {
+            scoreRange(0, batch.count);
+            return;
+        }
+
+        const std::size_t chunk = (batch.count + numThreads - 1) / numThreads;
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < numThreads; ++t) {
+            const std::size_t begin = t * chunk;
+            const std::size_t end = std::min(begin + chunk, batch.count);
+            if (begin >= end) {
+                break;
+            }
+            workers.emplace_back(scoreRange, begin, end);
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+    }
+
 private:
     bool meetsSecurityRequirements(const Request& request, const UserContext& context) const {
         // Different security levels for different request types
@@ -1,13 +1,83 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include <pybind11/chrono.h>
 #include "automation_bot.hpp"
 
+#include <cstdint>
+
 namespace py = pybind11;
 
+namespace {
+
+// Contiguous columnar snapshot of the task list. The numeric columns
+// are exposed to Python as NumPy views over this storage (no per-task
+// conversion, no copy); string fields are materialized once as lists.
+// The batch object itself is the base of every view, so the storage
+// outlives anything Python still holds.
+struct TaskBatch {
+    std::vector<double> estimated_hours;
+    std::vector<std::int64_t> due_date_epoch_s;
+    std::vector<std::int8_t> dependency_count;
+    std::vector<std::int8_t> completed;
+    py::list ids;
+    py::list statuses;
+    py::list assignees;
+};
+
+TaskBatch snapshotTasks(const AutomationBot& bot) {
+    const auto& tasks = bot.getTasks();
+    TaskBatch batch;
+    batch.estimated_hours.reserve(tasks.size());
+    batch.due_date_epoch_s.reserve(tasks.size());
+    batch.dependency_count.reserve(tasks.size());
+    batch.completed.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        batch.estimated_hours.push_back(task.estimated_hours);
+        batch.due_date_epoch_s.push_back(
+            std::chrono::duration_cast<std::chrono::seconds>(
+                task.due_date.time_since_epoch()).count());
+        batch.dependency_count.push_back(
+            static_cast<std::int8_t>(task.dependencies.size()));
+        batch.completed.push_back(task.status == "Completed" ? 1 : 0);
+        batch.ids.append(task.id);
+        batch.statuses.append(task.status);
+        batch.assignees.append(task.assignee);
+    }
+    return batch;
+}
+
+// Builds a 1-D NumPy view over a column, with the owning batch as base
+template <typename T>
+py::array_t<T> columnView(py::object batch, const std::vector<T>& column) {
+    return py::array_t<T>({column.size()}, {sizeof(T)}, column.data(), batch);
+}
+
+} // namespace
+
 PYBIND11_MODULE(automation_bot_cpp, m) {
     m.doc() = "C++ Automation Bot for Managing Software Requirements";
 
+    py::class_<TaskBatch>(m, "TaskBatch")
+        .def_property_readonly("estimated_hours", [](py::object self) {
+            return columnView(self, self.cast<TaskBatch&>().estimated_hours);
+        })
+        .def_property_readonly("due_date_epoch_s", [](py::object self) {
+            return columnView(self, self.cast<TaskBatch&>().due_date_epoch_s);
+        })
+        .def_property_readonly("dependency_count", [](py::object self) {
+            return columnView(self, self.cast<TaskBatch&>().dependency_count);
+        })
+        .def_property_readonly("completed", [](py::object self) {
+            return columnView(self, self.cast<TaskBatch&>().completed);
+        })
+        .def_readonly("ids", &TaskBatch::ids)
+        .def_readonly("statuses", &TaskBatch::statuses)
+        .def_readonly("assignees", &TaskBatch::assignees)
+        .def("__len__", [](const TaskBatch& batch) {
+            return batch.estimated_hours.size();
+        });
+
     py::class_<AutomationBot::Task>(m, "Task")
         .def(py::init<>())
         .def_readwrite("id", &AutomationBot::Task::id)
@@ -38,5 +108,8 @@ PYBIND11_MODULE(automation_bot_cpp, m) {
         .def("add_team_member", &AutomationBot::addTeamMember)
         .def("assign_task", &AutomationBot::assignTask)
         .def("calculate_workload", &AutomationBot::calculateWorkload)
-        .def("get_project_metrics", &AutomationBot::getProjectMetrics);
+        .def("get_project_metrics", &AutomationBot::getProjectMetrics)
+        .def("snapshot_tasks", &snapshotTasks,
+             "Columnar snapshot of all tasks; numeric columns are "
+             "zero-copy NumPy views");
 }
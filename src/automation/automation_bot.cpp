@@ -1,7 +1,10 @@
 #include "automation_bot.hpp"
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <iterator>
 #include <stdexcept>
+#include <thread>
 
 AutomationBot::AutomationBot() {
     // Initialize default workflow stages
@@ -29,66 +32,150 @@ AutomationBot::AutomationBot() {
     };
 }
 
+AutomationBot::Task AutomationBot::makeTaskFromRequirement(
+    const RequirementsGenerator::Requirement& req) const {
+    Task task;
+    task.id = "TASK-" + req.id;
+    task.requirement_id = req.id;
+    task.title = req.category + ": " + req.type;
+    task.description = generateTaskDescription(req);
+    task.estimated_hours = estimateTaskDuration(req);
+    task.status = "Planning";
+    task.dependencies = req.dependencies;
+
+    // Set due date based on complexity and dependencies
+    auto now = std::chrono::system_clock::now();
+    task.due_date = now + std::chrono::hours(static_cast<int>(task.estimated_hours * 2));
+    return task;
+}
+
 std::vector<AutomationBot::Task> AutomationBot::createTasksFromRequirements(
     const std::vector<RequirementsGenerator::Requirement>& requirements) {
-    
+
     std::vector<Task> new_tasks;
     for (const auto& req : requirements) {
-        Task task;
-        task.id = "TASK-" + req.id;
-        task.requirement_id = req.id;
-        task.title = req.category + ": " + req.type;
-        task.description = generateTaskDescription(req);
-        task.estimated_hours = estimateTaskDuration(req);
-        task.status = "Planning";
-        task.dependencies = req.dependencies;
-        
-        // Set due date based on complexity and dependencies
-        auto now = std::chrono::system_clock::now();
-        task.due_date = now + std::chrono::hours(static_cast<int>(task.estimated_hours * 2));
-        
-        new_tasks.push_back(task);
+        new_tasks.push_back(makeTaskFromRequirement(req));
     }
-    
+
     tasks_.insert(tasks_.end(), new_tasks.begin(), new_tasks.end());
     prioritizeTasks();
     return new_tasks;
 }
 
-void AutomationBot::prioritizeTasks() {
-    // Clear existing queue
-    task_queue_ = std::priority_queue<Task, std::vector<Task>, TaskPriority>();
-    
-    // Add all non-completed tasks to queue
-    for (const auto& task : tasks_) {
-        if (task.status != "Completed") {
-            task_queue_.push(task);
+std::vector<AutomationBot::Task> AutomationBot::createTasksFromRequirementsParallel(
+    const std::vector<RequirementsGenerator::Requirement>& requirements,
+    unsigned num_threads,
+    ProgressCallback progress) {
+
+    const std::size_t total = requirements.size();
+    num_threads = std::max(1u, std::min<unsigned>(num_threads,
+        static_cast<unsigned>(std::max<std::size_t>(total, 1))));
+    if (num_threads == 1 || total < 2) {
+        if (progress) {
+            progress(total, total);
         }
+        return createTasksFromRequirements(requirements);
     }
+
+    // Each worker expands a contiguous chunk into its own arena; no
+    // shared state is touched until the merge, so expansion scales with
+    // cores and allocations stay thread-local
+    const std::size_t chunk = (total + num_threads - 1) / num_threads;
+    std::vector<std::vector<Task>> arenas(num_threads);
+    std::atomic<std::size_t> expanded{0};
+
+    auto worker = [&](unsigned worker_index) {
+        const std::size_t begin = worker_index * chunk;
+        const std::size_t end = std::min(begin + chunk, total);
+        auto& arena = arenas[worker_index];
+        arena.reserve(end - begin);
+        for (std::size_t i = begin; i < end; ++i) {
+            arena.push_back(makeTaskFromRequirement(requirements[i]));
+            const std::size_t done = expanded.fetch_add(1) + 1;
+            // Throttle progress reporting so the GUI is not flooded
+            if (progress && (done % 64 == 0 || done == total)) {
+                progress(done, total);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < num_threads; ++t) {
+        workers.emplace_back(worker, t);
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    // Merge in input order: IDs derive from requirement IDs, so the
+    // result is byte-for-byte identical to the serial path
+    std::vector<Task> new_tasks;
+    new_tasks.reserve(total);
+    for (auto& arena : arenas) {
+        new_tasks.insert(new_tasks.end(),
+                         std::make_move_iterator(arena.begin()),
+                         std::make_move_iterator(arena.end()));
+    }
+
+    tasks_.insert(tasks_.end(), new_tasks.begin(), new_tasks.end());
+    prioritizeTasks();
+    return new_tasks;
+}
+
+void AutomationBot::prioritizeTasks() {
+    // Full rebuild of the scheduler index; only needed after bulk
+    // ingestion — single-task changes go through updateTaskStatus
+    rebuildSchedulerIndex();
 }
 
 std::vector<AutomationBot::Task> AutomationBot::getNextTasks(int count) {
+    // The heap holds only dependency-ready tasks, so this is k pops of
+    // O(log n) each regardless of backlog size
     std::vector<Task> next_tasks;
-    while (!task_queue_.empty() && next_tasks.size() < static_cast<size_t>(count)) {
-        Task task = task_queue_.top();
-        if (checkDependencies(task)) {
-            next_tasks.push_back(task);
-        }
-        task_queue_.pop();
+    while (!ready_heap_.empty() && next_tasks.size() < static_cast<size_t>(count)) {
+        int task_index = ready_heap_.front();
+        heapRemove(task_index);
+        next_tasks.push_back(tasks_[task_index]);
     }
     return next_tasks;
 }
 
 void AutomationBot::updateTaskStatus(const std::string& task_id, const std::string& new_status) {
-    auto it = std::find_if(tasks_.begin(), tasks_.end(),
-                          [&](const Task& t) { return t.id == task_id; });
-    
-    if (it != tasks_.end()) {
-        it->status = new_status;
-        if (new_status == "Completed") {
-            updateDependentTasks(task_id);
+    auto index_it = task_index_by_id_.find(task_id);
+    if (index_it == task_index_by_id_.end()) {
+        return;
+    }
+    const int task_index = index_it->second;
+    Task& task = tasks_[task_index];
+    task.status = new_status;
+
+    if (new_status == "Completed") {
+        heapRemove(task_index);
+        updateDependentTasks(task_id);
+        // Promote dependents whose last predecessor just completed
+        auto dep_it = dependents_by_requirement_.find(task.requirement_id);
+        if (dep_it != dependents_by_requirement_.end()) {
+            for (int dependent : dep_it->second) {
+                if (tasks_[dependent].status != "Completed" &&
+                    heap_slot_[dependent] < 0 &&
+                    checkDependencies(tasks_[dependent])) {
+                    urgency_[dependent] = TaskPriority::calculatePriorityScore(tasks_[dependent]);
+                    heapInsert(dependent);
+                }
+            }
         }
-        prioritizeTasks();
+        return;
+    }
+
+    // Incremental reheapify: recompute this task's urgency and sift it
+    // to its new position in place
+    urgency_[task_index] = TaskPriority::calculatePriorityScore(task);
+    const int slot = heap_slot_[task_index];
+    if (slot >= 0) {
+        heapSiftUp(slot);
+        heapSiftDown(heap_slot_[task_index]);
+    } else if (checkDependencies(task)) {
+        heapInsert(task_index);
     }
 }
 
@@ -196,3 +283,296 @@ void AutomationBot::updateDependentTasks(const std::string& completed_task_id) {
         }
     }
 }
+
+void AutomationBot::rebuildTaskGraph() {
+    const int task_count = static_cast<int>(tasks_.size());
+    task_graph_.edges.assign(task_count, {});
+    task_graph_.reverse_edges.assign(task_count, {});
+    task_graph_.node_by_requirement.clear();
+    for (int i = 0; i < task_count; ++i) {
+        task_graph_.node_by_requirement[tasks_[i].requirement_id] = i;
+    }
+    for (int i = 0; i < task_count; ++i) {
+        for (const auto& dep_id : tasks_[i].dependencies) {
+            auto it = task_graph_.node_by_requirement.find(dep_id);
+            if (it != task_graph_.node_by_requirement.end()) {
+                task_graph_.edges[it->second].push_back(i);
+                task_graph_.reverse_edges[i].push_back(it->second);
+            }
+        }
+    }
+
+    // Kahn's algorithm for the initial topological order
+    std::vector<int> in_degree(task_count, 0);
+    for (int i = 0; i < task_count; ++i) {
+        in_degree[i] = static_cast<int>(task_graph_.reverse_edges[i].size());
+    }
+    std::vector<int> frontier;
+    for (int i = 0; i < task_count; ++i) {
+        if (in_degree[i] == 0) {
+            frontier.push_back(i);
+        }
+    }
+    task_graph_.topo_order.clear();
+    while (!frontier.empty()) {
+        const int node = frontier.back();
+        frontier.pop_back();
+        task_graph_.topo_order.push_back(node);
+        for (int dependent : task_graph_.edges[node]) {
+            if (--in_degree[dependent] == 0) {
+                frontier.push_back(dependent);
+            }
+        }
+    }
+    task_graph_.topo_position.assign(task_count, -1);
+    for (int pos = 0; pos < static_cast<int>(task_graph_.topo_order.size()); ++pos) {
+        task_graph_.topo_position[task_graph_.topo_order[pos]] = pos;
+    }
+    task_graph_.valid = static_cast<int>(task_graph_.topo_order.size()) == task_count;
+}
+
+bool AutomationBot::graphReaches(int from, int to, int max_position,
+                                 std::vector<int>& visited) const {
+    // Bounded DFS along forward edges; fills `visited` with the nodes
+    // discovered (the affected forward region of a new edge)
+    std::vector<int> stack{from};
+    visited.clear();
+    std::vector<bool> seen(tasks_.size(), false);
+    seen[from] = true;
+    while (!stack.empty()) {
+        const int node = stack.back();
+        stack.pop_back();
+        visited.push_back(node);
+        if (node == to) {
+            return true;
+        }
+        for (int next : task_graph_.edges[node]) {
+            if (!seen[next] && task_graph_.topo_position[next] <= max_position) {
+                seen[next] = true;
+                stack.push_back(next);
+            }
+        }
+    }
+    return false;
+}
+
+bool AutomationBot::addDependency(const std::string& task_id,
+                                  const std::string& depends_on_requirement_id) {
+    if (!task_graph_.valid) {
+        rebuildTaskGraph();
+    }
+    auto task_it = task_index_by_id_.find(task_id);
+    auto pred_it = task_graph_.node_by_requirement.find(depends_on_requirement_id);
+    if (task_it == task_index_by_id_.end() ||
+        pred_it == task_graph_.node_by_requirement.end()) {
+        return false;
+    }
+    const int dependent = task_it->second;
+    const int predecessor = pred_it->second;
+    if (dependent == predecessor) {
+        return false;
+    }
+
+    const int pred_pos = task_graph_.topo_position[predecessor];
+    const int dep_pos = task_graph_.topo_position[dependent];
+    if (pred_pos > dep_pos) {
+        // Edge contradicts the current order: either it closes a cycle,
+        // or only the region between the two positions needs reordering
+        std::vector<int> forward_set;
+        if (graphReaches(dependent, predecessor, pred_pos, forward_set)) {
+            return false;  // would create a cycle
+        }
+
+        // Backward region: nodes reaching the predecessor, bounded below
+        std::vector<int> backward_set;
+        {
+            std::vector<int> stack{predecessor};
+            std::vector<bool> seen(tasks_.size(), false);
+            seen[predecessor] = true;
+            while (!stack.empty()) {
+                const int node = stack.back();
+                stack.pop_back();
+                backward_set.push_back(node);
+                for (int prev : task_graph_.reverse_edges[node]) {
+                    if (!seen[prev] && task_graph_.topo_position[prev] >= dep_pos) {
+                        seen[prev] = true;
+                        stack.push_back(prev);
+                    }
+                }
+            }
+        }
+
+        // Local reorder: pool the positions of both regions and refill
+        // them with the backward region first, keeping relative order
+        auto by_position = [this](int a, int b) {
+            return task_graph_.topo_position[a] < task_graph_.topo_position[b];
+        };
+        std::sort(forward_set.begin(), forward_set.end(), by_position);
+        std::sort(backward_set.begin(), backward_set.end(), by_position);
+        std::vector<int> pool;
+        pool.reserve(forward_set.size() + backward_set.size());
+        for (int node : backward_set) pool.push_back(task_graph_.topo_position[node]);
+        for (int node : forward_set) pool.push_back(task_graph_.topo_position[node]);
+        std::sort(pool.begin(), pool.end());
+        std::size_t slot = 0;
+        for (int node : backward_set) {
+            task_graph_.topo_order[pool[slot]] = node;
+            task_graph_.topo_position[node] = pool[slot];
+            ++slot;
+        }
+        for (int node : forward_set) {
+            task_graph_.topo_order[pool[slot]] = node;
+            task_graph_.topo_position[node] = pool[slot];
+            ++slot;
+        }
+    }
+
+    task_graph_.edges[predecessor].push_back(dependent);
+    task_graph_.reverse_edges[dependent].push_back(predecessor);
+    tasks_[dependent].dependencies.push_back(depends_on_requirement_id);
+    dependents_by_requirement_[depends_on_requirement_id].push_back(dependent);
+
+    // A task waiting on an uncompleted predecessor is no longer ready
+    if (dependent < static_cast<int>(heap_slot_.size()) &&
+        heap_slot_[dependent] >= 0 && !checkDependencies(tasks_[dependent])) {
+        heapRemove(dependent);
+    }
+    return true;
+}
+
+std::vector<std::string> AutomationBot::getCriticalPath() const {
+    // Longest path by estimated hours, one DP pass over the topological
+    // order
+    if (!task_graph_.valid || task_graph_.topo_order.empty()) {
+        return {};
+    }
+    const int task_count = static_cast<int>(tasks_.size());
+    std::vector<double> cost(task_count, 0.0);
+    std::vector<int> parent(task_count, -1);
+    int best_end = -1;
+    double best_cost = -1.0;
+    for (int node : task_graph_.topo_order) {
+        cost[node] += tasks_[node].estimated_hours;
+        if (cost[node] > best_cost) {
+            best_cost = cost[node];
+            best_end = node;
+        }
+        for (int dependent : task_graph_.edges[node]) {
+            if (cost[node] > cost[dependent]) {
+                cost[dependent] = cost[node];
+                parent[dependent] = node;
+            }
+        }
+    }
+    std::vector<std::string> path;
+    for (int node = best_end; node != -1; node = parent[node]) {
+        path.push_back(tasks_[node].id);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+}
+
+std::vector<std::string> AutomationBot::getBlockedTasks() const {
+    // One pass over reverse edges: a task is blocked while any
+    // predecessor is not completed
+    std::vector<std::string> blocked;
+    if (!task_graph_.valid) {
+        return blocked;
+    }
+    for (std::size_t i = 0; i < tasks_.size(); ++i) {
+        if (tasks_[i].status == "Completed") {
+            continue;
+        }
+        for (int pred : task_graph_.reverse_edges[i]) {
+            if (tasks_[pred].status != "Completed") {
+                blocked.push_back(tasks_[i].id);
+                break;
+            }
+        }
+    }
+    return blocked;
+}
+
+void AutomationBot::rebuildSchedulerIndex() {
+    const int task_count = static_cast<int>(tasks_.size());
+    ready_heap_.clear();
+    heap_slot_.assign(task_count, -1);
+    urgency_.assign(task_count, 0.0);
+    task_index_by_id_.clear();
+    dependents_by_requirement_.clear();
+
+    for (int i = 0; i < task_count; ++i) {
+        task_index_by_id_[tasks_[i].id] = i;
+        for (const auto& dep_id : tasks_[i].dependencies) {
+            dependents_by_requirement_[dep_id].push_back(i);
+        }
+    }
+
+    for (int i = 0; i < task_count; ++i) {
+        if (tasks_[i].status != "Completed" && checkDependencies(tasks_[i])) {
+            urgency_[i] = TaskPriority::calculatePriorityScore(tasks_[i]);
+            heapInsert(i);
+        }
+    }
+}
+
+void AutomationBot::heapInsert(int task_index) {
+    heap_slot_[task_index] = static_cast<int>(ready_heap_.size());
+    ready_heap_.push_back(task_index);
+    heapSiftUp(heap_slot_[task_index]);
+}
+
+void AutomationBot::heapRemove(int task_index) {
+    const int slot = heap_slot_[task_index];
+    if (slot < 0) {
+        return;
+    }
+    const int last = static_cast<int>(ready_heap_.size()) - 1;
+    heapSwap(slot, last);
+    ready_heap_.pop_back();
+    heap_slot_[task_index] = -1;
+    if (slot <= last - 1) {
+        heapSiftUp(slot);
+        heapSiftDown(heap_slot_[ready_heap_[slot]]);
+    }
+}
+
+void AutomationBot::heapSiftUp(int slot) {
+    while (slot > 0) {
+        const int parent = (slot - 1) / 2;
+        if (urgency_[ready_heap_[parent]] >= urgency_[ready_heap_[slot]]) {
+            break;
+        }
+        heapSwap(slot, parent);
+        slot = parent;
+    }
+}
+
+void AutomationBot::heapSiftDown(int slot) {
+    const int size = static_cast<int>(ready_heap_.size());
+    for (;;) {
+        int largest = slot;
+        const int left = 2 * slot + 1;
+        const int right = 2 * slot + 2;
+        if (left < size && urgency_[ready_heap_[left]] > urgency_[ready_heap_[largest]]) {
+            largest = left;
+        }
+        if (right < size && urgency_[ready_heap_[right]] > urgency_[ready_heap_[largest]]) {
+            largest = right;
+        }
+        if (largest == slot) {
+            return;
+        }
+        heapSwap(slot, largest);
+        slot = largest;
+    }
+}
+
+void AutomationBot::heapSwap(int slot_a, int slot_b) {
+    if (slot_a == slot_b) {
+        return;
+    }
+    std::swap(ready_heap_[slot_a], ready_heap_[slot_b]);
+    heap_slot_[ready_heap_[slot_a]] = slot_a;
+    heap_slot_[ready_heap_[slot_b]] = slot_b;
+}
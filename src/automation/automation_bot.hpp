@@ -34,9 +34,21 @@ public:
     // Task Management
     std::vector<Task> createTasksFromRequirements(
         const std::vector<RequirementsGenerator::Requirement>& requirements);
+
+    // Parallel expansion for large baselines: requirements are split
+    // into contiguous chunks, each worker builds tasks into its own
+    // arena, and the arenas are merged in input order so task IDs and
+    // ordering match the serial path exactly. The progress callback is
+    // invoked from worker threads with (expanded, total).
+    using ProgressCallback = std::function<void(std::size_t, std::size_t)>;
+    std::vector<Task> createTasksFromRequirementsParallel(
+        const std::vector<RequirementsGenerator::Requirement>& requirements,
+        unsigned num_threads,
+        ProgressCallback progress = nullptr);
     void prioritizeTasks();
     std::vector<Task> getNextTasks(int count);
     void updateTaskStatus(const std::string& task_id, const std::string& new_status);
+    const std::vector<Task>& getTasks() const { return tasks_; }
     
     // Workflow Management
     void addWorkflowStage(const WorkflowStage& stage);
@@ -48,6 +60,17 @@ public:
     void assignTask(const std::string& task_id, const std::string& assignee);
     double calculateWorkload(const std::string& team_member) const;
 
+    // Dependency Graph
+    // Dependencies are materialized into an integer-ID DAG (node =
+    // index into tasks_) with forward and reverse edges and a
+    // maintained topological order, so dependency-aware queries never
+    // re-resolve string IDs against the backlog.
+    void rebuildTaskGraph();
+    bool addDependency(const std::string& task_id,
+                       const std::string& depends_on_requirement_id);
+    std::vector<std::string> getCriticalPath() const;
+    std::vector<std::string> getBlockedTasks() const;
+
     // Analytics
     struct ProjectMetrics {
         double completion_rate;
@@ -79,7 +102,30 @@ private:
     std::vector<Task> tasks_;
     std::vector<WorkflowStage> workflow_;
     std::unordered_map<std::string, std::vector<std::string>> team_skills_;
-    std::priority_queue<Task, std::vector<Task>, TaskPriority> task_queue_;
+
+    // Indexed scheduler: ready tasks live in a binary max-heap keyed on
+    // cached urgency, with a slot map so one task's score change is an
+    // O(log n) sift instead of a full re-sort. Tasks enter the heap only
+    // once every dependency is completed; reverse edges let a completed
+    // task promote its dependents without scanning the backlog.
+    std::vector<int> ready_heap_;                 // task indices, max-heap on urgency
+    std::vector<int> heap_slot_;                  // task index -> heap slot, -1 if absent
+    std::vector<double> urgency_;                 // cached priority scores
+    std::unordered_map<std::string, int> task_index_by_id_;
+    std::unordered_map<std::string, std::vector<int>> dependents_by_requirement_;
+
+    // Materialized dependency DAG over task indices. topo_position is
+    // the inverse of topo_order; addDependency keeps both valid with a
+    // local reorder of the affected region instead of a full rebuild.
+    struct TaskGraph {
+        std::vector<std::vector<int>> edges;          // predecessor -> dependents
+        std::vector<std::vector<int>> reverse_edges;  // dependent -> predecessors
+        std::vector<int> topo_order;
+        std::vector<int> topo_position;
+        std::unordered_map<std::string, int> node_by_requirement;
+        bool valid = false;
+    };
+    TaskGraph task_graph_;
     
     // Performance tracking
     double task_completion_rate_;
@@ -134,8 +180,21 @@ private:
     };
 
     // Helper functions
+    Task makeTaskFromRequirement(const RequirementsGenerator::Requirement& req) const;
     bool checkDependencies(const Task& task) const;
     double estimateTaskDuration(const RequirementsGenerator::Requirement& req) const;
     std::string generateTaskDescription(const RequirementsGenerator::Requirement& req) const;
     void updateDependentTasks(const std::string& completed_task_id);
+
+    // Dependency graph maintenance
+    bool graphReaches(int from, int to, int max_position,
+                      std::vector<int>& visited) const;
+
+    // Scheduler index maintenance
+    void rebuildSchedulerIndex();
+    void heapInsert(int task_index);
+    void heapRemove(int task_index);
+    void heapSiftUp(int slot);
+    void heapSiftDown(int slot);
+    void heapSwap(int slot_a, int slot_b);
 };
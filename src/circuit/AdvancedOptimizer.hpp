@@ -5,6 +5,7 @@
 #include <random>
 #include <algorithm>
 #include <cmath>
+#include <thread>
 
 namespace circuit {
 
@@ -72,6 +73,125 @@ public:
         auto best_it = std::max_element(fitness.begin(), fitness.end());
         return population[std::distance(fitness.begin(), best_it)];
     }
+
+    // Island-model evolution: each island evolves an independent
+    // subpopulation on its own thread, so fitness evaluations (each a full
+    // circuit analysis) run in parallel. Every migration_interval
+    // generations the islands synchronize and the best individual of each
+    // island replaces the worst of the next island ring-wise. The
+    // measurement function must be safe to call from multiple threads.
+    std::vector<Parameter> optimizeIslands(
+        int islands = 4,
+        int island_population = 25,
+        int generations = 100,
+        double F = 0.8,
+        double CR = 0.9,
+        int migration_interval = 10) {
+
+        struct Island {
+            std::vector<std::vector<Parameter>> population;
+            std::vector<double> fitness;
+        };
+
+        std::vector<Island> pops(islands);
+        std::random_device seeder;
+
+        auto evolve = [this, island_population, F, CR](
+            Island& island, int gens, unsigned seed) {
+            std::mt19937 rng(seed);
+            std::uniform_real_distribution<double> real01(0.0, 1.0);
+            std::uniform_int_distribution<int> pick(0, island_population - 1);
+            std::uniform_int_distribution<int> pick_param(
+                0, static_cast<int>(parameters_.size()) - 1);
+
+            // Lazily evaluate initial fitness inside the worker so the
+            // first generation's evaluations are already parallel
+            while (island.population.size() <
+                   static_cast<size_t>(island_population)) {
+                island.population.push_back(generateRandomIndividual());
+                island.fitness.push_back(evaluateFitness(island.population.back()));
+            }
+
+            for (int gen = 0; gen < gens; gen++) {
+                for (int i = 0; i < island_population; i++) {
+                    int r1, r2, r3;
+                    do {
+                        r1 = pick(rng);
+                        r2 = pick(rng);
+                        r3 = pick(rng);
+                    } while (r1 == r2 || r2 == r3 || r1 == r3 ||
+                             r1 == i || r2 == i || r3 == i);
+
+                    std::vector<Parameter> trial = island.population[i];
+                    int R = pick_param(rng);
+
+                    for (size_t j = 0; j < parameters_.size(); j++) {
+                        if (real01(rng) < CR || static_cast<int>(j) == R) {
+                            trial[j].current_value =
+                                island.population[r1][j].current_value +
+                                F * (island.population[r2][j].current_value -
+                                     island.population[r3][j].current_value);
+                            trial[j].current_value = std::clamp(
+                                trial[j].current_value,
+                                trial[j].min_value,
+                                trial[j].max_value);
+                        }
+                    }
+
+                    double trial_fitness = evaluateFitness(trial);
+                    if (trial_fitness > island.fitness[i]) {
+                        island.population[i] = trial;
+                        island.fitness[i] = trial_fitness;
+                    }
+                }
+            }
+        };
+
+        int done = 0;
+        while (done < generations) {
+            int gens = std::min(migration_interval, generations - done);
+
+            std::vector<std::thread> threads;
+            for (int k = 0; k < islands; k++) {
+                threads.emplace_back(evolve, std::ref(pops[k]), gens, seeder());
+            }
+            for (auto& t : threads) {
+                t.join();
+            }
+            done += gens;
+
+            // Ring migration: best of island k replaces worst of island k+1
+            for (int k = 0; k < islands; k++) {
+                Island& src = pops[k];
+                Island& dst = pops[(k + 1) % islands];
+
+                auto best_it = std::max_element(src.fitness.begin(),
+                                                src.fitness.end());
+                auto worst_it = std::min_element(dst.fitness.begin(),
+                                                 dst.fitness.end());
+                size_t best = std::distance(src.fitness.begin(), best_it);
+                size_t worst = std::distance(dst.fitness.begin(), worst_it);
+
+                if (src.fitness[best] > dst.fitness[worst]) {
+                    dst.population[worst] = src.population[best];
+                    dst.fitness[worst] = src.fitness[best];
+                }
+            }
+        }
+
+        // Return the global best across all islands
+        std::vector<Parameter> best_solution;
+        double best_fitness = -std::numeric_limits<double>::infinity();
+        for (const auto& island : pops) {
+            for (size_t i = 0; i < island.population.size(); i++) {
+                if (island.fitness[i] > best_fitness) {
+                    best_fitness = island.fitness[i];
+                    best_solution = island.population[i];
+                }
+            }
+        }
+        return best_solution;
+    }
 };
 
 class SimulatedAnnealing : public RFOptimizer {
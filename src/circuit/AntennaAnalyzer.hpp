@@ -1,6 +1,11 @@
 #pragma once
 
 #include "EMSolver.hpp"
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <utility>
 #include <vector>
 #include <complex>
 #include <memory>
@@ -69,45 +74,128 @@ public:
         return pattern;
     }
 
+    // Flat-array pattern for the parallel engine: gain/phase stored
+    // row-major as [theta_index * phi_count + phi_index], preallocated
+    // once so worker threads write disjoint ranges with no locking
+    struct FlatRadiationPattern {
+        std::vector<double> theta;
+        std::vector<double> phi;
+        std::vector<double> gain;
+        std::vector<double> phase;
+
+        double gainAt(size_t i, size_t j) const { return gain[i * phi.size() + j]; }
+        double phaseAt(size_t i, size_t j) const { return phase[i * phi.size() + j]; }
+    };
+
+    // Parallel pattern engine: the near-field solution is computed once
+    // up front, then the theta rows are tiled across threads and each
+    // tile evaluates the far-field math over its rows into the flat
+    // arrays. Every grid point is independent, so a 1°-resolution
+    // sphere scales linearly with cores.
+    FlatRadiationPattern calculateRadiationPatternParallel(
+        double theta_start = 0,
+        double theta_end = 180,
+        double theta_step = 1,
+        double phi_start = 0,
+        double phi_end = 360,
+        double phi_step = 1,
+        unsigned num_threads = std::thread::hardware_concurrency()) {
+
+        FlatRadiationPattern pattern;
+        for (double theta = theta_start; theta <= theta_end; theta += theta_step) {
+            pattern.theta.push_back(theta);
+        }
+        for (double phi = phi_start; phi <= phi_end; phi += phi_step) {
+            pattern.phi.push_back(phi);
+        }
+        const size_t rows = pattern.theta.size();
+        const size_t cols = pattern.phi.size();
+        pattern.gain.resize(rows * cols);
+        pattern.phase.resize(rows * cols);
+        if (rows == 0 || cols == 0) {
+            return pattern;
+        }
+
+        // One solve for the whole grid; workers evaluate against this
+        // snapshot without touching the solver
+        solver_.solve();
+        const std::vector<EMField> near_fields = solver_.getFields();
+
+        num_threads = std::max<unsigned>(1, std::min<unsigned>(
+            num_threads, static_cast<unsigned>(rows)));
+        std::atomic<size_t> next_row{0};
+
+        auto worker = [&]() {
+            for (;;) {
+                const size_t i = next_row.fetch_add(1);
+                if (i >= rows) {
+                    return;
+                }
+                double* gain_row = pattern.gain.data() + i * cols;
+                double* phase_row = pattern.phase.data() + i * cols;
+                const double theta = pattern.theta[i];
+                const double sin_theta = std::sin(theta);
+                const double cos_theta = std::cos(theta);
+                // Contiguous inner loop over phi: the trig and the
+                // far-field accumulation vectorize per row
+                for (size_t j = 0; j < cols; j++) {
+                    const double phi = pattern.phi[j];
+                    auto field = farFieldFromSnapshot(
+                        near_fields,
+                        {sin_theta * std::cos(phi), sin_theta * std::sin(phi), cos_theta});
+                    gain_row[j] = calculateGain(field);
+                    phase_row[j] = calculatePhase(field);
+                }
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < num_threads; t++) {
+            workers.emplace_back(worker);
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+        return pattern;
+    }
+
     AntennaParameters analyzeAntenna() {
         AntennaParameters params;
-        
+
         // Calculate input impedance
         params.input_impedance = calculateInputImpedance();
-        
+
         // Calculate VSWR
         params.vswr = calculateVSWR(params.input_impedance);
-        
-        // Calculate radiation pattern
-        auto pattern = calculateRadiationPattern();
-        
-        // Find maximum gain and its direction
-        findMaximumGain(pattern, params);
-        
-        // Calculate directivity
-        params.directivity = calculateDirectivity(pattern);
-        
+
+        // One pattern for the whole characterization: cached per
+        // (geometry, frequency), and all grid-derived parameters come
+        // from a single pass over it
+        auto pattern = cachedPattern(current_frequency_);
+        analyzePatternGrid(*pattern, params);
+
         // Calculate efficiency
         params.efficiency = calculateEfficiency();
-        
+
         // Calculate gain
         params.gain = params.directivity * params.efficiency;
-        
+
         // Calculate bandwidth
         params.bandwidth = calculateBandwidth();
-        
-        // Calculate beamwidth
-        params.beamwidth = calculateBeamwidth(pattern);
-        
-        // Calculate front-to-back ratio
-        params.front_to_back = calculateFrontToBack(pattern);
-        
+
         // Calculate polarization
         params.polarization = calculatePolarization();
-        
+
         return params;
     }
 
+    // Invalidate cached patterns after the antenna geometry changes;
+    // frequency changes are part of the cache key and need no flush
+    void invalidateGeometry() {
+        geometry_revision_++;
+        pattern_cache_.clear();
+    }
+
     std::vector<double> calculateSParameters(
         const std::vector<double>& frequencies) {
         std::vector<double> s_params;
@@ -124,17 +212,100 @@ public:
     }
 
     double calculateGainAtFrequency(double frequency) {
-        solver_.setFrequency(frequency);
-        solver_.solve();
-        
-        auto pattern = calculateRadiationPattern();
+        // Reuses the pattern computed by analyzeAntenna (or an earlier
+        // call at this frequency) instead of recomputing the sphere
+        auto pattern = cachedPattern(frequency);
         AntennaParameters params;
-        findMaximumGain(pattern, params);
-        
+        findMaximumGain(*pattern, params);
+
         return params.gain;
     }
 
 private:
+    // Full-sphere pattern memoized on (geometry revision, frequency).
+    // analyzeAntenna and calculateGainAtFrequency both go through here,
+    // so one characterization computes each pattern exactly once.
+    std::shared_ptr<const RadiationPattern> cachedPattern(double frequency) {
+        const auto key = std::make_pair(geometry_revision_, frequency);
+        auto it = pattern_cache_.find(key);
+        if (it != pattern_cache_.end()) {
+            return it->second;
+        }
+        solver_.setFrequency(frequency);
+        solver_.solve();
+        current_frequency_ = frequency;
+        auto pattern = std::make_shared<RadiationPattern>(calculateRadiationPattern());
+        pattern_cache_[key] = pattern;
+        return pattern;
+    }
+
+    // Single pass over the cached grid: maximum gain and its direction,
+    // directivity, -3dB beamwidth and front-to-back ratio together,
+    // instead of one traversal per parameter
+    void analyzePatternGrid(const RadiationPattern& pattern,
+                            AntennaParameters& params) {
+        double max_gain = -std::numeric_limits<double>::infinity();
+        size_t max_i = 0, max_j = 0;
+        double total_power = 0.0;
+
+        for (size_t i = 0; i < pattern.theta.size(); i++) {
+            for (size_t j = 0; j < pattern.phi.size(); j++) {
+                const double gain = pattern.gain[i][j];
+                total_power += std::pow(10, gain / 10);
+                if (gain > max_gain) {
+                    max_gain = gain;
+                    max_i = i;
+                    max_j = j;
+                }
+            }
+        }
+
+        params.gain = max_gain;
+        params.main_beam = {
+            std::sin(pattern.theta[max_i]) * std::cos(pattern.phi[max_j]),
+            std::sin(pattern.theta[max_i]) * std::sin(pattern.phi[max_j]),
+            std::cos(pattern.theta[max_i])
+        };
+        const double max_power = std::pow(10, max_gain / 10);
+        params.directivity = 10 * std::log10(4 * M_PI * max_power / total_power);
+
+        // -3dB width along the theta cut through the beam peak
+        const double threshold = max_gain - 3.0;
+        size_t low = max_i, high = max_i;
+        while (low > 0 && pattern.gain[low - 1][max_j] >= threshold) {
+            low--;
+        }
+        while (high + 1 < pattern.theta.size() &&
+               pattern.gain[high + 1][max_j] >= threshold) {
+            high++;
+        }
+        params.beamwidth = pattern.theta[high] - pattern.theta[low];
+
+        params.front_to_back = calculateFrontToBack(pattern);
+    }
+
+    std::map<std::pair<std::uint64_t, double>,
+             std::shared_ptr<const RadiationPattern>> pattern_cache_;
+    std::uint64_t geometry_revision_ = 0;
+    double current_frequency_ = 0.0;
+
+    // Pure far-field evaluation against a precomputed near-field
+    // snapshot; safe to call concurrently from the pattern workers
+    static EMField farFieldFromSnapshot(const std::vector<EMField>& near_fields,
+                                        const Point3D& direction) {
+        Vector3D e_field = {0, 0, 0};
+        Vector3D h_field = {0, 0, 0};
+
+        // This is a simplified version - actual implementation would use
+        // proper far-field transformation
+        for (const auto& near_field : near_fields) {
+            // Add contribution from each near-field point
+            // using radiation integrals
+        }
+
+        return EMField(direction, e_field, h_field);
+    }
+
     EMField calculateFarField(double theta, double phi) {
         // Convert spherical to Cartesian coordinates
         double x = std::sin(theta) * std::cos(phi);
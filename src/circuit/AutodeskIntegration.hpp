@@ -6,6 +6,7 @@
 #include <optional>
 #include <curl/curl.h>
 #include <nlohmann/json.hpp>
+#include "DesignSync.hpp"
 #include "SecurityManager.hpp"
 
 namespace circuit {
@@ -266,6 +267,27 @@ public:
         }
     }
 
+    // Differential sync: hashes the design at component granularity
+    // and uploads only changed subtrees (see DesignSyncEngine). Each
+    // changed component is PUT as its own object in the bucket, with
+    // bounded parallelism across independent uploads.
+    DesignSyncEngine::SyncReport syncDesign(
+        const DesignSyncEngine::DesignComponent& root,
+        const std::string& bucket_key,
+        unsigned max_concurrency = 4) {
+        if (!isAuthenticated()) {
+            if (!authenticate()) return {};
+        }
+        if (!createBucket(bucket_key)) return {};
+        return design_sync_.sync(root,
+            [this, &bucket_key](const DesignSyncEngine::DesignComponent& component) {
+                return uploadComponentPayload(bucket_key, component);
+            },
+            max_concurrency);
+    }
+
+    DesignSyncEngine& designSync() { return design_sync_; }
+
     // Viewer Configuration
     ViewerConfig getViewerConfig(const std::string& document_urn) {
         return ViewerConfig{
@@ -339,6 +361,7 @@ private:
     int expires_in_;
     std::string last_error_;
     std::chrono::system_clock::time_point token_timestamp_;
+    DesignSyncEngine design_sync_;
 
     bool isAuthenticated() const {
         return !access_token_.empty();
@@ -365,6 +388,46 @@ private:
             std::max(0, expires_in_ - static_cast<int>(elapsed)));
     }
 
+    // PUTs one component's serialized payload as bucket_key/<id>
+    bool uploadComponentPayload(const std::string& bucket_key,
+                                const DesignSyncEngine::DesignComponent& component) {
+        try {
+            CURL* curl = curl_easy_init();
+            if (!curl) return false;
+
+            std::string upload_url =
+                "https://developer.api.autodesk.com/oss/v2/buckets/" +
+                bucket_key + "/objects/" + component.id;
+
+            struct curl_slist* headers = nullptr;
+            headers = curl_slist_append(headers,
+                ("Authorization: Bearer " + access_token_).c_str());
+            headers = curl_slist_append(headers,
+                "Content-Type: application/octet-stream");
+
+            curl_easy_setopt(curl, CURLOPT_URL, upload_url.c_str());
+            curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+            curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, "PUT");
+            curl_easy_setopt(curl, CURLOPT_POSTFIELDS, component.payload.data());
+            curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE,
+                             static_cast<long>(component.payload.size()));
+
+            std::string response;
+            curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteCallback);
+            curl_easy_setopt(curl, CURLOPT_WRITEDATA, &response);
+
+            CURLcode res = curl_easy_perform(curl);
+
+            curl_slist_free_all(headers);
+            curl_easy_cleanup(curl);
+
+            return res == CURLE_OK;
+        }
+        catch (const std::exception& e) {
+            return false;
+        }
+    }
+
     bool createBucket(const std::string& bucket_key) {
         try {
             CURL* curl = curl_easy_init();
@@ -2,10 +2,17 @@
 
 #include "Component.hpp"
 #include "BasicComponents.hpp"
+#include "ComponentBatch.hpp"
 #include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <Eigen/SparseLU>
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <cmath>
 
 namespace circuit {
 
@@ -15,7 +22,9 @@ public:
 
     void addComponent(std::shared_ptr<Component> component) {
         components_.push_back(component);
-        
+        batches_valid_ = false;
+        frozen_ = false;
+
         // Add nodes if they don't exist
         for (const auto& pin : component->getPins()) {
             if (pin->getNode() == nullptr) {
@@ -32,11 +41,68 @@ public:
 
     void analyze(double frequency = 0.0) {
         current_frequency_ = frequency;
-        buildMNA();
-        solve();
+        if (frozen_) {
+            refreshFrozen();
+            solveFrozen();
+        } else {
+            buildMNA();
+            solve();
+        }
         updateComponents();
     }
 
+    // Freeze the netlist topology for repeated evaluations that change
+    // only element values (the RFOptimizer fitness loop). Node numbering,
+    // the sparse matrix pattern and the storage slot of every stamp
+    // location are captured once; analyze() then writes fresh admittances
+    // straight into the prepared value array and refactorizes on the
+    // fixed pattern, skipping the per-candidate triplet build, sort and
+    // compression. addComponent() unfreezes automatically.
+    void freezeTopology() {
+        ensureBatches();
+        batches_.refreshValues();
+
+        // Cache node numbering for O(1) lookups while frozen
+        node_index_map_.clear();
+        for (size_t i = 0; i < nodes_.size(); i++) {
+            node_index_map_[nodes_[i].get()] = (nodes_[i] == ground_node_) ? -1
+                                                : static_cast<int>(i);
+        }
+
+        // Cache node indices of the heterogeneous components once
+        frozen_generals_.clear();
+        for (const auto& component : general_components_) {
+            auto pins = component->getPins();
+            frozen_generals_.push_back({component.get(),
+                                        getNodeIndex(pins[0]->getNode()),
+                                        getNodeIndex(pins[1]->getNode())});
+        }
+
+        // Establish the matrix structure once
+        buildMNA();
+        frozen_ = true;
+        if (!use_sparse_) {
+            return;  // Dense refresh writes coefficients in place
+        }
+
+        // Map every (row, col) stamp location to its slot in the
+        // compressed value array, and symbolically factorize the fixed
+        // pattern so per-candidate solves only run the numeric phase
+        A_sparse_.makeCompressed();
+        stamp_slots_.clear();
+        const int outer = A_sparse_.outerSize();
+        for (int k = 0; k < outer; k++) {
+            for (Eigen::SparseMatrix<Complex>::InnerIterator it(A_sparse_, k);
+                 it; ++it) {
+                stamp_slots_[slotKey(it.row(), it.col())] =
+                    static_cast<int>(&it.value() - A_sparse_.valuePtr());
+            }
+        }
+        sparse_lu_.analyzePattern(A_sparse_);
+    }
+
+    bool isTopologyFrozen() const { return frozen_; }
+
     void performTransient(double stop_time, double timestep) {
         double t = 0.0;
         while (t < stop_time) {
@@ -49,6 +115,57 @@ public:
         }
     }
 
+    // Incremental transient engine: the MNA matrix is built and factorized
+    // once, each timestep only refreshes the right-hand side and reuses the
+    // cached factorization, and the matrix is re-stamped only when the
+    // solution moves enough to indicate a nonlinear component changed its
+    // operating point. A simple controller grows the timestep while the
+    // solution is smooth and shrinks it again after a re-stamp.
+    void performTransientIncremental(double stop_time,
+                                     double initial_timestep,
+                                     double smooth_tolerance = 1e-6,
+                                     double restamp_tolerance = 1e-3,
+                                     double max_timestep = 0.0) {
+        if (max_timestep <= 0.0) {
+            max_timestep = initial_timestep * 64.0;
+        }
+
+        current_frequency_ = 0.0;
+        buildMNA();
+        factorize();
+
+        double t = 0.0;
+        double dt = initial_timestep;
+        Eigen::VectorXcd previous = Eigen::VectorXcd::Zero(b_.size());
+
+        while (t < stop_time) {
+            rebuildRHS();
+            Eigen::VectorXcd x = solveCached();
+            applySolution(x);
+
+            timestep_ = dt;
+            for (auto& component : components_) {
+                component->updateState(dt);
+            }
+
+            double reference = std::max(previous.norm(), 1.0);
+            double delta = (x - previous).norm() / reference;
+            if (delta > restamp_tolerance) {
+                // Operating point moved: re-stamp and refactorize, and back
+                // off the timestep until the solution settles again
+                buildMNA();
+                factorize();
+                dt = std::max(dt * 0.5, initial_timestep);
+            } else if (delta < smooth_tolerance) {
+                dt = std::min(dt * 1.5, max_timestep);
+            }
+
+            previous = x;
+            t += dt;
+            time_ = t;
+        }
+    }
+
     void performAC(double start_freq, double stop_freq, int points) {
         std::vector<double> frequencies;
         double log_start = std::log10(start_freq);
@@ -66,6 +183,76 @@ public:
         }
     }
 
+    // Parallel AC sweep: frequency points are independent solves, so they
+    // are pulled from a shared counter by worker threads, each assembling
+    // into its own matrix workspace. Results are merged into the frequency
+    // response map in frequency order once all workers finish; node state
+    // is left at the last sequential analyze() and not touched here.
+    void performACParallel(double start_freq, double stop_freq, int points,
+                           unsigned num_threads = std::thread::hardware_concurrency()) {
+        std::vector<double> frequencies;
+        double log_start = std::log10(start_freq);
+        double log_stop = std::log10(stop_freq);
+        double step = (log_stop - log_start) / (points - 1);
+        for (int i = 0; i < points; i++) {
+            frequencies.push_back(std::pow(10, log_start + i * step));
+        }
+
+        // Compile and refresh the homogeneous batches up front; workers
+        // only read them
+        ensureBatches();
+        batches_.refreshValues();
+
+        std::vector<std::vector<Complex>> results(frequencies.size());
+        std::atomic<size_t> next{0};
+
+        auto worker = [&]() {
+            std::vector<Eigen::Triplet<Complex>> triplets;
+            Eigen::VectorXcd b;
+            int size = 0;
+            size_t i;
+            while ((i = next.fetch_add(1)) < frequencies.size()) {
+                assembleSystem(frequencies[i], size, triplets, b);
+
+                Eigen::VectorXcd x;
+                if (size >= kSparseThreshold) {
+                    Eigen::SparseMatrix<Complex> A(size, size);
+                    A.setFromTriplets(triplets.begin(), triplets.end());
+                    Eigen::SparseLU<Eigen::SparseMatrix<Complex>> solver;
+                    solver.compute(A);
+                    x = solver.solve(b);
+                } else {
+                    Eigen::MatrixXcd A = Eigen::MatrixXcd::Zero(size, size);
+                    for (const auto& t : triplets) {
+                        A(t.row(), t.col()) += t.value();
+                    }
+                    x = A.colPivHouseholderQr().solve(b);
+                }
+
+                std::vector<Complex> voltages;
+                voltages.reserve(nodes_.size());
+                for (const auto& node : nodes_) {
+                    int idx = getNodeIndex(node);
+                    voltages.push_back(idx >= 0 ? x(idx) : Complex(0.0));
+                }
+                results[i] = std::move(voltages);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        unsigned count = std::max(1u, num_threads);
+        for (unsigned t = 0; t < count; t++) {
+            threads.emplace_back(worker);
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        for (size_t i = 0; i < frequencies.size(); i++) {
+            frequency_response_[frequencies[i]] = std::move(results[i]);
+        }
+    }
+
     std::map<double, std::vector<Complex>> getFrequencyResponse() const {
         return frequency_response_;
     }
@@ -79,62 +266,199 @@ public:
     }
 
 private:
+    // Dense MNA storage is quadratic in system size; above this many
+    // unknowns the analyzer switches to a sparse matrix and SparseLU,
+    // which keeps 50k-node netlists in RAM and solves them in seconds.
+    static constexpr int kSparseThreshold = 512;
+
     void buildMNA() {
         int n = nodes_.size() - 1;  // Exclude ground node
         int m = voltage_sources_.size();
         int size = n + m;
 
+        use_sparse_ = size >= kSparseThreshold;
+
         // Initialize matrices
-        A_ = Eigen::MatrixXcd::Zero(size, size);
+        std::vector<Eigen::Triplet<Complex>> triplets;
+        if (use_sparse_) {
+            triplets.reserve(components_.size() * 4 + voltage_sources_.size() * 4);
+        } else {
+            A_ = Eigen::MatrixXcd::Zero(size, size);
+        }
         b_ = Eigen::VectorXcd::Zero(size);
 
-        // Build conductance matrix (G)
-        for (const auto& component : components_) {
+        auto stamp = [&](int row, int col, const Complex& value) {
+            if (use_sparse_) {
+                triplets.emplace_back(row, col, value);
+            } else {
+                A_(row, col) += value;
+            }
+        };
+
+        // Build conductance matrix (G): built-in two-terminal types go
+        // through their homogeneous batches (contiguous values, cached
+        // node indices, compile-time admittance), everything else stays
+        // on the virtual path
+        ensureBatches();
+        batches_.refreshValues();
+        batches_.stampInto(current_frequency_, stamp);
+        for (const auto& component : general_components_) {
+            auto z = component->getImpedance(current_frequency_);
+            auto y = Complex(1.0) / z;
+
+            auto pins = component->getPins();
+            int n1 = getNodeIndex(pins[0]->getNode());
+            int n2 = getNodeIndex(pins[1]->getNode());
+
+            if (n1 >= 0) {
+                stamp(n1, n1, y);
+                if (n2 >= 0) stamp(n1, n2, -y);
+            }
+            if (n2 >= 0) {
+                stamp(n2, n2, y);
+                if (n1 >= 0) stamp(n2, n1, -y);
+            }
+        }
+
+        // Add voltage sources
+        int vsi = n;
+        for (const auto& vs : voltage_sources_) {
+            auto pins = vs->getPins();
+            int n1 = getNodeIndex(pins[0]->getNode());
+            int n2 = getNodeIndex(pins[1]->getNode());
+
+            // Add current variables
+            if (n1 >= 0) {
+                stamp(n1, vsi, Complex(1.0));
+                stamp(vsi, n1, Complex(1.0));
+            }
+            if (n2 >= 0) {
+                stamp(n2, vsi, Complex(-1.0));
+                stamp(vsi, n2, Complex(-1.0));
+            }
+
+            // Add voltage constraint
+            b_(vsi) = vs->getVoltageAcross();
+            vsi++;
+        }
+
+        if (use_sparse_) {
+            A_sparse_.resize(size, size);
+            A_sparse_.setFromTriplets(triplets.begin(), triplets.end());
+            A_sparse_.makeCompressed();
+        }
+    }
+
+    // Assemble the MNA system for one frequency into caller-owned storage
+    // without touching analyzer state, so sweep workers can run in parallel
+    void assembleSystem(double frequency, int& size,
+                        std::vector<Eigen::Triplet<Complex>>& triplets,
+                        Eigen::VectorXcd& b) const {
+        int n = nodes_.size() - 1;
+        int m = voltage_sources_.size();
+        size = n + m;
+
+        triplets.clear();
+        triplets.reserve(components_.size() * 4 + voltage_sources_.size() * 4);
+        b = Eigen::VectorXcd::Zero(size);
+
+        // Batches are compiled and value-refreshed by the caller before
+        // workers start; stamping them here is read-only, so concurrent
+        // sweep workers share them safely
+        auto stamp = [&triplets](int row, int col, const Complex& value) {
+            triplets.emplace_back(row, col, value);
+        };
+        if (batches_valid_) {
+            batches_.stampInto(frequency, stamp);
+        }
+        const auto& generals = batches_valid_ ? general_components_ : components_;
+        for (const auto& component : generals) {
             if (component->getType() != ComponentType::VOLTAGE_SOURCE) {
-                auto z = component->getImpedance(current_frequency_);
+                auto z = component->getImpedance(frequency);
                 auto y = Complex(1.0) / z;
-                
+
                 auto pins = component->getPins();
                 int n1 = getNodeIndex(pins[0]->getNode());
                 int n2 = getNodeIndex(pins[1]->getNode());
 
                 if (n1 >= 0) {
-                    A_(n1, n1) += y;
-                    if (n2 >= 0) A_(n1, n2) -= y;
+                    triplets.emplace_back(n1, n1, y);
+                    if (n2 >= 0) triplets.emplace_back(n1, n2, -y);
                 }
                 if (n2 >= 0) {
-                    A_(n2, n2) += y;
-                    if (n1 >= 0) A_(n2, n1) -= y;
+                    triplets.emplace_back(n2, n2, y);
+                    if (n1 >= 0) triplets.emplace_back(n2, n1, -y);
                 }
             }
         }
 
-        // Add voltage sources
         int vsi = n;
         for (const auto& vs : voltage_sources_) {
             auto pins = vs->getPins();
             int n1 = getNodeIndex(pins[0]->getNode());
             int n2 = getNodeIndex(pins[1]->getNode());
 
-            // Add current variables
             if (n1 >= 0) {
-                A_(n1, vsi) = 1.0;
-                A_(vsi, n1) = 1.0;
+                triplets.emplace_back(n1, vsi, Complex(1.0));
+                triplets.emplace_back(vsi, n1, Complex(1.0));
             }
             if (n2 >= 0) {
-                A_(n2, vsi) = -1.0;
-                A_(vsi, n2) = -1.0;
+                triplets.emplace_back(n2, vsi, Complex(-1.0));
+                triplets.emplace_back(vsi, n2, Complex(-1.0));
             }
 
-            // Add voltage constraint
-            b_(vsi) = vs->getVoltageAcross();
+            b(vsi) = vs->getVoltageAcross();
             vsi++;
         }
     }
 
+    // Refresh only the source terms of the right-hand side; the matrix and
+    // its factorization are untouched
+    void rebuildRHS() {
+        b_.setZero();
+        int vsi = nodes_.size() - 1;
+        for (const auto& vs : voltage_sources_) {
+            b_(vsi++) = vs->getVoltageAcross();
+        }
+    }
+
+    // Factorize the current matrix once; solveCached() reuses the result
+    // across timesteps with unchanged structure and values
+    void factorize() {
+        if (use_sparse_) {
+            sparse_lu_.compute(A_sparse_);
+        } else {
+            dense_lu_.compute(A_);
+        }
+    }
+
+    Eigen::VectorXcd solveCached() {
+        return use_sparse_ ? Eigen::VectorXcd(sparse_lu_.solve(b_))
+                           : Eigen::VectorXcd(dense_lu_.solve(b_));
+    }
+
+    void applySolution(const Eigen::VectorXcd& x) {
+        for (size_t i = 0; i < nodes_.size() - 1; i++) {
+            nodes_[i]->setVoltage(x(i));
+        }
+        int vsi = nodes_.size() - 1;
+        for (auto& vs : voltage_sources_) {
+            vs->setCurrent(x(vsi++));
+        }
+    }
+
     void solve() {
-        // Solve Ax = b using Eigen
-        Eigen::VectorXcd x = A_.colPivHouseholderQr().solve(b_);
+        Eigen::VectorXcd x;
+        if (use_sparse_) {
+            // Sparse path: SparseLU handles the near-diagonal MNA pattern
+            // without materializing the dense matrix
+            Eigen::SparseLU<Eigen::SparseMatrix<Complex>> solver;
+            solver.compute(A_sparse_);
+            x = solver.solve(b_);
+        } else {
+            // Solve Ax = b using Eigen
+            x = A_.colPivHouseholderQr().solve(b_);
+        }
 
         // Update node voltages
         for (size_t i = 0; i < nodes_.size() - 1; i++) {
@@ -154,7 +478,104 @@ private:
         }
     }
 
-    int getNodeIndex(std::shared_ptr<Node> node) {
+    // Rewrite the frozen system's coefficients in place: batches and the
+    // cached heterogeneous set stamp through a functor that targets the
+    // prepared dense entries or compressed sparse slots directly
+    void refreshFrozen() {
+        batches_.refreshValues();
+        b_.setZero();
+        if (use_sparse_) {
+            Complex* values = A_sparse_.valuePtr();
+            std::fill(values, values + A_sparse_.nonZeros(), Complex(0, 0));
+            stampFrozen([&](int row, int col, const Complex& value) {
+                values[stamp_slots_[slotKey(row, col)]] += value;
+            });
+        } else {
+            A_.setZero();
+            stampFrozen([&](int row, int col, const Complex& value) {
+                A_(row, col) += value;
+            });
+        }
+    }
+
+    template <typename StampFn>
+    void stampFrozen(StampFn&& stamp) {
+        batches_.stampInto(current_frequency_, stamp);
+        for (const auto& g : frozen_generals_) {
+            auto y = Complex(1.0) / g.component->getImpedance(current_frequency_);
+            if (g.n1 >= 0) {
+                stamp(g.n1, g.n1, y);
+                if (g.n2 >= 0) stamp(g.n1, g.n2, -y);
+            }
+            if (g.n2 >= 0) {
+                stamp(g.n2, g.n2, y);
+                if (g.n1 >= 0) stamp(g.n2, g.n1, -y);
+            }
+        }
+
+        int vsi = nodes_.size() - 1;
+        for (const auto& vs : voltage_sources_) {
+            auto pins = vs->getPins();
+            int n1 = getNodeIndex(pins[0]->getNode());
+            int n2 = getNodeIndex(pins[1]->getNode());
+            if (n1 >= 0) {
+                stamp(n1, vsi, Complex(1.0));
+                stamp(vsi, n1, Complex(1.0));
+            }
+            if (n2 >= 0) {
+                stamp(n2, vsi, Complex(-1.0));
+                stamp(vsi, n2, Complex(-1.0));
+            }
+            b_(vsi) = vs->getVoltageAcross();
+            vsi++;
+        }
+    }
+
+    void solveFrozen() {
+        Eigen::VectorXcd x;
+        if (use_sparse_) {
+            // Numeric factorization only; the symbolic phase ran once at
+            // freezeTopology()
+            sparse_lu_.factorize(A_sparse_);
+            x = sparse_lu_.solve(b_);
+        } else {
+            x = A_.colPivHouseholderQr().solve(b_);
+        }
+        applySolution(x);
+    }
+
+    static int64_t slotKey(long row, long col) {
+        return (static_cast<int64_t>(row) << 32) | static_cast<int64_t>(col);
+    }
+
+    // Sort the built-in two-terminal components into homogeneous batches
+    // with node indices cached once; the leftover heterogeneous set keeps
+    // the virtual stamping path. Invalidated by addComponent.
+    void ensureBatches() {
+        if (batches_valid_) {
+            return;
+        }
+        batches_.clear();
+        general_components_.clear();
+        for (const auto& component : components_) {
+            if (component->getType() == ComponentType::VOLTAGE_SOURCE) {
+                continue;
+            }
+            auto pins = component->getPins();
+            int n1 = getNodeIndex(pins[0]->getNode());
+            int n2 = getNodeIndex(pins[1]->getNode());
+            if (!batches_.tryAdd(component.get(), n1, n2)) {
+                general_components_.push_back(component);
+            }
+        }
+        batches_valid_ = true;
+    }
+
+    int getNodeIndex(std::shared_ptr<Node> node) const {
+        if (frozen_) {
+            auto it = node_index_map_.find(node.get());
+            return (it != node_index_map_.end()) ? it->second : -1;
+        }
         if (node == ground_node_) return -1;
         for (size_t i = 0; i < nodes_.size(); i++) {
             if (nodes_[i] == node) return i;
@@ -163,13 +584,35 @@ private:
     }
 
     std::vector<std::shared_ptr<Component>> components_;
+    // Homogeneous batches for built-in types plus the heterogeneous rest
+    // (see ensureBatches)
+    ComponentBatches batches_;
+    std::vector<std::shared_ptr<Component>> general_components_;
+    bool batches_valid_ = false;
+
+    // Frozen-topology state (see freezeTopology)
+    struct FrozenGeneral {
+        const Component* component;
+        int n1;
+        int n2;
+    };
+    bool frozen_ = false;
+    std::unordered_map<const Node*, int> node_index_map_;
+    std::vector<FrozenGeneral> frozen_generals_;
+    std::unordered_map<int64_t, int> stamp_slots_;
     std::vector<std::shared_ptr<Node>> nodes_;
     std::vector<std::shared_ptr<VoltageSource>> voltage_sources_;
     std::shared_ptr<Node> ground_node_;
     
     Eigen::MatrixXcd A_;
+    Eigen::SparseMatrix<Complex> A_sparse_;
     Eigen::VectorXcd b_;
-    
+    bool use_sparse_ = false;
+
+    // Cached factorizations for the incremental transient engine
+    Eigen::PartialPivLU<Eigen::MatrixXcd> dense_lu_;
+    Eigen::SparseLU<Eigen::SparseMatrix<Complex>> sparse_lu_;
+
     double current_frequency_ = 0.0;
     double time_ = 0.0;
     double timestep_ = 1e-6;
@@ -7,9 +7,360 @@
 #include <fstream>
 #include <iomanip>
 #include <cmath>
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
 
 namespace circuit {
 
+// Retained schematic geometry. Symbol outlines are tessellated once per
+// component type into shared vertex buffers; each placed component is
+// just a (type, transform) instance, and a quadtree over instance
+// bounds culls everything off screen before submission. Pan/zoom then
+// costs one quadtree query plus transform uploads instead of
+// regenerating the full drawing, which is what made 10k-component
+// boards choppy.
+class RetainedScene {
+public:
+    // Line-segment soup in symbol-local units: x0,y0,x1,y1 per segment
+    struct SymbolMesh {
+        std::vector<float> segments;
+    };
+
+    struct Transform {
+        float x;
+        float y;
+        float rotation;  // radians
+    };
+
+    struct Viewport {
+        float min_x, min_y, max_x, max_y;
+    };
+
+    // One instanced submission: shared mesh plus the transforms of the
+    // visible instances of that type
+    struct DrawBatch {
+        ComponentType type;
+        const SymbolMesh* mesh;
+        std::vector<Transform> transforms;
+    };
+
+    RetainedScene() {
+        tessellateSymbols();
+    }
+
+    uint32_t addInstance(ComponentType type, float x, float y,
+                         float rotation = 0.0f) {
+        const uint32_t id = static_cast<uint32_t>(instances_.size());
+        instances_.push_back({type, {x, y, rotation}, true});
+        quadtree_.insert(id, x, y);
+        return id;
+    }
+
+    // Move updates the transform and the instance's quadtree cell; the
+    // shared meshes are untouched
+    void moveInstance(uint32_t id, float x, float y) {
+        Instance& instance = instances_[id];
+        quadtree_.remove(id, instance.transform.x, instance.transform.y);
+        instance.transform.x = x;
+        instance.transform.y = y;
+        quadtree_.insert(id, x, y);
+    }
+
+    void setRotation(uint32_t id, float rotation) {
+        instances_[id].transform.rotation = rotation;
+    }
+
+    // Builds instances from the analyzer using the same row layout as
+    // generateSchematic
+    void build(const CircuitAnalyzer& analyzer) {
+        instances_.clear();
+        quadtree_.clear();
+        float x = 0, y = 0;
+        for (const auto& component : analyzer.getComponents()) {
+            addInstance(component->getType(), x, y);
+            x += 3;
+            if (x > 15) { x = 0; y -= 3; }
+        }
+    }
+
+    size_t instanceCount() const { return instances_.size(); }
+
+    // Per-frame submission: quadtree query for on-screen instances,
+    // grouped by type so each shared mesh is bound once
+    std::vector<DrawBatch> visibleBatches(const Viewport& viewport) const {
+        std::vector<uint32_t> visible;
+        quadtree_.query(viewport.min_x - kSymbolRadius,
+                        viewport.min_y - kSymbolRadius,
+                        viewport.max_x + kSymbolRadius,
+                        viewport.max_y + kSymbolRadius, visible);
+
+        std::map<ComponentType, std::vector<Transform>> by_type;
+        for (uint32_t id : visible) {
+            const Instance& instance = instances_[id];
+            by_type[instance.type].push_back(instance.transform);
+        }
+
+        std::vector<DrawBatch> batches;
+        batches.reserve(by_type.size());
+        for (auto& [type, transforms] : by_type) {
+            DrawBatch batch;
+            batch.type = type;
+            batch.mesh = &symbolMesh(type);
+            batch.transforms = std::move(transforms);
+            batches.push_back(std::move(batch));
+        }
+        return batches;
+    }
+
+    const SymbolMesh& symbolMesh(ComponentType type) const {
+        const auto it = symbols_.find(type);
+        return it != symbols_.end() ? it->second : fallback_symbol_;
+    }
+
+private:
+    // Symbols fit in a unit-ish box; culling pads the viewport by this
+    // much so partially visible symbols are kept
+    static constexpr float kSymbolRadius = 2.0f;
+
+    struct Instance {
+        ComponentType type;
+        Transform transform;
+        bool alive;
+    };
+
+    // Fixed-grid point quadtree: instances bucketed by position into a
+    // 2-level-subdividing region tree, capacity 16 per leaf, depth 8.
+    // Point insert/remove is enough because symbol extents are bounded
+    // and the query pads by kSymbolRadius.
+    class Quadtree {
+    public:
+        void insert(uint32_t id, float x, float y) {
+            ensureRoot(x, y);
+            insertInto(0, id, x, y, 0);
+        }
+
+        void remove(uint32_t id, float x, float y) {
+            if (nodes_.empty()) return;
+            removeFrom(0, id, x, y);
+        }
+
+        void query(float min_x, float min_y, float max_x, float max_y,
+                   std::vector<uint32_t>& out) const {
+            if (nodes_.empty()) return;
+            queryNode(0, min_x, min_y, max_x, max_y, out);
+        }
+
+        void clear() { nodes_.clear(); }
+
+    private:
+        static constexpr size_t kLeafCapacity = 16;
+        static constexpr int kMaxDepth = 8;
+
+        struct Node {
+            float min_x, min_y, max_x, max_y;
+            std::array<int, 4> children{{-1, -1, -1, -1}};
+            std::vector<std::pair<uint32_t, std::pair<float, float>>> items;
+        };
+
+        std::vector<Node> nodes_;
+
+        static Node makeNode(float min_x, float min_y,
+                             float max_x, float max_y) {
+            Node node;
+            node.min_x = min_x;
+            node.min_y = min_y;
+            node.max_x = max_x;
+            node.max_y = max_y;
+            return node;
+        }
+
+        void ensureRoot(float x, float y) {
+            if (nodes_.empty()) {
+                nodes_.push_back(makeNode(x - 32, y - 32, x + 32, y + 32));
+                return;
+            }
+            // Grow the root outward until the point fits
+            while (x < nodes_[0].min_x || x > nodes_[0].max_x ||
+                   y < nodes_[0].min_y || y > nodes_[0].max_y) {
+                Node& root = nodes_[0];
+                const float width = root.max_x - root.min_x;
+                root.min_x -= width * 0.5f;
+                root.max_x += width * 0.5f;
+                root.min_y -= width * 0.5f;
+                root.max_y += width * 0.5f;
+                // Children no longer tile the root; reinsert everything
+                std::vector<std::pair<uint32_t, std::pair<float, float>>> all;
+                collect(0, all);
+                const Node bounds = nodes_[0];
+                nodes_.clear();
+                nodes_.push_back(makeNode(bounds.min_x, bounds.min_y,
+                                          bounds.max_x, bounds.max_y));
+                for (const auto& item : all) {
+                    insertInto(0, item.first, item.second.first,
+                               item.second.second, 0);
+                }
+            }
+        }
+
+        void collect(int node,
+                     std::vector<std::pair<uint32_t, std::pair<float, float>>>& out) const {
+            const Node& n = nodes_[node];
+            out.insert(out.end(), n.items.begin(), n.items.end());
+            for (int child : n.children) {
+                if (child >= 0) collect(child, out);
+            }
+        }
+
+        void insertInto(int node, uint32_t id, float x, float y, int depth) {
+            Node& n = nodes_[node];
+            if (n.children[0] < 0) {
+                if (n.items.size() < kLeafCapacity || depth >= kMaxDepth) {
+                    n.items.push_back({id, {x, y}});
+                    return;
+                }
+                subdivide(node);
+            }
+            const int quadrant = quadrantOf(nodes_[node], x, y);
+            insertInto(nodes_[node].children[quadrant], id, x, y, depth + 1);
+        }
+
+        void removeFrom(int node, uint32_t id, float x, float y) {
+            Node& n = nodes_[node];
+            for (size_t i = 0; i < n.items.size(); i++) {
+                if (n.items[i].first == id) {
+                    n.items[i] = n.items.back();
+                    n.items.pop_back();
+                    return;
+                }
+            }
+            if (n.children[0] >= 0) {
+                removeFrom(n.children[quadrantOf(n, x, y)], id, x, y);
+            }
+        }
+
+        void subdivide(int node) {
+            const float mid_x = (nodes_[node].min_x + nodes_[node].max_x) * 0.5f;
+            const float mid_y = (nodes_[node].min_y + nodes_[node].max_y) * 0.5f;
+            for (int q = 0; q < 4; q++) {
+                Node child;
+                child.min_x = (q & 1) ? mid_x : nodes_[node].min_x;
+                child.max_x = (q & 1) ? nodes_[node].max_x : mid_x;
+                child.min_y = (q & 2) ? mid_y : nodes_[node].min_y;
+                child.max_y = (q & 2) ? nodes_[node].max_y : mid_y;
+                nodes_[node].children[q] = static_cast<int>(nodes_.size());
+                nodes_.push_back(std::move(child));
+            }
+            auto items = std::move(nodes_[node].items);
+            nodes_[node].items.clear();
+            for (const auto& item : items) {
+                const int quadrant = quadrantOf(nodes_[node],
+                                                item.second.first,
+                                                item.second.second);
+                nodes_[nodes_[node].children[quadrant]].items.push_back(item);
+            }
+        }
+
+        static int quadrantOf(const Node& n, float x, float y) {
+            const float mid_x = (n.min_x + n.max_x) * 0.5f;
+            const float mid_y = (n.min_y + n.max_y) * 0.5f;
+            return (x >= mid_x ? 1 : 0) | (y >= mid_y ? 2 : 0);
+        }
+
+        void queryNode(int node, float min_x, float min_y,
+                       float max_x, float max_y,
+                       std::vector<uint32_t>& out) const {
+            const Node& n = nodes_[node];
+            if (n.max_x < min_x || n.min_x > max_x ||
+                n.max_y < min_y || n.min_y > max_y) {
+                return;
+            }
+            for (const auto& item : n.items) {
+                const float x = item.second.first;
+                const float y = item.second.second;
+                if (x >= min_x && x <= max_x && y >= min_y && y <= max_y) {
+                    out.push_back(item.first);
+                }
+            }
+            for (int child : n.children) {
+                if (child >= 0) {
+                    queryNode(child, min_x, min_y, max_x, max_y, out);
+                }
+            }
+        }
+    };
+
+    // One-time tessellation of the symbol library into shared buffers
+    void tessellateSymbols() {
+        // Resistor: lead, zigzag, lead
+        SymbolMesh resistor;
+        addSegment(resistor, -1.0f, 0.0f, -0.6f, 0.0f);
+        float zx = -0.6f;
+        float direction = 1.0f;
+        for (int i = 0; i < 6; i++) {
+            addSegment(resistor, zx, (i == 0 ? 0.0f : -direction * 0.2f),
+                       zx + 0.2f, (i == 5 ? 0.0f : direction * 0.2f));
+            zx += 0.2f;
+            direction = -direction;
+        }
+        addSegment(resistor, 0.6f, 0.0f, 1.0f, 0.0f);
+        symbols_[ComponentType::RESISTOR] = std::move(resistor);
+
+        // Capacitor: two leads, two plates
+        SymbolMesh capacitor;
+        addSegment(capacitor, -1.0f, 0.0f, -0.1f, 0.0f);
+        addSegment(capacitor, -0.1f, -0.4f, -0.1f, 0.4f);
+        addSegment(capacitor, 0.1f, -0.4f, 0.1f, 0.4f);
+        addSegment(capacitor, 0.1f, 0.0f, 1.0f, 0.0f);
+        symbols_[ComponentType::CAPACITOR] = std::move(capacitor);
+
+        // Inductor: leads and a four-hump polyline approximation
+        SymbolMesh inductor;
+        addSegment(inductor, -1.0f, 0.0f, -0.6f, 0.0f);
+        float lx = -0.6f;
+        for (int hump = 0; hump < 4; hump++) {
+            addSegment(inductor, lx, 0.0f, lx + 0.15f, 0.25f);
+            addSegment(inductor, lx + 0.15f, 0.25f, lx + 0.3f, 0.0f);
+            lx += 0.3f;
+        }
+        addSegment(inductor, 0.6f, 0.0f, 1.0f, 0.0f);
+        symbols_[ComponentType::INDUCTOR] = std::move(inductor);
+
+        // Voltage source: leads and a square-ish circle outline
+        SymbolMesh source;
+        addSegment(source, -1.0f, 0.0f, -0.4f, 0.0f);
+        const int arc_steps = 12;
+        for (int i = 0; i < arc_steps; i++) {
+            const float a0 = 2.0f * static_cast<float>(M_PI) * i / arc_steps;
+            const float a1 = 2.0f * static_cast<float>(M_PI) * (i + 1) / arc_steps;
+            addSegment(source, 0.4f * std::cos(a0), 0.4f * std::sin(a0),
+                       0.4f * std::cos(a1), 0.4f * std::sin(a1));
+        }
+        addSegment(source, 0.4f, 0.0f, 1.0f, 0.0f);
+        symbols_[ComponentType::VOLTAGE_SOURCE] = std::move(source);
+
+        // Fallback: plain box for types without a dedicated symbol
+        addSegment(fallback_symbol_, -0.5f, -0.5f, 0.5f, -0.5f);
+        addSegment(fallback_symbol_, 0.5f, -0.5f, 0.5f, 0.5f);
+        addSegment(fallback_symbol_, 0.5f, 0.5f, -0.5f, 0.5f);
+        addSegment(fallback_symbol_, -0.5f, 0.5f, -0.5f, -0.5f);
+    }
+
+    static void addSegment(SymbolMesh& mesh, float x0, float y0,
+                           float x1, float y1) {
+        mesh.segments.push_back(x0);
+        mesh.segments.push_back(y0);
+        mesh.segments.push_back(x1);
+        mesh.segments.push_back(y1);
+    }
+
+    std::map<ComponentType, SymbolMesh> symbols_;
+    SymbolMesh fallback_symbol_;
+    std::vector<Instance> instances_;
+    Quadtree quadtree_;
+};
+
 class CircuitVisualizer {
 public:
     CircuitVisualizer(const CircuitAnalyzer& analyzer) 
@@ -4,6 +4,13 @@
 #include <vector>
 #include <memory>
 #include <filesystem>
+#include <fstream>
+#include <functional>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
 #include <megaapi.h>
 #include <digitalocean/digitalocean.hpp>
 #include "SecurityManager.hpp"
@@ -54,12 +61,64 @@ public:
     }
 
     ~CloudStorage() {
+        stopTransferWorkers();
         if (mega_api_) {
             mega_api_->logout();
             delete mega_api_;
         }
     }
 
+    struct TransferOptions {
+        size_t part_size = 8 * 1024 * 1024;  // split threshold and part size
+        size_t max_parallel_parts = 4;        // bounded per-file concurrency
+        int max_retries = 3;
+        std::chrono::milliseconds initial_backoff{500};  // doubled per retry
+    };
+
+    struct TransferStatus {
+        bool success;
+        std::string local_path;
+        std::string remote_path;
+        size_t bytes_transferred;
+        std::string error;
+    };
+
+    using CompletionCallback = std::function<void(const TransferStatus&)>;
+
+    // Queue an upload on the async transfer manager and return immediately.
+    // Files larger than part_size are split into chunks uploaded in
+    // parallel (bounded by max_parallel_parts) as "<remote>.part-N" objects
+    // with per-part retry and exponential backoff, so a multi-hundred-MB
+    // archive saturates the uplink without stalling RecyclingApp workflows.
+    void uploadFileAsync(const std::string& local_path,
+                         const std::string& remote_path,
+                         bool use_mega = true,
+                         const TransferOptions& options = {},
+                         CompletionCallback callback = nullptr) {
+        {
+            std::lock_guard<std::mutex> lock(transfer_mutex_);
+            if (!transfer_workers_running_) {
+                transfer_workers_running_ = true;
+                for (size_t i = 0; i < kTransferWorkers; i++) {
+                    transfer_workers_.emplace_back(
+                        &CloudStorage::transferWorkerLoop, this);
+                }
+            }
+            transfer_queue_.push_back(
+                {local_path, remote_path, use_mega, options, callback});
+            ++transfers_pending_;
+        }
+        transfer_cv_.notify_one();
+    }
+
+    // Block until every queued transfer has completed or failed
+    void waitForTransfers() {
+        std::unique_lock<std::mutex> lock(transfer_mutex_);
+        transfers_done_cv_.wait(lock, [this] {
+            return transfers_pending_ == 0;
+        });
+    }
+
     bool uploadFile(const std::string& local_path,
                    const std::string& remote_path,
                    bool use_mega = true) {
@@ -126,12 +185,180 @@ public:
     }
 
 private:
+    struct PendingTransfer {
+        std::string local_path;
+        std::string remote_path;
+        bool use_mega;
+        TransferOptions options;
+        CompletionCallback callback;
+    };
+
+    static constexpr size_t kTransferWorkers = 2;
+
     std::shared_ptr<SecurityManager> security_manager_;
     StorageConfig config_;
     mega::MegaApi* mega_api_ = nullptr;
     std::unique_ptr<digitalocean::Client> do_client_;
     std::string last_error_;
 
+    std::deque<PendingTransfer> transfer_queue_;
+    std::vector<std::thread> transfer_workers_;
+    std::mutex transfer_mutex_;
+    std::condition_variable transfer_cv_;
+    std::condition_variable transfers_done_cv_;
+    size_t transfers_pending_ = 0;
+    bool transfer_workers_running_ = false;
+    bool transfer_stop_ = false;
+
+    void transferWorkerLoop() {
+        while (true) {
+            PendingTransfer transfer;
+            {
+                std::unique_lock<std::mutex> lock(transfer_mutex_);
+                transfer_cv_.wait(lock, [this] {
+                    return transfer_stop_ || !transfer_queue_.empty();
+                });
+                if (transfer_stop_ && transfer_queue_.empty()) {
+                    return;
+                }
+                transfer = std::move(transfer_queue_.front());
+                transfer_queue_.pop_front();
+            }
+
+            TransferStatus status = runTransfer(transfer);
+            if (transfer.callback) {
+                transfer.callback(status);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(transfer_mutex_);
+                --transfers_pending_;
+            }
+            transfers_done_cv_.notify_all();
+        }
+    }
+
+    TransferStatus runTransfer(const PendingTransfer& transfer) {
+        TransferStatus status{false, transfer.local_path,
+                              transfer.remote_path, 0, ""};
+
+        std::error_code ec;
+        size_t file_size = std::filesystem::file_size(transfer.local_path, ec);
+        if (ec) {
+            status.error = "Cannot stat file: " + ec.message();
+            return status;
+        }
+
+        if (file_size <= transfer.options.part_size) {
+            status.success = uploadWithRetry(
+                transfer.local_path, transfer.remote_path,
+                transfer.use_mega, transfer.options);
+        } else {
+            status.success = uploadMultipart(transfer, file_size);
+        }
+
+        if (status.success) {
+            status.bytes_transferred = file_size;
+        } else {
+            status.error = last_error_;
+        }
+        return status;
+    }
+
+    // Split the file into parts and upload them in parallel, bounded by
+    // max_parallel_parts; each part is retried independently
+    bool uploadMultipart(const PendingTransfer& transfer, size_t file_size) {
+        size_t part_count =
+            (file_size + transfer.options.part_size - 1) /
+            transfer.options.part_size;
+
+        std::atomic<size_t> next_part{0};
+        std::atomic<bool> failed{false};
+
+        auto part_worker = [&]() {
+            std::ifstream input(transfer.local_path, std::ios::binary);
+            std::vector<char> buffer(transfer.options.part_size);
+
+            size_t part;
+            while (!failed.load() &&
+                   (part = next_part.fetch_add(1)) < part_count) {
+                size_t offset = part * transfer.options.part_size;
+                size_t length = std::min(transfer.options.part_size,
+                                         file_size - offset);
+
+                input.seekg(static_cast<std::streamoff>(offset));
+                input.read(buffer.data(), static_cast<std::streamsize>(length));
+                if (!input) {
+                    failed.store(true);
+                    return;
+                }
+
+                auto part_path = std::filesystem::temp_directory_path() /
+                    (std::filesystem::path(transfer.local_path).filename()
+                         .string() + ".part-" + std::to_string(part));
+                {
+                    std::ofstream out(part_path, std::ios::binary);
+                    out.write(buffer.data(),
+                              static_cast<std::streamsize>(length));
+                }
+
+                std::string remote_part =
+                    transfer.remote_path + ".part-" + std::to_string(part);
+                if (!uploadWithRetry(part_path.string(), remote_part,
+                                     transfer.use_mega, transfer.options)) {
+                    failed.store(true);
+                }
+                std::filesystem::remove(part_path);
+            }
+        };
+
+        size_t workers = std::min(transfer.options.max_parallel_parts,
+                                  part_count);
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < workers; i++) {
+            threads.emplace_back(part_worker);
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        return !failed.load();
+    }
+
+    bool uploadWithRetry(const std::string& local_path,
+                         const std::string& remote_path,
+                         bool use_mega,
+                         const TransferOptions& options) {
+        auto backoff = options.initial_backoff;
+        for (int attempt = 0; attempt <= options.max_retries; attempt++) {
+            if (uploadFile(local_path, remote_path, use_mega)) {
+                return true;
+            }
+            if (attempt < options.max_retries) {
+                std::this_thread::sleep_for(backoff);
+                backoff *= 2;
+            }
+        }
+        return false;
+    }
+
+    void stopTransferWorkers() {
+        {
+            std::lock_guard<std::mutex> lock(transfer_mutex_);
+            if (!transfer_workers_running_) {
+                return;
+            }
+            transfer_stop_ = true;
+        }
+        transfer_cv_.notify_all();
+        for (auto& worker : transfer_workers_) {
+            if (worker.joinable()) {
+                worker.join();
+            }
+        }
+        transfer_workers_running_ = false;
+    }
+
     void initializeMega() {
         try {
             mega_api_ = new mega::MegaApi(config_.mega.app_key.c_str());
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Component.hpp"
+#include "BasicComponents.hpp"
+#include <cmath>
+#include <vector>
+
+namespace circuit {
+
+// CRTP base for a homogeneous, contiguous array of one component type.
+// The admittance of every element is computed in a single loop whose
+// callee is resolved at compile time, so the stamping pass over 100k
+// resistors is a vectorizable sweep of flat arrays instead of 100k
+// virtual getImpedance calls through shared_ptr indirection.
+template <typename Derived>
+class ComponentBatchBase {
+public:
+    // Record one element with its cached node indices (-1 = ground).
+    // The source pointer is kept so refreshValues() can pick up
+    // parameter changes without recompiling the batch.
+    void add(const Component* source, double value, int n1, int n2) {
+        sources_.push_back(source);
+        values_.push_back(value);
+        n1_.push_back(n1);
+        n2_.push_back(n2);
+    }
+
+    void clear() {
+        sources_.clear();
+        values_.clear();
+        n1_.clear();
+        n2_.clear();
+    }
+
+    size_t size() const { return values_.size(); }
+
+    // Re-read the element value from each source component; called once
+    // per assembly so optimizer iterations that only change parameter
+    // values never pay a recompile.
+    void refreshValues() {
+        for (size_t i = 0; i < sources_.size(); ++i) {
+            values_[i] = Derived::readValue(*sources_[i]);
+        }
+    }
+
+    // Stamp every element's admittance into the MNA system through the
+    // caller's stamp functor. The admittance formula is a static inline
+    // on the derived batch, so the whole loop body inlines.
+    template <typename StampFn>
+    void stampInto(double frequency, StampFn&& stamp) const {
+        for (size_t i = 0; i < values_.size(); ++i) {
+            Complex y = Derived::admittance(values_[i], frequency);
+            int n1 = n1_[i];
+            int n2 = n2_[i];
+            if (n1 >= 0) {
+                stamp(n1, n1, y);
+                if (n2 >= 0) stamp(n1, n2, -y);
+            }
+            if (n2 >= 0) {
+                stamp(n2, n2, y);
+                if (n1 >= 0) stamp(n2, n1, -y);
+            }
+        }
+    }
+
+protected:
+    std::vector<const Component*> sources_;
+    std::vector<double> values_;
+    std::vector<int> n1_;
+    std::vector<int> n2_;
+};
+
+class ResistorBatch : public ComponentBatchBase<ResistorBatch> {
+public:
+    static double readValue(const Component& c) {
+        return c.getParameter("resistance");
+    }
+    static Complex admittance(double resistance, double /*frequency*/) {
+        return Complex(1.0 / resistance, 0);
+    }
+};
+
+class CapacitorBatch : public ComponentBatchBase<CapacitorBatch> {
+public:
+    static double readValue(const Component& c) {
+        return c.getParameter("capacitance");
+    }
+    static Complex admittance(double capacitance, double frequency) {
+        // y = 1/z with z = -j/(2*pi*f*C); open circuit at DC
+        if (frequency == 0) return Complex(0, 0);
+        return Complex(0, 2 * M_PI * frequency * capacitance);
+    }
+};
+
+class InductorBatch : public ComponentBatchBase<InductorBatch> {
+public:
+    static double readValue(const Component& c) {
+        return c.getParameter("inductance");
+    }
+    static Complex admittance(double inductance, double frequency) {
+        // Matches Complex(1)/getImpedance() from the virtual path,
+        // including its divide-by-zero behavior at DC
+        double xl = 2 * M_PI * frequency * inductance;
+        return Complex(1.0, 0) / Complex(0, xl);
+    }
+};
+
+// Per-type batches for the built-in two-terminal component types, with a
+// shared dispatch point used by CircuitAnalyzer: built-ins land in their
+// homogeneous batch, everything else stays on the virtual stamping path.
+class ComponentBatches {
+public:
+    // Try to place a component in a homogeneous batch; node indices are
+    // captured once here, replacing the per-build index scans.
+    bool tryAdd(const Component* component, int n1, int n2) {
+        switch (component->getType()) {
+            case ComponentType::RESISTOR:
+                resistors_.add(component,
+                               ResistorBatch::readValue(*component), n1, n2);
+                return true;
+            case ComponentType::CAPACITOR:
+                capacitors_.add(component,
+                                CapacitorBatch::readValue(*component), n1, n2);
+                return true;
+            case ComponentType::INDUCTOR:
+                inductors_.add(component,
+                               InductorBatch::readValue(*component), n1, n2);
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    void clear() {
+        resistors_.clear();
+        capacitors_.clear();
+        inductors_.clear();
+    }
+
+    size_t size() const {
+        return resistors_.size() + capacitors_.size() + inductors_.size();
+    }
+
+    void refreshValues() {
+        resistors_.refreshValues();
+        capacitors_.refreshValues();
+        inductors_.refreshValues();
+    }
+
+    template <typename StampFn>
+    void stampInto(double frequency, StampFn&& stamp) const {
+        resistors_.stampInto(frequency, stamp);
+        capacitors_.stampInto(frequency, stamp);
+        inductors_.stampInto(frequency, stamp);
+    }
+
+private:
+    ResistorBatch resistors_;
+    CapacitorBatch capacitors_;
+    InductorBatch inductors_;
+};
+
+} // namespace circuit
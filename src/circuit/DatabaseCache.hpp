@@ -0,0 +1,254 @@
+#pragma once
+
+#include "DatabaseManager.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace circuit {
+
+// In-process cache tier between the application-facing DatabaseManager
+// and the backing stores (Mongo/SQLite). Reads go through per-record
+// LRU caches so interactive lookups during line operation are
+// memory-speed; writes land in the cache immediately and are flushed to
+// the backing store by a background thread in batches. flush() is the
+// end-of-shift barrier: it blocks until every queued write has been
+// handed to the backing store.
+//
+// The backing store is attached through loader/writer callbacks so this
+// header stays free of driver dependencies; MongoDBManager's
+// save*/load* methods slot straight in.
+class DatabaseCache {
+public:
+    using ComponentRecord = DatabaseManager::ComponentRecord;
+    using OperatorRecord = DatabaseManager::OperatorRecord;
+    using RecyclingRecord = DatabaseManager::RecyclingRecord;
+
+    using ComponentLoader = std::function<bool(const std::string&, ComponentRecord&)>;
+    using OperatorLoader = std::function<bool(const std::string&, OperatorRecord&)>;
+    using ComponentWriter = std::function<bool(const ComponentRecord&)>;
+    using OperatorWriter = std::function<bool(const OperatorRecord&)>;
+    using RecyclingWriter = std::function<bool(const RecyclingRecord&)>;
+
+    explicit DatabaseCache(size_t capacity_per_type = 4096)
+        : components_(capacity_per_type), operators_(capacity_per_type) {
+        flusher_ = std::thread([this]() { flushLoop(); });
+    }
+
+    ~DatabaseCache() {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            stopping_ = true;
+        }
+        queue_ready_.notify_all();
+        flusher_.join();
+    }
+
+    DatabaseCache(const DatabaseCache&) = delete;
+    DatabaseCache& operator=(const DatabaseCache&) = delete;
+
+    // Backing-store wiring
+    void setComponentBackend(ComponentLoader loader, ComponentWriter writer) {
+        component_loader_ = std::move(loader);
+        component_writer_ = std::move(writer);
+    }
+
+    void setOperatorBackend(OperatorLoader loader, OperatorWriter writer) {
+        operator_loader_ = std::move(loader);
+        operator_writer_ = std::move(writer);
+    }
+
+    void setRecyclingWriter(RecyclingWriter writer) {
+        recycling_writer_ = std::move(writer);
+    }
+
+    // Read-through lookups: LRU hit or backing-store load
+    bool getComponent(const std::string& id, ComponentRecord& out) {
+        {
+            std::unique_lock<std::mutex> lock(cache_mutex_);
+            if (components_.get(id, out)) {
+                hits_++;
+                return true;
+            }
+        }
+        misses_++;
+        if (!component_loader_ || !component_loader_(id, out)) {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(cache_mutex_);
+        components_.put(id, out);
+        return true;
+    }
+
+    bool getOperator(const std::string& id, OperatorRecord& out) {
+        {
+            std::unique_lock<std::mutex> lock(cache_mutex_);
+            if (operators_.get(id, out)) {
+                hits_++;
+                return true;
+            }
+        }
+        misses_++;
+        if (!operator_loader_ || !operator_loader_(id, out)) {
+            return false;
+        }
+        std::unique_lock<std::mutex> lock(cache_mutex_);
+        operators_.put(id, out);
+        return true;
+    }
+
+    // Write-behind updates: cache now, backing store from the flusher
+    void putComponent(const ComponentRecord& component) {
+        {
+            std::unique_lock<std::mutex> lock(cache_mutex_);
+            components_.put(component.id, component);
+        }
+        enqueue([this, component]() {
+            return !component_writer_ || component_writer_(component);
+        });
+    }
+
+    void putOperator(const OperatorRecord& op) {
+        {
+            std::unique_lock<std::mutex> lock(cache_mutex_);
+            operators_.put(op.id, op);
+        }
+        enqueue([this, op]() {
+            return !operator_writer_ || operator_writer_(op);
+        });
+    }
+
+    // Recycling records are append-only process history; they bypass
+    // the LRU and go straight onto the write-behind queue
+    void putRecyclingRecord(const RecyclingRecord& record) {
+        enqueue([this, record]() {
+            return !recycling_writer_ || recycling_writer_(record);
+        });
+    }
+
+    // End-of-shift barrier: returns once every write queued before the
+    // call has been handed to the backing store
+    void flush() {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        queue_ready_.notify_all();
+        flush_done_.wait(lock, [this]() {
+            return queue_.empty() && !flushing_;
+        });
+    }
+
+    size_t pendingWrites() {
+        std::unique_lock<std::mutex> lock(queue_mutex_);
+        return queue_.size() + (flushing_ ? in_flight_ : 0);
+    }
+
+    size_t cacheHits() const { return hits_; }
+    size_t cacheMisses() const { return misses_; }
+    size_t failedWrites() const { return failed_writes_; }
+
+private:
+    // Plain intrusive-list LRU keyed by record id
+    template <typename Record>
+    class LruCache {
+    public:
+        explicit LruCache(size_t capacity) : capacity_(capacity) {}
+
+        bool get(const std::string& id, Record& out) {
+            auto it = index_.find(id);
+            if (it == index_.end()) {
+                return false;
+            }
+            entries_.splice(entries_.begin(), entries_, it->second);
+            out = it->second->second;
+            return true;
+        }
+
+        void put(const std::string& id, const Record& record) {
+            auto it = index_.find(id);
+            if (it != index_.end()) {
+                it->second->second = record;
+                entries_.splice(entries_.begin(), entries_, it->second);
+                return;
+            }
+            entries_.emplace_front(id, record);
+            index_[id] = entries_.begin();
+            if (entries_.size() > capacity_) {
+                index_.erase(entries_.back().first);
+                entries_.pop_back();
+            }
+        }
+
+    private:
+        size_t capacity_;
+        std::list<std::pair<std::string, Record>> entries_;
+        std::map<std::string, typename std::list<std::pair<std::string, Record>>::iterator> index_;
+    };
+
+    void enqueue(std::function<bool()> write) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            queue_.push_back(std::move(write));
+        }
+        queue_ready_.notify_one();
+    }
+
+    void flushLoop() {
+        for (;;) {
+            std::vector<std::function<bool()>> batch;
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                queue_ready_.wait(lock, [this]() {
+                    return stopping_ || !queue_.empty();
+                });
+                if (queue_.empty() && stopping_) {
+                    return;
+                }
+                batch.swap(queue_);
+                flushing_ = true;
+                in_flight_ = batch.size();
+            }
+            for (const auto& write : batch) {
+                if (!write()) {
+                    failed_writes_++;
+                }
+            }
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                flushing_ = false;
+                in_flight_ = 0;
+            }
+            flush_done_.notify_all();
+        }
+    }
+
+    LruCache<ComponentRecord> components_;
+    LruCache<OperatorRecord> operators_;
+    std::mutex cache_mutex_;
+
+    ComponentLoader component_loader_;
+    OperatorLoader operator_loader_;
+    ComponentWriter component_writer_;
+    OperatorWriter operator_writer_;
+    RecyclingWriter recycling_writer_;
+
+    std::vector<std::function<bool()>> queue_;
+    std::mutex queue_mutex_;
+    std::condition_variable queue_ready_;
+    std::condition_variable flush_done_;
+    bool stopping_ = false;
+    bool flushing_ = false;
+    size_t in_flight_ = 0;
+    std::thread flusher_;
+
+    std::atomic<size_t> hits_{0};
+    std::atomic<size_t> misses_{0};
+    std::atomic<size_t> failed_writes_{0};
+};
+
+} // namespace circuit
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace circuit {
+
+// Differential design sync. The design document is treated as a tree of
+// components; every node gets a content hash over its own payload and a
+// subtree hash folding in its children, Merkle style. Against the
+// baseline recorded by the previous successful sync, an unchanged
+// subtree hash prunes the whole branch, and within a changed branch
+// only the nodes whose own content changed are uploaded — a
+// single-component edit moves one component, not the full model.
+// Changed components are independent objects on the service side, so
+// their uploads run in parallel with bounded concurrency. Baselines
+// advance only for subtrees whose uploads all succeeded; anything that
+// failed stays dirty and is retried by the next sync.
+class DesignSyncEngine {
+public:
+    struct DesignComponent {
+        std::string id;
+        std::string payload;  // serialized component content
+        std::vector<DesignComponent> children;
+    };
+
+    // Uploads one component's payload; returns false on failure
+    using Uploader = std::function<bool(const DesignComponent&)>;
+
+    struct SyncReport {
+        size_t uploaded = 0;  // components whose content changed and shipped
+        size_t skipped = 0;   // components pruned via unchanged subtree hash
+        size_t failed = 0;
+    };
+
+    SyncReport sync(const DesignComponent& root, const Uploader& upload,
+                    unsigned max_concurrency = 4) {
+        SyncReport report;
+
+        // Phase 1: hash the tree, pruning unchanged subtrees, and
+        // collect the touched nodes with their upload needs
+        touched_.clear();
+        collect(root, report);
+
+        // Phase 2: bounded-concurrency upload of the changed payloads
+        std::vector<size_t> jobs;
+        for (size_t i = 0; i < touched_.size(); i++) {
+            if (touched_[i].needs_upload) {
+                jobs.push_back(i);
+            }
+        }
+        if (!jobs.empty()) {
+            std::atomic<size_t> cursor{0};
+            auto worker = [&]() {
+                size_t j;
+                while ((j = cursor.fetch_add(1)) < jobs.size()) {
+                    Touched& entry = touched_[jobs[j]];
+                    entry.upload_ok = upload(*entry.node);
+                }
+            };
+            if (max_concurrency <= 1 || jobs.size() == 1) {
+                worker();
+            } else {
+                const unsigned count = max_concurrency < jobs.size()
+                    ? max_concurrency : static_cast<unsigned>(jobs.size());
+                std::vector<std::thread> threads;
+                for (unsigned t = 0; t < count; t++) {
+                    threads.emplace_back(worker);
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            }
+        }
+
+        // Phase 3: advance baselines bottom-up, only where the whole
+        // subtree made it
+        for (size_t i = touched_.size(); i-- > 0;) {
+            Touched& entry = touched_[i];
+            entry.subtree_ok = !entry.needs_upload || entry.upload_ok;
+            for (size_t child : entry.touched_children) {
+                entry.subtree_ok = entry.subtree_ok && touched_[child].subtree_ok;
+            }
+            if (entry.subtree_ok) {
+                baseline_[entry.node->id] = entry.subtree_hash;
+                content_baseline_[entry.node->id] = entry.content_hash;
+            }
+            if (entry.needs_upload) {
+                if (entry.upload_ok) {
+                    report.uploaded++;
+                } else {
+                    report.failed++;
+                }
+            }
+        }
+        return report;
+    }
+
+    // Forces a full re-upload on the next sync
+    void clearBaseline() {
+        baseline_.clear();
+        content_baseline_.clear();
+    }
+
+    size_t baselineSize() const { return baseline_.size(); }
+
+private:
+    struct Touched {
+        const DesignComponent* node;
+        uint64_t content_hash;
+        uint64_t subtree_hash;
+        bool needs_upload;
+        bool upload_ok = false;
+        bool subtree_ok = false;
+        std::vector<size_t> touched_children;
+    };
+
+    // FNV-1a over the payload
+    static uint64_t contentHash(const std::string& payload) {
+        uint64_t hash = 14695981039346656037ull;
+        for (unsigned char c : payload) {
+            hash = (hash ^ c) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    static uint64_t fold(uint64_t hash, uint64_t child) {
+        return hash ^ (child + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2));
+    }
+
+    // Pure hash pass used for children feeding a parent's subtree hash
+    static uint64_t subtreeHash(const DesignComponent& node) {
+        uint64_t subtree = contentHash(node.payload);
+        for (const auto& child : node.children) {
+            subtree = fold(subtree, subtreeHash(child));
+        }
+        return subtree;
+    }
+
+    static size_t countNodes(const DesignComponent& node) {
+        size_t count = 1;
+        for (const auto& child : node.children) {
+            count += countNodes(child);
+        }
+        return count;
+    }
+
+    // Returns the index of the node's Touched entry, or SIZE_MAX if the
+    // subtree was pruned as unchanged
+    size_t collect(const DesignComponent& node, SyncReport& report) {
+        const uint64_t content = contentHash(node.payload);
+        uint64_t subtree = content;
+        for (const auto& child : node.children) {
+            subtree = fold(subtree, subtreeHash(child));
+        }
+
+        const auto it = baseline_.find(node.id);
+        if (it != baseline_.end() && it->second == subtree) {
+            report.skipped += countNodes(node);
+            return SIZE_MAX;
+        }
+
+        const auto content_it = content_baseline_.find(node.id);
+        const bool content_changed =
+            content_it == content_baseline_.end() || content_it->second != content;
+
+        const size_t index = touched_.size();
+        touched_.push_back({&node, content, subtree, content_changed});
+        for (const auto& child : node.children) {
+            const size_t child_index = collect(child, report);
+            if (child_index != SIZE_MAX) {
+                touched_[index].touched_children.push_back(child_index);
+            }
+        }
+        return index;
+    }
+
+    std::vector<Touched> touched_;
+    std::map<std::string, uint64_t> baseline_;        // id -> subtree hash
+    std::map<std::string, uint64_t> content_baseline_;  // id -> content hash
+};
+
+} // namespace circuit
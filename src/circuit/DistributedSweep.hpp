@@ -0,0 +1,306 @@
+#pragma once
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace circuit {
+
+// Distributed execution of independent sweep evaluations (performAC
+// frequency points, DifferentialEvolution individuals, filter designs)
+// across LAN machines.
+//
+// The coordinator holds the task queue; workers connect over TCP and
+// pull one task at a time, so a fast machine simply requests more often
+// than a slow one — load balancing falls out of the pull model without
+// any explicit stealing protocol. Tasks handed to a worker stay in an
+// in-flight table until their result arrives; if the connection drops,
+// everything that worker held goes back on the queue and is re-served
+// to the next requester, so a crashed lab machine costs only its
+// unfinished evaluations.
+//
+// Wire format: every message is a 4-byte little-endian payload length,
+// a 1-byte message type, then the payload. Task payloads are opaque
+// blobs; callers serialize whatever their evaluation needs (a frequency
+// point, a DE parameter vector, a filter spec).
+class DistributedSweep {
+public:
+    using Blob = std::vector<uint8_t>;
+
+    enum MessageType : uint8_t {
+        TASK_REQUEST = 1,   // worker -> coordinator: ready for work
+        TASK = 2,           // coordinator -> worker: task_id + payload
+        RESULT = 3,         // worker -> coordinator: task_id + payload
+        NO_MORE_TASKS = 4   // coordinator -> worker: drain and disconnect
+    };
+
+    // ---- Coordinator side -------------------------------------------
+
+    class Coordinator {
+    public:
+        explicit Coordinator(uint16_t port) : port_(port) {}
+
+        // Distribute the task blobs and block until every result is in.
+        // Results are returned in task order regardless of completion
+        // order. Returns false if the listening socket could not be set
+        // up; worker failures are handled by re-dispatch, not errors.
+        bool run(const std::vector<Blob>& tasks, std::vector<Blob>& results) {
+            listen_fd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (listen_fd_ < 0) return false;
+            int one = 1;
+            ::setsockopt(listen_fd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+            addr.sin_port = htons(port_);
+            if (::bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr),
+                       sizeof(addr)) < 0 ||
+                ::listen(listen_fd_, 16) < 0) {
+                ::close(listen_fd_);
+                return false;
+            }
+
+            results.assign(tasks.size(), Blob());
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queue_.clear();
+                for (uint64_t i = 0; i < tasks.size(); i++) {
+                    queue_.push_back(i);
+                }
+                remaining_ = tasks.size();
+            }
+
+            std::thread acceptor([this, &tasks, &results]() {
+                acceptLoop(tasks, results);
+            });
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                done_cv_.wait(lock, [this] { return remaining_ == 0; });
+            }
+
+            // Closing the listening socket unblocks accept(); closing
+            // the worker sockets unblocks their handler threads and
+            // tells lingering workers the run is over
+            ::shutdown(listen_fd_, SHUT_RDWR);
+            ::close(listen_fd_);
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                for (int fd : worker_fds_) {
+                    ::shutdown(fd, SHUT_RDWR);
+                }
+            }
+            acceptor.join();
+            for (auto& t : handlers_) {
+                if (t.joinable()) t.join();
+            }
+            handlers_.clear();
+            return true;
+        }
+
+    private:
+        void acceptLoop(const std::vector<Blob>& tasks,
+                        std::vector<Blob>& results) {
+            while (true) {
+                int fd = ::accept(listen_fd_, nullptr, nullptr);
+                if (fd < 0) return;  // listening socket closed: run is over
+                std::lock_guard<std::mutex> lock(mutex_);
+                handlers_.emplace_back([this, fd, &tasks, &results]() {
+                    serveWorker(fd, tasks, results);
+                });
+            }
+        }
+
+        // One thread per connected worker: answer TASK_REQUESTs from the
+        // shared queue, collect RESULTs, and requeue this worker's
+        // in-flight tasks if the connection dies
+        void serveWorker(int fd, const std::vector<Blob>& tasks,
+                         std::vector<Blob>& results) {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                worker_fds_.push_back(fd);
+            }
+            std::vector<uint64_t> in_flight;
+            uint8_t type;
+            Blob payload;
+            while (readMessage(fd, type, payload)) {
+                if (type == TASK_REQUEST) {
+                    uint64_t id;
+                    bool have = false;
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if (!queue_.empty()) {
+                            id = queue_.front();
+                            queue_.pop_front();
+                            have = true;
+                        }
+                    }
+                    if (!have) {
+                        // Queue is empty right now, but a dropped worker
+                        // may still put tasks back; the worker retries
+                        // until the run ends and its socket is closed
+                        writeMessage(fd, NO_MORE_TASKS, Blob());
+                        continue;
+                    }
+                    in_flight.push_back(id);
+                    Blob framed(8 + tasks[id].size());
+                    std::memcpy(framed.data(), &id, 8);
+                    std::memcpy(framed.data() + 8, tasks[id].data(),
+                                tasks[id].size());
+                    if (!writeMessage(fd, TASK, framed)) break;
+                } else if (type == RESULT && payload.size() >= 8) {
+                    uint64_t id;
+                    std::memcpy(&id, payload.data(), 8);
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    auto it = std::find(in_flight.begin(), in_flight.end(), id);
+                    if (it != in_flight.end()) {
+                        in_flight.erase(it);
+                        results[id].assign(payload.begin() + 8, payload.end());
+                        if (--remaining_ == 0) {
+                            done_cv_.notify_all();
+                        }
+                    }
+                }
+            }
+            ::close(fd);
+
+            // Re-dispatch whatever this worker still held
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (uint64_t id : in_flight) {
+                queue_.push_back(id);
+            }
+        }
+
+        uint16_t port_;
+        int listen_fd_ = -1;
+        std::mutex mutex_;
+        std::condition_variable done_cv_;
+        std::deque<uint64_t> queue_;
+        size_t remaining_ = 0;
+        std::vector<std::thread> handlers_;
+        std::vector<int> worker_fds_;
+    };
+
+    // ---- Worker side ------------------------------------------------
+
+    class Worker {
+    public:
+        // evaluate maps a task payload to its result payload
+        using Evaluator = std::function<Blob(const Blob&)>;
+
+        Worker(const std::string& host, uint16_t port, Evaluator evaluate)
+            : host_(host), port_(port), evaluate_(std::move(evaluate)) {}
+
+        // Pull and evaluate tasks until the coordinator has none left
+        // (or the connection closes). Returns tasks completed.
+        size_t run() {
+            int fd = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (fd < 0) return 0;
+            sockaddr_in addr{};
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(port_);
+            if (::inet_pton(AF_INET, host_.c_str(), &addr.sin_addr) != 1 ||
+                ::connect(fd, reinterpret_cast<sockaddr*>(&addr),
+                          sizeof(addr)) < 0) {
+                ::close(fd);
+                return 0;
+            }
+            int one = 1;
+            ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+            size_t completed = 0;
+            uint8_t type;
+            Blob payload;
+            while (writeMessage(fd, TASK_REQUEST, Blob()) &&
+                   readMessage(fd, type, payload)) {
+                if (type == NO_MORE_TASKS) {
+                    // Empty right now, not necessarily finished: tasks
+                    // from a dropped worker can reappear. Back off and
+                    // re-request; the coordinator closes the socket
+                    // when the run completes.
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                    continue;
+                }
+                if (type != TASK || payload.size() < 8) break;
+                uint64_t id;
+                std::memcpy(&id, payload.data(), 8);
+                Blob task(payload.begin() + 8, payload.end());
+                Blob result = evaluate_(task);
+                Blob framed(8 + result.size());
+                std::memcpy(framed.data(), &id, 8);
+                std::memcpy(framed.data() + 8, result.data(), result.size());
+                if (!writeMessage(fd, RESULT, framed)) break;
+                completed++;
+                if (max_tasks_ > 0 && completed >= max_tasks_) break;
+            }
+            ::close(fd);
+            return completed;
+        }
+
+        // Bound the tasks taken before disconnecting (0 = unlimited);
+        // used by tests to exercise coordinator re-dispatch
+        void setMaxTasks(size_t max_tasks) { max_tasks_ = max_tasks; }
+
+    private:
+        std::string host_;
+        uint16_t port_;
+        Evaluator evaluate_;
+        size_t max_tasks_ = 0;
+    };
+
+private:
+    // ---- Shared framing ---------------------------------------------
+
+    static bool readAll(int fd, void* buffer, size_t length) {
+        uint8_t* out = static_cast<uint8_t*>(buffer);
+        while (length > 0) {
+            ssize_t got = ::recv(fd, out, length, 0);
+            if (got <= 0) return false;
+            out += got;
+            length -= static_cast<size_t>(got);
+        }
+        return true;
+    }
+
+    static bool writeAll(int fd, const void* buffer, size_t length) {
+        const uint8_t* in = static_cast<const uint8_t*>(buffer);
+        while (length > 0) {
+            ssize_t sent = ::send(fd, in, length, MSG_NOSIGNAL);
+            if (sent <= 0) return false;
+            in += sent;
+            length -= static_cast<size_t>(sent);
+        }
+        return true;
+    }
+
+    static bool readMessage(int fd, uint8_t& type, Blob& payload) {
+        uint32_t length;
+        if (!readAll(fd, &length, 4) || !readAll(fd, &type, 1)) return false;
+        payload.resize(length);
+        return length == 0 || readAll(fd, payload.data(), length);
+    }
+
+    static bool writeMessage(int fd, uint8_t type, const Blob& payload) {
+        uint32_t length = static_cast<uint32_t>(payload.size());
+        return writeAll(fd, &length, 4) && writeAll(fd, &type, 1) &&
+               (payload.empty() || writeAll(fd, payload.data(), payload.size()));
+    }
+};
+
+} // namespace circuit
@@ -54,6 +54,71 @@ private:
     Vector3D h_field_;
 };
 
+// Structure-of-arrays container for whole field grids. E/H components are
+// held in contiguous per-component columns so the Poynting, magnitude and
+// power-density kernels below compile to SIMD sweeps over the full grid
+// via Eigen array expressions, instead of per-point Vector3D math.
+class EMFieldGrid {
+public:
+    void reserve(size_t n) {
+        ex_.reserve(n); ey_.reserve(n); ez_.reserve(n);
+        hx_.reserve(n); hy_.reserve(n); hz_.reserve(n);
+        px_.reserve(n); py_.reserve(n); pz_.reserve(n);
+    }
+
+    void append(const Point3D& point, const Vector3D& e, const Vector3D& h) {
+        px_.push_back(point.x); py_.push_back(point.y); pz_.push_back(point.z);
+        ex_.push_back(e.x); ey_.push_back(e.y); ez_.push_back(e.z);
+        hx_.push_back(h.x); hy_.push_back(h.y); hz_.push_back(h.z);
+    }
+
+    size_t size() const { return ex_.size(); }
+
+    void clear() {
+        px_.clear(); py_.clear(); pz_.clear();
+        ex_.clear(); ey_.clear(); ez_.clear();
+        hx_.clear(); hy_.clear(); hz_.clear();
+    }
+
+    // S = E × H for every grid point in three vectorized sweeps
+    void computePoyntingVectors(Eigen::ArrayXd& sx,
+                                Eigen::ArrayXd& sy,
+                                Eigen::ArrayXd& sz) const {
+        auto ex = column(ex_), ey = column(ey_), ez = column(ez_);
+        auto hx = column(hx_), hy = column(hy_), hz = column(hz_);
+        sx = ey * hz - ez * hy;
+        sy = ez * hx - ex * hz;
+        sz = ex * hy - ey * hx;
+    }
+
+    Eigen::ArrayXd eFieldMagnitudes() const {
+        auto ex = column(ex_), ey = column(ey_), ez = column(ez_);
+        return (ex * ex + ey * ey + ez * ez).sqrt();
+    }
+
+    Eigen::ArrayXd hFieldMagnitudes() const {
+        auto hx = column(hx_), hy = column(hy_), hz = column(hz_);
+        return (hx * hx + hy * hy + hz * hz).sqrt();
+    }
+
+    // |S| per grid point; the whole-map version of summing per-point
+    // Poynting magnitudes one EMField at a time
+    Eigen::ArrayXd powerDensityMap() const {
+        Eigen::ArrayXd sx, sy, sz;
+        computePoyntingVectors(sx, sy, sz);
+        return (sx * sx + sy * sy + sz * sz).sqrt();
+    }
+
+private:
+    static Eigen::Map<const Eigen::ArrayXd> column(const std::vector<double>& v) {
+        return Eigen::Map<const Eigen::ArrayXd>(v.data(), v.size());
+    }
+
+    std::vector<double> px_, py_, pz_;
+    std::vector<double> ex_, ey_, ez_;
+    std::vector<double> hx_, hy_, hz_;
+};
+
 class EMSolver {
 public:
     struct Material {
@@ -85,6 +150,11 @@ public:
     std::vector<EMField> getFields() const {
         return fields_;
     }
+
+    // Columnar view over the last solve, populated alongside fields_
+    const EMFieldGrid& getFieldGrid() const {
+        return field_grid_;
+    }
     
     double calculateQFactor(const std::vector<Point3D>& region) const {
         double stored_energy = 0.0;
@@ -233,7 +303,9 @@ private:
     
     void extractFields(const Eigen::VectorXcd& solution) {
         fields_.clear();
-        
+        field_grid_.clear();
+        field_grid_.reserve(mesh_.nodes.size());
+
         // Convert solution to E and H fields
         for (size_t i = 0; i < mesh_.nodes.size(); i++) {
             const auto& point = mesh_.nodes[i];
@@ -253,6 +325,7 @@ private:
             };
             
             fields_.emplace_back(point, e_field, h_field);
+            field_grid_.append(point, e_field, h_field);
         }
     }
     
@@ -261,7 +334,8 @@ private:
     std::vector<std::pair<Point3D, Vector3D>> ports_;
     std::vector<std::pair<Point3D, Vector3D>> boundary_conditions_;
     std::vector<EMField> fields_;
-    
+    EMFieldGrid field_grid_;
+
     Eigen::MatrixXcd A_;
     Eigen::VectorXcd b_;
     
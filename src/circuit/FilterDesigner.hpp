@@ -102,11 +102,83 @@ public:
         
         // Calculate bandwidth and Q factor
         calculateBandwidthAndQ(response);
-        
+
+        return response;
+    }
+
+    // Installs the filter's rational transfer function H(s) = N(s)/D(s)
+    // (coefficients in ascending powers of s) for the batch evaluator
+    void setTransferPolynomials(const std::vector<double>& numerator,
+                                const std::vector<double>& denominator) {
+        numerator_ = numerator;
+        denominator_ = denominator;
+    }
+
+    // Batch characterization path: the polynomial transfer function is
+    // evaluated across the whole frequency array into preallocated
+    // outputs (no per-point push_back, no circuit re-solve), and group
+    // delay falls out of one finite-difference pass over the unwrapped
+    // phase. This is the path the 100k-point production sweeps use.
+    FilterResponse analyzeFilterBatch(const std::vector<double>& frequencies) {
+        FilterResponse response;
+        const size_t count = frequencies.size();
+        response.frequencies = frequencies;
+        response.magnitude.resize(count);
+        response.phase.resize(count);
+        response.group_delay.resize(count);
+        if (count == 0) {
+            return response;
+        }
+
+        // Phase in radians, unwrapped as we go, kept for the group
+        // delay pass
+        std::vector<double> phase_rad(count);
+
+        for (size_t i = 0; i < count; i++) {
+            const Complex s(0.0, 2 * M_PI * frequencies[i]);
+            const Complex h = evaluatePolynomial(numerator_, s) /
+                              evaluatePolynomial(denominator_, s);
+            response.magnitude[i] = 20 * std::log10(std::abs(h));
+            double phase = std::arg(h);
+            if (i > 0) {
+                // Unwrap against the previous point
+                while (phase - phase_rad[i - 1] > M_PI) phase -= 2 * M_PI;
+                while (phase - phase_rad[i - 1] < -M_PI) phase += 2 * M_PI;
+            }
+            phase_rad[i] = phase;
+            response.phase[i] = phase * 180.0 / M_PI;
+        }
+
+        // One vectorizable finite-difference pass for group delay
+        for (size_t i = 0; i + 1 < count; i++) {
+            const double df = frequencies[i + 1] - frequencies[i];
+            response.group_delay[i] =
+                -(phase_rad[i + 1] - phase_rad[i]) / (2 * M_PI * df);
+        }
+        response.group_delay[count - 1] =
+            count > 1 ? response.group_delay[count - 2] : 0.0;
+
+        calculateBandwidthAndQ(response);
         return response;
     }
 
 private:
+    // Horner evaluation of a real-coefficient polynomial at complex s
+    static Complex evaluatePolynomial(const std::vector<double>& coeffs,
+                                      const Complex& s) {
+        if (coeffs.empty()) {
+            return Complex(1.0, 0.0);
+        }
+        Complex result(coeffs.back(), 0.0);
+        for (size_t i = coeffs.size() - 1; i > 0; i--) {
+            result = result * s + coeffs[i - 1];
+        }
+        return result;
+    }
+
+    std::vector<double> numerator_{1.0};
+    std::vector<double> denominator_{1.0};
+
     std::vector<double> calculateCoefficients(const FilterSpecification& spec) {
         std::vector<double> coeffs;
         
@@ -6,9 +6,213 @@
 #include <memory>
 #include <chrono>
 #include <functional>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <thread>
 
 namespace circuit {
 
+// Pipelined barcode-scan ingestion. A scan is acknowledged the moment
+// it lands in the lock-free ring (the scan-to-beep path touches no
+// locks and no storage), then worker threads drain the ring in batches,
+// validate and classify each scan, and hand the results to a batched
+// record sink — typically the write-behind storage tier. Operators at
+// peak line speed never wait on the pipeline; a full ring (sustained
+// overrun) is the only condition that rejects a scan.
+class ScanIngestPipeline {
+public:
+    struct Scan {
+        std::string barcode;
+        std::string operator_id;
+        std::string station_id;
+        int64_t timestamp_ms;
+    };
+
+    struct ProcessedScan {
+        Scan scan;
+        bool valid;
+        int category;  // ManualRecyclingSystem::SortingCategory
+    };
+
+    // Immediate optimistic acknowledgment for the scanner UI
+    struct Ack {
+        bool accepted;
+        uint64_t sequence;  // ingestion order, for later reconciliation
+    };
+
+    using BatchSink = std::function<void(const std::vector<ProcessedScan>&)>;
+    using Validator = std::function<bool(const Scan&)>;
+    using Classifier = std::function<int(const Scan&)>;
+
+    ScanIngestPipeline() {
+        for (size_t i = 0; i < kCapacity; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~ScanIngestPipeline() { stop(); }
+
+    ScanIngestPipeline(const ScanIngestPipeline&) = delete;
+    ScanIngestPipeline& operator=(const ScanIngestPipeline&) = delete;
+
+    void setBatchSink(BatchSink sink) { sink_ = std::move(sink); }
+    void setValidator(Validator validator) { validator_ = std::move(validator); }
+    void setClassifier(Classifier classifier) { classifier_ = std::move(classifier); }
+
+    void start(unsigned num_workers = 1) {
+        if (running_.exchange(true)) {
+            return;
+        }
+        for (unsigned i = 0; i < num_workers; i++) {
+            workers_.emplace_back([this]() { workerLoop(); });
+        }
+    }
+
+    void stop() {
+        if (!running_.exchange(false)) {
+            return;
+        }
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+        workers_.clear();
+        drainOnce();  // anything still queued is processed inline
+    }
+
+    // Scan-to-beep path: one CAS into the ring, no locks, no storage
+    Ack submitScan(const Scan& scan) {
+        uint64_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & (kCapacity - 1)];
+            const uint64_t seq = cell.sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+                    cell.scan = scan;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    submitted_.fetch_add(1, std::memory_order_relaxed);
+                    return {true, pos};
+                }
+            } else if (diff < 0) {
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return {false, 0};  // ring full: sustained overrun
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    uint64_t submittedCount() const { return submitted_.load(std::memory_order_relaxed); }
+    uint64_t processedCount() const { return processed_.load(std::memory_order_relaxed); }
+    uint64_t rejectedCount() const { return rejected_.load(std::memory_order_relaxed); }
+    uint64_t invalidCount() const { return invalid_.load(std::memory_order_relaxed); }
+
+    // Blocks until everything submitted so far has been processed
+    void drain() {
+        while (processedCount() < submittedCount()) {
+            if (workers_.empty()) {
+                drainOnce();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    static constexpr size_t kCapacity = 4096;  // power of two
+    static constexpr size_t kBatchSize = 64;
+
+    struct Cell {
+        std::atomic<uint64_t> sequence;
+        Scan scan;
+    };
+
+    bool tryPop(Scan& out) {
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & (kCapacity - 1)];
+            const uint64_t seq = cell.sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seq) -
+                                 static_cast<int64_t>(pos + 1);
+            if (diff == 0) {
+                if (head_.compare_exchange_weak(pos, pos + 1,
+                                                std::memory_order_relaxed)) {
+                    out = cell.scan;
+                    cell.sequence.store(pos + kCapacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // empty
+            } else {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void processBatch(std::vector<ProcessedScan>& batch) {
+        for (auto& item : batch) {
+            item.valid = !validator_ || validator_(item.scan);
+            if (!item.valid) {
+                invalid_.fetch_add(1, std::memory_order_relaxed);
+            }
+            item.category = classifier_ ? classifier_(item.scan) : 0;
+        }
+        if (sink_) {
+            sink_(batch);
+        }
+        processed_.fetch_add(batch.size(), std::memory_order_relaxed);
+    }
+
+    void drainOnce() {
+        std::vector<ProcessedScan> batch;
+        Scan scan;
+        while (tryPop(scan)) {
+            batch.push_back({scan, false, 0});
+            if (batch.size() >= kBatchSize) {
+                processBatch(batch);
+                batch.clear();
+            }
+        }
+        if (!batch.empty()) {
+            processBatch(batch);
+        }
+    }
+
+    void workerLoop() {
+        std::vector<ProcessedScan> batch;
+        batch.reserve(kBatchSize);
+        while (running_.load(std::memory_order_relaxed)) {
+            batch.clear();
+            Scan scan;
+            while (batch.size() < kBatchSize && tryPop(scan)) {
+                batch.push_back({scan, false, 0});
+            }
+            if (batch.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            processBatch(batch);
+        }
+    }
+
+    std::array<Cell, kCapacity> cells_;
+    std::atomic<uint64_t> tail_{0};
+    std::atomic<uint64_t> head_{0};
+    std::atomic<bool> running_{false};
+    std::vector<std::thread> workers_;
+
+    BatchSink sink_;
+    Validator validator_;
+    Classifier classifier_;
+
+    std::atomic<uint64_t> submitted_{0};
+    std::atomic<uint64_t> processed_{0};
+    std::atomic<uint64_t> rejected_{0};
+    std::atomic<uint64_t> invalid_{0};
+};
+
 class ManualRecyclingSystem {
 public:
     // Operator status tracking
@@ -92,6 +296,24 @@ public:
         initializeWorkstations();
         loadSafetyProtocols();
         setupQualityControls();
+        scan_pipeline_.setClassifier([](const ScanIngestPipeline::Scan& scan) {
+            return static_cast<int>(classifyBarcode(scan.barcode));
+        });
+    }
+
+    // Pipelined scan ingestion; callers wire the batch sink to the
+    // storage tier and call start() before line operation
+    ScanIngestPipeline& scanPipeline() { return scan_pipeline_; }
+
+    // Barcode prefix determines the sorting category at the line
+    static SortingCategory classifyBarcode(const std::string& barcode) {
+        if (barcode.rfind("PCB", 0) == 0) return SortingCategory::CIRCUIT_BOARDS;
+        if (barcode.rfind("PSU", 0) == 0) return SortingCategory::POWER_SUPPLIES;
+        if (barcode.rfind("DSP", 0) == 0) return SortingCategory::DISPLAYS;
+        if (barcode.rfind("CBL", 0) == 0) return SortingCategory::CABLES_WIRING;
+        if (barcode.rfind("MEC", 0) == 0) return SortingCategory::MECHANICAL_PARTS;
+        if (barcode.rfind("BAT", 0) == 0) return SortingCategory::BATTERIES;
+        return SortingCategory::UNKNOWN;
     }
 
     // Operator management
@@ -378,6 +600,7 @@ private:
     }
 
     std::map<std::string, double> quality_thresholds_;
+    ScanIngestPipeline scan_pipeline_;
 };
 
 } // namespace circuit
@@ -6,7 +6,9 @@
 #include <bsoncxx/json.hpp>
 #include <mongocxx/client.hpp>
 #include <mongocxx/instance.hpp>
+#include <mongocxx/pool.hpp>
 #include <mongocxx/uri.hpp>
+#include <mongocxx/options/insert.hpp>
 #include "SecurityManager.hpp"
 #include "DatabaseManager.hpp"
 
@@ -51,9 +53,14 @@ public:
         
         client_ = std::make_unique<mongocxx::client>(
             mongocxx::uri{config.uri}, client_options);
-        
+
         db_ = (*client_)[config.database];
-        
+
+        // Pooled clients for the bulk ingest paths; concurrent backfill
+        // workers each acquire their own connection instead of serializing
+        // on the single client above
+        pool_ = std::make_unique<mongocxx::pool>(mongocxx::uri{config.uri});
+
         setupCollections();
         createIndices();
     }
@@ -170,6 +177,111 @@ public:
         }
     }
 
+    // Bulk ingest for component documents: batches are sent through
+    // insert_many with unordered execution on a pooled connection, so the
+    // server parallelizes writes and one bad document does not abort the
+    // rest of its batch.
+    size_t saveComponentsBulk(
+        const std::vector<DatabaseManager::ComponentRecord>& components,
+        size_t batch_size = 1000) {
+        size_t inserted = 0;
+        try {
+            auto client = pool_->acquire();
+            auto collection =
+                (*client)[config_.database][config_.components_collection];
+
+            mongocxx::options::insert options;
+            options.ordered(false);
+
+            std::vector<bsoncxx::document::value> batch;
+            batch.reserve(batch_size);
+
+            for (const auto& component : components) {
+                auto doc = bsoncxx::builder::stream::document{}
+                    << "_id" << component.id
+                    << "type" << component.type
+                    << "manufacturer" << component.manufacturer
+                    << "received_date" << bsoncxx::types::b_date{
+                        component.received_date}
+                    << "condition" << component.condition
+                    << "weight" << component.weight
+                    << bsoncxx::builder::stream::finalize;
+                batch.push_back(std::move(doc));
+
+                if (batch.size() >= batch_size) {
+                    auto result = collection.insert_many(batch, options);
+                    if (result) {
+                        inserted += result->inserted_count();
+                    }
+                    batch.clear();
+                }
+            }
+            if (!batch.empty()) {
+                auto result = collection.insert_many(batch, options);
+                if (result) {
+                    inserted += result->inserted_count();
+                }
+            }
+        }
+        catch (const std::exception& e) {
+            last_error_ = e.what();
+        }
+        return inserted;
+    }
+
+    // Bulk metric ingest; same unordered insert_many batching as
+    // saveComponentsBulk, sized for the telemetry backfill path
+    size_t saveMetricsBulk(
+        const std::vector<std::tuple<std::string,
+                                     std::map<std::string, double>,
+                                     std::chrono::system_clock::time_point>>& metrics,
+        size_t batch_size = 1000) {
+        size_t inserted = 0;
+        try {
+            auto client = pool_->acquire();
+            auto collection =
+                (*client)[config_.database][config_.metrics_collection];
+
+            mongocxx::options::insert options;
+            options.ordered(false);
+
+            std::vector<bsoncxx::document::value> batch;
+            batch.reserve(batch_size);
+
+            for (const auto& [metric_type, values, timestamp] : metrics) {
+                auto builder = bsoncxx::builder::stream::document{};
+                builder << "type" << metric_type
+                        << "timestamp" << bsoncxx::types::b_date{timestamp};
+
+                auto values_doc = bsoncxx::builder::stream::document{};
+                for (const auto& [key, value] : values) {
+                    values_doc << key << value;
+                }
+                builder << "values" << values_doc;
+
+                batch.push_back(builder << bsoncxx::builder::stream::finalize);
+
+                if (batch.size() >= batch_size) {
+                    auto result = collection.insert_many(batch, options);
+                    if (result) {
+                        inserted += result->inserted_count();
+                    }
+                    batch.clear();
+                }
+            }
+            if (!batch.empty()) {
+                auto result = collection.insert_many(batch, options);
+                if (result) {
+                    inserted += result->inserted_count();
+                }
+            }
+        }
+        catch (const std::exception& e) {
+            last_error_ = e.what();
+        }
+        return inserted;
+    }
+
     // Aggregation pipeline for analytics
     std::vector<bsoncxx::document::value> runAggregation(
         const std::string& collection,
@@ -198,6 +310,7 @@ private:
     std::shared_ptr<SecurityManager> security_manager_;
     MongoConfig config_;
     std::unique_ptr<mongocxx::client> client_;
+    std::unique_ptr<mongocxx::pool> pool_;
     mongocxx::database db_;
     std::string last_error_;
 
@@ -8,6 +8,10 @@
 #include <sstream>
 #include <optional>
 #include <filesystem>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 namespace circuit {
 
@@ -26,11 +30,74 @@ public:
     }
 
     ~PersistentStorage() {
+        stopWriter();
+        for (auto& entry : statement_cache_) {
+            sqlite3_finalize(entry.second);
+        }
         if (db_) {
             sqlite3_close(db_);
         }
     }
 
+    // Execute a parameterized statement through the prepared-statement
+    // cache: the SQL is compiled once and re-bound per call, avoiding the
+    // per-operation parse that sqlite3_exec pays
+    bool executePrepared(const std::string& sql,
+                         const std::vector<std::string>& params) {
+        sqlite3_stmt* stmt = getPreparedStatement(sql);
+        if (!stmt) {
+            return false;
+        }
+        return bindAndStep(stmt, params);
+    }
+
+    // Batched write path: all rows run through one cached prepared
+    // statement inside a single explicit transaction. With WAL mode this
+    // turns ~60 writes/sec of implicit per-insert transactions into tens
+    // of thousands per second.
+    bool executeBatch(const std::string& sql,
+                      const std::vector<std::vector<std::string>>& rows) {
+        sqlite3_stmt* stmt = getPreparedStatement(sql);
+        if (!stmt) {
+            return false;
+        }
+
+        if (!beginTransaction()) {
+            return false;
+        }
+        for (const auto& row : rows) {
+            if (!bindAndStep(stmt, row)) {
+                rollbackTransaction();
+                return false;
+            }
+        }
+        return commitTransaction();
+    }
+
+    // Queue a write for the background writer thread; returns immediately
+    // so line-side callers never block on disk. Queued writes are drained
+    // in transaction-sized batches.
+    void enqueueWrite(const std::string& sql,
+                      const std::vector<std::string>& params) {
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            if (!writer_running_) {
+                writer_running_ = true;
+                writer_thread_ = std::thread(&PersistentStorage::writerLoop, this);
+            }
+            write_queue_.push_back({sql, params});
+        }
+        write_cv_.notify_one();
+    }
+
+    // Block until every queued write has been committed
+    void flushWrites() {
+        std::unique_lock<std::mutex> lock(write_mutex_);
+        write_drained_cv_.wait(lock, [this] {
+            return write_queue_.empty() && !writer_busy_;
+        });
+    }
+
     bool executeQuery(const std::string& query) {
         char* error_message = nullptr;
         int result = sqlite3_exec(db_, 
@@ -133,17 +200,122 @@ public:
     }
 
 private:
+    struct PendingWrite {
+        std::string sql;
+        std::vector<std::string> params;
+    };
+
+    // Writes per background transaction; large enough to amortize the
+    // commit, small enough to keep flush latency low
+    static constexpr size_t kWriteBatchSize = 512;
+
     sqlite3* db_;
     std::string db_path_;
     std::string last_error_;
 
+    std::map<std::string, sqlite3_stmt*> statement_cache_;
+
+    std::deque<PendingWrite> write_queue_;
+    std::mutex write_mutex_;
+    std::condition_variable write_cv_;
+    std::condition_variable write_drained_cv_;
+    std::thread writer_thread_;
+    bool writer_running_ = false;
+    bool writer_stop_ = false;
+    bool writer_busy_ = false;
+
+    sqlite3_stmt* getPreparedStatement(const std::string& sql) {
+        auto it = statement_cache_.find(sql);
+        if (it != statement_cache_.end()) {
+            return it->second;
+        }
+
+        sqlite3_stmt* stmt = nullptr;
+        if (sqlite3_prepare_v2(db_, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK) {
+            last_error_ = sqlite3_errmsg(db_);
+            return nullptr;
+        }
+        statement_cache_[sql] = stmt;
+        return stmt;
+    }
+
+    bool bindAndStep(sqlite3_stmt* stmt, const std::vector<std::string>& params) {
+        sqlite3_reset(stmt);
+        sqlite3_clear_bindings(stmt);
+        for (size_t i = 0; i < params.size(); i++) {
+            if (sqlite3_bind_text(stmt, static_cast<int>(i + 1),
+                                  params[i].c_str(), -1,
+                                  SQLITE_TRANSIENT) != SQLITE_OK) {
+                last_error_ = sqlite3_errmsg(db_);
+                return false;
+            }
+        }
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            last_error_ = sqlite3_errmsg(db_);
+            return false;
+        }
+        return true;
+    }
+
+    void writerLoop() {
+        while (true) {
+            std::vector<PendingWrite> batch;
+            {
+                std::unique_lock<std::mutex> lock(write_mutex_);
+                write_cv_.wait(lock, [this] {
+                    return writer_stop_ || !write_queue_.empty();
+                });
+                if (writer_stop_ && write_queue_.empty()) {
+                    return;
+                }
+                while (!write_queue_.empty() && batch.size() < kWriteBatchSize) {
+                    batch.push_back(std::move(write_queue_.front()));
+                    write_queue_.pop_front();
+                }
+                writer_busy_ = true;
+            }
+
+            beginTransaction();
+            for (const auto& write : batch) {
+                executePrepared(write.sql, write.params);
+            }
+            commitTransaction();
+
+            {
+                std::lock_guard<std::mutex> lock(write_mutex_);
+                writer_busy_ = false;
+            }
+            write_drained_cv_.notify_all();
+        }
+    }
+
+    void stopWriter() {
+        {
+            std::lock_guard<std::mutex> lock(write_mutex_);
+            if (!writer_running_) {
+                return;
+            }
+            writer_stop_ = true;
+        }
+        write_cv_.notify_all();
+        if (writer_thread_.joinable()) {
+            writer_thread_.join();
+        }
+        writer_running_ = false;
+    }
+
     void initializeDatabase() {
         // Open database
         if (sqlite3_open(db_path_.c_str(), &db_) != SQLITE_OK) {
-            throw std::runtime_error("Failed to open database: " + 
+            throw std::runtime_error("Failed to open database: " +
                                    std::string(sqlite3_errmsg(db_)));
         }
 
+        // WAL lets the background writer commit without blocking readers,
+        // and NORMAL sync is sufficient with WAL's crash guarantees
+        executeQuery("PRAGMA journal_mode=WAL;");
+        executeQuery("PRAGMA synchronous=NORMAL;");
+
         // Create tables if they don't exist
         createTables();
     }
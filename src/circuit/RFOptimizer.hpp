@@ -5,6 +5,8 @@
 #include <functional>
 #include <random>
 #include <algorithm>
+#include <numeric>
+#include <map>
 
 namespace circuit {
 
@@ -49,6 +51,51 @@ public:
         measurement_func_ = func;
     }
 
+    // Cache fitness values keyed on quantized parameter vectors, so
+    // candidates that land in the same quantization cell reuse the solver
+    // result instead of re-running the full circuit analysis. Cached
+    // samples also feed the surrogate used by screenCandidates().
+    void enableFitnessCache(int quantization_levels = 4096) {
+        fitness_cache_enabled_ = true;
+        quantization_levels_ = quantization_levels;
+        fitness_cache_.clear();
+        sample_archive_.clear();
+    }
+
+    size_t getCacheHits() const { return cache_hits_; }
+    size_t getCacheMisses() const { return cache_misses_; }
+
+    // Surrogate screening: rank candidates by an inverse-distance-weighted
+    // prediction over the archive of real solver results and return the
+    // indices of the most promising fraction. Only those should be sent to
+    // evaluateFitness; the rest are skipped for this generation.
+    std::vector<size_t> screenCandidates(
+        const std::vector<std::vector<Parameter>>& candidates,
+        double fraction = 0.25) const {
+        std::vector<size_t> indices(candidates.size());
+        std::iota(indices.begin(), indices.end(), size_t{0});
+
+        if (sample_archive_.size() < 8) {
+            // Not enough real samples to trust the surrogate yet
+            return indices;
+        }
+
+        std::vector<double> predicted(candidates.size());
+        for (size_t i = 0; i < candidates.size(); i++) {
+            predicted[i] = predictFitness(candidates[i]);
+        }
+
+        std::sort(indices.begin(), indices.end(),
+                  [&predicted](size_t a, size_t b) {
+                      return predicted[a] > predicted[b];
+                  });
+
+        size_t keep = std::max<size_t>(
+            1, static_cast<size_t>(candidates.size() * fraction));
+        indices.resize(keep);
+        return indices;
+    }
+
     std::vector<Parameter> optimizeGeneticAlgorithm(
         int population_size = 100,
         int generations = 50,
@@ -184,7 +231,7 @@ public:
         return global_best;
     }
 
-private:
+protected:
     std::vector<Parameter> generateRandomIndividual() {
         std::vector<Parameter> individual = parameters_;
         for (auto& param : individual) {
@@ -203,6 +250,27 @@ private:
     }
 
     double evaluateFitness(const std::vector<Parameter>& individual) {
+        std::vector<long long> key;
+        if (fitness_cache_enabled_) {
+            key = quantizeParameters(individual);
+            auto it = fitness_cache_.find(key);
+            if (it != fitness_cache_.end()) {
+                ++cache_hits_;
+                return it->second;
+            }
+            ++cache_misses_;
+        }
+
+        double fitness = evaluateFitnessUncached(individual);
+
+        if (fitness_cache_enabled_) {
+            fitness_cache_[key] = fitness;
+            sample_archive_.push_back({individual, fitness});
+        }
+        return fitness;
+    }
+
+    double evaluateFitnessUncached(const std::vector<Parameter>& individual) {
         // Apply parameters to circuit
         for (const auto& param : individual) {
             // Find component and set parameter
@@ -281,11 +349,67 @@ private:
         return std::uniform_real_distribution<double>(min, max)(rng_);
     }
 
+    double uniformReal(double min, double max) {
+        return uniformDist(min, max);
+    }
+
+    int uniformInt(int min, int max) {
+        return std::uniform_int_distribution<int>(min, max)(rng_);
+    }
+
+    // Map a parameter vector to its quantization cell within the bounds
+    std::vector<long long> quantizeParameters(
+        const std::vector<Parameter>& individual) const {
+        std::vector<long long> key;
+        key.reserve(individual.size());
+        for (const auto& param : individual) {
+            double range = param.max_value - param.min_value;
+            double normalized = range > 0.0
+                ? (param.current_value - param.min_value) / range
+                : 0.0;
+            key.push_back(static_cast<long long>(
+                normalized * quantization_levels_));
+        }
+        return key;
+    }
+
+    // Inverse-distance-weighted surrogate over the archived real samples
+    double predictFitness(const std::vector<Parameter>& individual) const {
+        double weighted_sum = 0.0;
+        double weight_total = 0.0;
+        for (const auto& sample : sample_archive_) {
+            double dist2 = 0.0;
+            for (size_t j = 0; j < individual.size(); j++) {
+                double range = individual[j].max_value - individual[j].min_value;
+                double d = range > 0.0
+                    ? (individual[j].current_value -
+                       sample.first[j].current_value) / range
+                    : 0.0;
+                dist2 += d * d;
+            }
+            if (dist2 < 1e-12) {
+                return sample.second;
+            }
+            double weight = 1.0 / dist2;
+            weighted_sum += weight * sample.second;
+            weight_total += weight;
+        }
+        return weighted_sum / weight_total;
+    }
+
     CircuitAnalyzer& analyzer_;
     std::vector<Parameter> parameters_;
     std::vector<Objective> objectives_;
     std::function<std::vector<double>(const std::vector<Parameter>&)> measurement_func_;
     std::mt19937 rng_;
+
+    // Fitness cache and surrogate archive (see enableFitnessCache)
+    bool fitness_cache_enabled_ = false;
+    int quantization_levels_ = 4096;
+    std::map<std::vector<long long>, double> fitness_cache_;
+    std::vector<std::pair<std::vector<Parameter>, double>> sample_archive_;
+    size_t cache_hits_ = 0;
+    size_t cache_misses_ = 0;
 };
 
 } // namespace circuit
@@ -6,6 +6,9 @@
 #include <string>
 #include <cmath>
 #include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
 
 namespace circuit {
 
@@ -256,6 +259,93 @@ public:
         }
     };
 
+    // Columnar store for per-component throughput metrics. Each processed
+    // material appends one row across dense parallel arrays (material
+    // class, weight, recovered value, outcome, timestamp), so the standard
+    // shift-report queries are single linear sweeps over contiguous memory
+    // instead of iterating per-object records — sub-second on a
+    // million-component day.
+    class MetricsStore {
+    public:
+        static constexpr size_t kMaterialTypes = 7;
+
+        struct ShiftReport {
+            size_t total_processed = 0;
+            size_t successful = 0;
+            double total_weight_kg = 0.0;
+            double total_recovered_value = 0.0;
+            std::array<double, kMaterialTypes> weight_by_material{};
+            std::array<double, kMaterialTypes> value_by_material{};
+            std::array<size_t, kMaterialTypes> count_by_material{};
+        };
+
+        void record(MaterialType material, double weight_kg,
+                    double recovered_value, bool success,
+                    std::chrono::system_clock::time_point timestamp) {
+            material_.push_back(static_cast<uint8_t>(material));
+            weight_.push_back(weight_kg);
+            value_.push_back(recovered_value);
+            outcome_.push_back(success ? 1 : 0);
+            timestamp_.push_back(
+                std::chrono::duration_cast<std::chrono::seconds>(
+                    timestamp.time_since_epoch()).count());
+        }
+
+        size_t size() const { return material_.size(); }
+
+        // One pass over all columns, accumulating every standard report
+        // figure at once; rows outside [start, end) are skipped
+        ShiftReport aggregate(std::chrono::system_clock::time_point start,
+                              std::chrono::system_clock::time_point end) const {
+            int64_t start_s = std::chrono::duration_cast<std::chrono::seconds>(
+                start.time_since_epoch()).count();
+            int64_t end_s = std::chrono::duration_cast<std::chrono::seconds>(
+                end.time_since_epoch()).count();
+
+            ShiftReport report;
+            for (size_t i = 0; i < material_.size(); i++) {
+                if (timestamp_[i] < start_s || timestamp_[i] >= end_s) {
+                    continue;
+                }
+                size_t m = material_[i];
+                report.total_processed++;
+                report.successful += outcome_[i];
+                report.total_weight_kg += weight_[i];
+                report.total_recovered_value += value_[i];
+                report.weight_by_material[m] += weight_[i];
+                report.value_by_material[m] += value_[i];
+                report.count_by_material[m]++;
+            }
+            return report;
+        }
+
+        // Recovered value per kilogram for one material class
+        double yield(MaterialType material,
+                     std::chrono::system_clock::time_point start,
+                     std::chrono::system_clock::time_point end) const {
+            ShiftReport report = aggregate(start, end);
+            size_t m = static_cast<size_t>(material);
+            return report.weight_by_material[m] > 0.0
+                ? report.value_by_material[m] / report.weight_by_material[m]
+                : 0.0;
+        }
+
+        void clear() {
+            material_.clear();
+            weight_.clear();
+            value_.clear();
+            outcome_.clear();
+            timestamp_.clear();
+        }
+
+    private:
+        std::vector<uint8_t> material_;
+        std::vector<double> weight_;
+        std::vector<double> value_;
+        std::vector<uint8_t> outcome_;
+        std::vector<int64_t> timestamp_;
+    };
+
     // Main recycling system methods
     RecyclingSystem() {
         initializeProcessors();
@@ -287,8 +377,13 @@ public:
         return recovered_materials_;
     }
 
+    const MetricsStore& getMetrics() const {
+        return metrics_;
+    }
+
 private:
     std::vector<RecyclableComponent> recyclable_components_;
+    MetricsStore metrics_;
     std::vector<std::unique_ptr<ProcessingUnit>> processors_;
     std::vector<std::pair<MaterialType, MaterialProperties>> recovered_materials_;
 
@@ -325,6 +420,12 @@ private:
         // Store recovered material
         recovered_materials_.push_back({type, output});
 
+        metrics_.record(type, output.quantity,
+                        output.quantity * output.marketValue *
+                            output.recoveryEfficiency,
+                        output.recoveryEfficiency > 0.0,
+                        std::chrono::system_clock::now());
+
         return total_cost;
     }
 
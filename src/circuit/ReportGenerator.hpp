@@ -3,7 +3,12 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <pdfcpp/pdf.hpp>
 #include <xlsxwriter.h>
 #include "DatabaseManager.hpp"
@@ -47,10 +52,168 @@ public:
         return false;
     }
 
+    // Values substituted into a section template's placeholders
+    using SectionValues = std::map<std::string, std::string>;
+
+    // One render job for the batch pipeline
+    struct SectionJob {
+        std::string template_name;
+        SectionValues values;
+    };
+
+    // Registers a section template once; the text is compiled into a
+    // literal/placeholder token list so batch renders never re-parse it.
+    // Placeholders use {name} syntax.
+    void registerSectionTemplate(const std::string& name,
+                                 const std::string& text) {
+        templates_[name] = compileTemplate(text);
+    }
+
+    // Batch section rendering for the nightly exports. Each job is
+    // hashed over its template name and values; a hash hit reuses the
+    // cached string from the previous run (most per-shift sections are
+    // unchanged night to night). Misses are rendered in parallel from
+    // the precompiled templates, then results are assembled in job
+    // order so the report layout is deterministic.
+    std::vector<std::string> renderSections(const std::vector<SectionJob>& jobs,
+                                            unsigned num_threads = 0) {
+        std::vector<std::string> rendered(jobs.size());
+        std::vector<uint64_t> hashes(jobs.size());
+        std::vector<size_t> misses;
+
+        for (size_t i = 0; i < jobs.size(); i++) {
+            hashes[i] = hashJob(jobs[i]);
+            auto it = section_cache_.find(jobs[i].template_name);
+            if (it != section_cache_.end() && it->second.content_hash == hashes[i]) {
+                rendered[i] = it->second.rendered;
+            } else {
+                misses.push_back(i);
+            }
+        }
+
+        if (!misses.empty()) {
+            if (num_threads == 0) {
+                num_threads = std::thread::hardware_concurrency();
+                if (num_threads == 0) num_threads = 2;
+            }
+            std::atomic<size_t> cursor{0};
+            auto worker = [&]() {
+                size_t m;
+                while ((m = cursor.fetch_add(1)) < misses.size()) {
+                    const size_t i = misses[m];
+                    rendered[i] = renderFromTemplate(jobs[i].template_name,
+                                                     jobs[i].values);
+                }
+            };
+            if (num_threads <= 1 || misses.size() == 1) {
+                worker();
+            } else {
+                std::vector<std::thread> threads;
+                for (unsigned t = 0; t < num_threads; t++) {
+                    threads.emplace_back(worker);
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            }
+            for (size_t i : misses) {
+                section_cache_[jobs[i].template_name] = {hashes[i], rendered[i]};
+            }
+        }
+
+        return rendered;
+    }
+
+    size_t cachedSectionCount() const { return section_cache_.size(); }
+
 private:
     std::shared_ptr<DatabaseManager> db_;
     std::shared_ptr<AutodeskIntegration> autodesk_;
 
+    // Precompiled template: literals and placeholder names in order
+    struct CompiledTemplate {
+        struct Token {
+            bool is_placeholder;
+            std::string text;  // literal text or placeholder name
+        };
+        std::vector<Token> tokens;
+        size_t literal_length = 0;  // for output preallocation
+    };
+
+    struct CachedSection {
+        uint64_t content_hash;
+        std::string rendered;
+    };
+
+    std::map<std::string, CompiledTemplate> templates_;
+    std::map<std::string, CachedSection> section_cache_;
+
+    static CompiledTemplate compileTemplate(const std::string& text) {
+        CompiledTemplate compiled;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            const size_t open = text.find('{', pos);
+            if (open == std::string::npos) {
+                compiled.tokens.push_back({false, text.substr(pos)});
+                compiled.literal_length += text.size() - pos;
+                break;
+            }
+            const size_t close = text.find('}', open + 1);
+            if (close == std::string::npos) {
+                compiled.tokens.push_back({false, text.substr(pos)});
+                compiled.literal_length += text.size() - pos;
+                break;
+            }
+            if (open > pos) {
+                compiled.tokens.push_back({false, text.substr(pos, open - pos)});
+                compiled.literal_length += open - pos;
+            }
+            compiled.tokens.push_back({true, text.substr(open + 1, close - open - 1)});
+            pos = close + 1;
+        }
+        return compiled;
+    }
+
+    std::string renderFromTemplate(const std::string& template_name,
+                                   const SectionValues& values) const {
+        const auto it = templates_.find(template_name);
+        if (it == templates_.end()) {
+            return std::string();
+        }
+        const CompiledTemplate& compiled = it->second;
+        std::string out;
+        out.reserve(compiled.literal_length + 32 * values.size());
+        for (const auto& token : compiled.tokens) {
+            if (!token.is_placeholder) {
+                out += token.text;
+            } else {
+                const auto value = values.find(token.text);
+                if (value != values.end()) {
+                    out += value->second;
+                }
+            }
+        }
+        return out;
+    }
+
+    // FNV-1a over the template name and the sorted key/value pairs;
+    // SectionValues is an ordered map, so iteration order is stable
+    static uint64_t hashJob(const SectionJob& job) {
+        uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const std::string& s) {
+            for (unsigned char c : s) {
+                hash = (hash ^ c) * 1099511628211ull;
+            }
+            hash = (hash ^ 0xff) * 1099511628211ull;
+        };
+        mix(job.template_name);
+        for (const auto& entry : job.values) {
+            mix(entry.first);
+            mix(entry.second);
+        }
+        return hash;
+    }
+
     bool generatePdfReport(const ReportConfig& config,
                           const std::string& output_path) {
         try {
@@ -0,0 +1,264 @@
+#pragma once
+
+#include "Component.hpp"
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace circuit {
+
+// Streaming sink for S-parameter sweeps. Each frequency point is appended
+// to a memory-mapped binary Touchstone-like file as soon as it is computed,
+// so export cost overlaps with the sweep and peak RSS stays flat instead of
+// buffering gigabytes of complex data until the sweep finishes.
+//
+// File layout:
+//   SParameterFileHeader
+//   point records: [frequency, re/im pairs for all num_ports^2 parameters]
+//   index block (written by finalize()): float64 frequency per point, for
+//   binary-searched random access without scanning the records
+class SParameterStreamWriter {
+public:
+    struct FileHeader {
+        uint32_t magic;        // 'EVSP'
+        uint32_t version;
+        uint32_t num_ports;
+        uint32_t reserved;
+        uint64_t point_count;
+        uint64_t index_offset; // 0 until finalize()
+    };
+
+    SParameterStreamWriter(const std::string& path, uint32_t num_ports,
+                           size_t initial_capacity_points = 4096)
+        : num_ports_(num_ports)
+        , record_doubles_(1 + 2 * static_cast<size_t>(num_ports) * num_ports) {
+        fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd_ < 0) {
+            return;
+        }
+        remap(sizeof(FileHeader) +
+              initial_capacity_points * record_doubles_ * sizeof(double));
+        if (mapping_) {
+            FileHeader header{};
+            header.magic = kMagic;
+            header.version = 1;
+            header.num_ports = num_ports_;
+            header.point_count = 0;
+            header.index_offset = 0;
+            std::memcpy(mapping_, &header, sizeof(header));
+        }
+    }
+
+    bool isOpen() const { return mapping_ != nullptr; }
+
+    // Append one frequency point; s_params holds num_ports^2 complex values
+    bool appendPoint(double frequency, const std::vector<Complex>& s_params) {
+        if (!mapping_ || s_params.size() != static_cast<size_t>(num_ports_) * num_ports_) {
+            return false;
+        }
+
+        size_t record_bytes = record_doubles_ * sizeof(double);
+        size_t offset = sizeof(FileHeader) + point_count_ * record_bytes;
+        if (offset + record_bytes > mapped_size_) {
+            // Double the data region; the sweep keeps writing while the
+            // kernel flushes already-written pages behind us
+            if (!remap(mapped_size_ * 2)) {
+                return false;
+            }
+        }
+
+        double* record = reinterpret_cast<double*>(
+            static_cast<char*>(mapping_) + offset);
+        record[0] = frequency;
+        for (size_t i = 0; i < s_params.size(); i++) {
+            record[1 + 2 * i] = s_params[i].real();
+            record[2 + 2 * i] = s_params[i].imag();
+        }
+
+        frequencies_.push_back(frequency);
+        header()->point_count = ++point_count_;
+        return true;
+    }
+
+    // Write the frequency index block, trim the file and unmap
+    bool finalize() {
+        if (!mapping_) {
+            return false;
+        }
+
+        size_t record_bytes = record_doubles_ * sizeof(double);
+        size_t data_end = sizeof(FileHeader) + point_count_ * record_bytes;
+        size_t index_bytes = frequencies_.size() * sizeof(double);
+        size_t final_size = data_end + index_bytes;
+
+        if (final_size > mapped_size_ && !remap(final_size)) {
+            return false;
+        }
+
+        std::memcpy(static_cast<char*>(mapping_) + data_end,
+                    frequencies_.data(), index_bytes);
+        header()->index_offset = data_end;
+
+        ::msync(mapping_, final_size, MS_SYNC);
+        ::munmap(mapping_, mapped_size_);
+        mapping_ = nullptr;
+        if (::ftruncate(fd_, final_size) != 0) {
+            ::close(fd_);
+            fd_ = -1;
+            return false;
+        }
+        ::close(fd_);
+        fd_ = -1;
+        return true;
+    }
+
+    size_t pointCount() const { return point_count_; }
+
+    SParameterStreamWriter(const SParameterStreamWriter&) = delete;
+    SParameterStreamWriter& operator=(const SParameterStreamWriter&) = delete;
+
+    ~SParameterStreamWriter() {
+        if (mapping_) {
+            finalize();
+        } else if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+private:
+    static constexpr uint32_t kMagic = 0x45565350; // 'EVSP'
+
+    FileHeader* header() { return static_cast<FileHeader*>(mapping_); }
+
+    bool remap(size_t new_size) {
+        if (mapping_) {
+            ::munmap(mapping_, mapped_size_);
+            mapping_ = nullptr;
+        }
+        if (::ftruncate(fd_, new_size) != 0) {
+            return false;
+        }
+        void* mapped = ::mmap(nullptr, new_size, PROT_READ | PROT_WRITE,
+                              MAP_SHARED, fd_, 0);
+        if (mapped == MAP_FAILED) {
+            return false;
+        }
+        mapping_ = mapped;
+        mapped_size_ = new_size;
+        return true;
+    }
+
+    uint32_t num_ports_;
+    size_t record_doubles_;
+    int fd_ = -1;
+    void* mapping_ = nullptr;
+    size_t mapped_size_ = 0;
+    size_t point_count_ = 0;
+    std::vector<double> frequencies_;
+};
+
+// Read-only view over a finalized stream file; points are fixed-size
+// records, so lookups by index are O(1) and lookups by frequency binary
+// search the index block.
+class SParameterStreamReader {
+public:
+    explicit SParameterStreamReader(const std::string& path) {
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            return;
+        }
+        struct stat st;
+        if (::fstat(fd_, &st) != 0 ||
+            static_cast<size_t>(st.st_size) < sizeof(SParameterStreamWriter::FileHeader)) {
+            ::close(fd_);
+            fd_ = -1;
+            return;
+        }
+        mapped_size_ = st.st_size;
+        void* mapped = ::mmap(nullptr, mapped_size_, PROT_READ, MAP_SHARED, fd_, 0);
+        if (mapped == MAP_FAILED) {
+            ::close(fd_);
+            fd_ = -1;
+            return;
+        }
+        mapping_ = mapped;
+        header_ = static_cast<const SParameterStreamWriter::FileHeader*>(mapping_);
+        if (header_->magic != 0x45565350) {
+            close();
+        }
+    }
+
+    bool isOpen() const { return mapping_ != nullptr; }
+    size_t pointCount() const { return header_ ? header_->point_count : 0; }
+    uint32_t numPorts() const { return header_ ? header_->num_ports : 0; }
+
+    double frequencyAt(size_t index) const {
+        return recordAt(index)[0];
+    }
+
+    // S-parameters of one point, unpacked from the mapped record
+    std::vector<Complex> parametersAt(size_t index) const {
+        const double* record = recordAt(index);
+        size_t count = static_cast<size_t>(header_->num_ports) * header_->num_ports;
+        std::vector<Complex> params;
+        params.reserve(count);
+        for (size_t i = 0; i < count; i++) {
+            params.emplace_back(record[1 + 2 * i], record[2 + 2 * i]);
+        }
+        return params;
+    }
+
+    // Index of the point with the nearest frequency, via the index block
+    size_t findNearest(double frequency) const {
+        const double* index = reinterpret_cast<const double*>(
+            static_cast<const char*>(mapping_) + header_->index_offset);
+        const double* end = index + header_->point_count;
+        const double* it = std::lower_bound(index, end, frequency);
+        if (it == end) {
+            return header_->point_count - 1;
+        }
+        if (it != index && frequency - *(it - 1) < *it - frequency) {
+            --it;
+        }
+        return static_cast<size_t>(it - index);
+    }
+
+    SParameterStreamReader(const SParameterStreamReader&) = delete;
+    SParameterStreamReader& operator=(const SParameterStreamReader&) = delete;
+
+    ~SParameterStreamReader() { close(); }
+
+private:
+    const double* recordAt(size_t index) const {
+        size_t record_doubles = 1 +
+            2 * static_cast<size_t>(header_->num_ports) * header_->num_ports;
+        return reinterpret_cast<const double*>(
+            static_cast<const char*>(mapping_) +
+            sizeof(SParameterStreamWriter::FileHeader) +
+            index * record_doubles * sizeof(double));
+    }
+
+    void close() {
+        if (mapping_) {
+            ::munmap(const_cast<void*>(mapping_), mapped_size_);
+            mapping_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+        header_ = nullptr;
+    }
+
+    int fd_ = -1;
+    const void* mapping_ = nullptr;
+    size_t mapped_size_ = 0;
+    const SParameterStreamWriter::FileHeader* header_ = nullptr;
+};
+
+} // namespace circuit
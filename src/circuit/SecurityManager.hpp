@@ -4,6 +4,8 @@
 #include <vector>
 #include <map>
 #include <chrono>
+#include <cstdint>
+#include <memory>
 #include <random>
 #include <cstring>
 #include <openssl/sha.h>
@@ -12,6 +14,129 @@
 
 namespace circuit {
 
+// Per-session AES-256-GCM context. The key is derived once when the
+// session first encrypts; the OpenSSL cipher context is created once
+// and re-initialized per document with only a fresh IV, so the key
+// schedule is not recomputed for every small metric document. Output
+// layout is iv(12) || tag(16) || ciphertext.
+class CryptoSession {
+public:
+    static constexpr size_t kKeyLength = 32;
+    static constexpr size_t kIvLength = 12;
+    static constexpr size_t kTagLength = 16;
+
+    explicit CryptoSession(const unsigned char* key) {
+        std::memcpy(key_, key, kKeyLength);
+        encrypt_ctx_ = EVP_CIPHER_CTX_new();
+        decrypt_ctx_ = EVP_CIPHER_CTX_new();
+        // Set cipher and key once; per-document inits pass IV only
+        EVP_EncryptInit_ex(encrypt_ctx_, EVP_aes_256_gcm(), nullptr, key_, nullptr);
+        EVP_DecryptInit_ex(decrypt_ctx_, EVP_aes_256_gcm(), nullptr, key_, nullptr);
+        std::random_device rd;
+        iv_prefix_ = rd();
+        iv_counter_ = 0;
+    }
+
+    ~CryptoSession() {
+        EVP_CIPHER_CTX_free(encrypt_ctx_);
+        EVP_CIPHER_CTX_free(decrypt_ctx_);
+        OPENSSL_cleanse(key_, kKeyLength);
+    }
+
+    CryptoSession(const CryptoSession&) = delete;
+    CryptoSession& operator=(const CryptoSession&) = delete;
+
+    std::string encrypt(const std::string& plaintext) {
+        unsigned char iv[kIvLength];
+        nextIv(iv);
+
+        std::string out(kIvLength + kTagLength + plaintext.size(), '\0');
+        unsigned char* buffer = reinterpret_cast<unsigned char*>(&out[0]);
+        std::memcpy(buffer, iv, kIvLength);
+
+        EVP_EncryptInit_ex(encrypt_ctx_, nullptr, nullptr, nullptr, iv);
+        int length = 0;
+        EVP_EncryptUpdate(encrypt_ctx_, buffer + kIvLength + kTagLength, &length,
+                          reinterpret_cast<const unsigned char*>(plaintext.data()),
+                          static_cast<int>(plaintext.size()));
+        int final_length = 0;
+        EVP_EncryptFinal_ex(encrypt_ctx_,
+                            buffer + kIvLength + kTagLength + length,
+                            &final_length);
+        EVP_CIPHER_CTX_ctrl(encrypt_ctx_, EVP_CTRL_GCM_GET_TAG,
+                            kTagLength, buffer + kIvLength);
+        out.resize(kIvLength + kTagLength + length + final_length);
+        return out;
+    }
+
+    // Returns false on authentication failure; plaintext is left empty
+    bool decrypt(const std::string& ciphertext, std::string& plaintext) {
+        plaintext.clear();
+        if (ciphertext.size() < kIvLength + kTagLength) {
+            return false;
+        }
+        const unsigned char* buffer =
+            reinterpret_cast<const unsigned char*>(ciphertext.data());
+        const size_t payload_length = ciphertext.size() - kIvLength - kTagLength;
+
+        EVP_DecryptInit_ex(decrypt_ctx_, nullptr, nullptr, nullptr, buffer);
+        plaintext.resize(payload_length);
+        int length = 0;
+        EVP_DecryptUpdate(decrypt_ctx_,
+                          reinterpret_cast<unsigned char*>(&plaintext[0]), &length,
+                          buffer + kIvLength + kTagLength,
+                          static_cast<int>(payload_length));
+        unsigned char tag[kTagLength];
+        std::memcpy(tag, buffer + kIvLength, kTagLength);
+        EVP_CIPHER_CTX_ctrl(decrypt_ctx_, EVP_CTRL_GCM_SET_TAG, kTagLength, tag);
+        int final_length = 0;
+        if (EVP_DecryptFinal_ex(decrypt_ctx_,
+                reinterpret_cast<unsigned char*>(&plaintext[0]) + length,
+                &final_length) != 1) {
+            plaintext.clear();
+            return false;
+        }
+        plaintext.resize(length + final_length);
+        return true;
+    }
+
+    // Batch APIs: one context, one key schedule, many small documents
+    std::vector<std::string> encryptBatch(const std::vector<std::string>& documents) {
+        std::vector<std::string> encrypted;
+        encrypted.reserve(documents.size());
+        for (const auto& document : documents) {
+            encrypted.push_back(encrypt(document));
+        }
+        return encrypted;
+    }
+
+    std::vector<std::string> decryptBatch(const std::vector<std::string>& documents,
+                                          std::vector<bool>* ok = nullptr) {
+        std::vector<std::string> decrypted(documents.size());
+        if (ok) ok->assign(documents.size(), false);
+        for (size_t i = 0; i < documents.size(); i++) {
+            const bool success = decrypt(documents[i], decrypted[i]);
+            if (ok) (*ok)[i] = success;
+        }
+        return decrypted;
+    }
+
+private:
+    // 4-byte random prefix plus a monotonically increasing counter:
+    // unique per document for the lifetime of the session
+    void nextIv(unsigned char* iv) {
+        std::memcpy(iv, &iv_prefix_, sizeof(iv_prefix_));
+        const uint64_t counter = iv_counter_++;
+        std::memcpy(iv + sizeof(iv_prefix_), &counter, sizeof(counter));
+    }
+
+    unsigned char key_[kKeyLength];
+    EVP_CIPHER_CTX* encrypt_ctx_;
+    EVP_CIPHER_CTX* decrypt_ctx_;
+    uint32_t iv_prefix_;
+    uint64_t iv_counter_;
+};
+
 class SecurityManager {
 public:
     struct UserSession {
@@ -129,6 +254,39 @@ public:
 
     void revokeToken(const std::string& token) {
         active_sessions_.erase(token);
+        crypto_sessions_.erase(token);
+    }
+
+    // Returns the cached crypto context for a session, deriving the
+    // session key (SHA-256 over the manager secret and the token) only
+    // on first use. MongoDBManager holds onto this for the lifetime of
+    // its connection instead of re-deriving per document.
+    std::shared_ptr<CryptoSession> cryptoSession(const std::string& token) {
+        auto it = crypto_sessions_.find(token);
+        if (it != crypto_sessions_.end()) {
+            return it->second;
+        }
+        unsigned char key[SHA256_DIGEST_LENGTH];
+        const std::string material = secret_key_ + ":" + token;
+        SHA256_CTX sha256;
+        SHA256_Init(&sha256);
+        SHA256_Update(&sha256, material.c_str(), material.length());
+        SHA256_Final(key, &sha256);
+        auto session = std::make_shared<CryptoSession>(key);
+        crypto_sessions_[token] = session;
+        return session;
+    }
+
+    // Session-scoped batch convenience wrappers
+    std::vector<std::string> encryptForSession(const std::string& token,
+                                               const std::vector<std::string>& documents) {
+        return cryptoSession(token)->encryptBatch(documents);
+    }
+
+    std::vector<std::string> decryptForSession(const std::string& token,
+                                               const std::vector<std::string>& documents,
+                                               std::vector<bool>* ok = nullptr) {
+        return cryptoSession(token)->decryptBatch(documents, ok);
     }
 
     void logSecurityEvent(const std::string& user_id,
@@ -171,6 +329,7 @@ public:
 private:
     std::string secret_key_;
     std::map<std::string, UserSession> active_sessions_;
+    std::map<std::string, std::shared_ptr<CryptoSession>> crypto_sessions_;
     std::vector<SecurityAudit> security_log_;
     std::map<std::string, int> failed_attempts_;
 
@@ -0,0 +1,257 @@
+#pragma once
+
+#include "SParameterStream.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <sys/stat.h>
+
+namespace circuit {
+
+// Measured-component import path. Touchstone text files (.s1p/.s2p/...)
+// are converted once into the binary stream format from
+// SParameterStream.hpp; every later open memory-maps the sidecar
+// directly, so a session touching thousands of measured components pays
+// text parsing only for files that changed since their last conversion.
+//
+// The sidecar lives next to the source file as "<source>.evsp" and is
+// regenerated whenever the source is newer. Records are stored row-major
+// (S11, S12, ..., SNN), independent of the column-major two-port order
+// Touchstone uses on disk.
+class TouchstoneImporter {
+public:
+    // Port count encoded in the extension: ".sNp" -> N. Returns 0 when
+    // the path does not carry a Touchstone extension.
+    static uint32_t portsFromPath(const std::string& path) {
+        size_t dot = path.find_last_of('.');
+        if (dot == std::string::npos) {
+            return 0;
+        }
+        std::string ext = path.substr(dot + 1);
+        std::transform(ext.begin(), ext.end(), ext.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+        if (ext.size() < 3 || ext.front() != 's' || ext.back() != 'p') {
+            return 0;
+        }
+        uint32_t ports = 0;
+        for (size_t i = 1; i + 1 < ext.size(); i++) {
+            if (!std::isdigit(static_cast<unsigned char>(ext[i]))) {
+                return 0;
+            }
+            ports = ports * 10 + (ext[i] - '0');
+        }
+        return ports;
+    }
+
+    // Parse a Touchstone file and write the binary sidecar. Handles the
+    // option line ("# GHZ S RI R 50" and variants), '!' comments, and
+    // data points wrapped across lines. Returns false on malformed
+    // input or write failure.
+    static bool convert(const std::string& touchstone_path,
+                        const std::string& sidecar_path) {
+        uint32_t num_ports = portsFromPath(touchstone_path);
+        if (num_ports == 0) {
+            return false;
+        }
+
+        std::ifstream in(touchstone_path);
+        if (!in.is_open()) {
+            return false;
+        }
+
+        double freq_scale = 1e9;       // Touchstone default is GHz
+        Format format = Format::MagnitudeAngle;
+        std::vector<double> values;    // accumulates wrapped data rows
+        size_t values_per_point = 1 + 2 * static_cast<size_t>(num_ports) * num_ports;
+
+        SParameterStreamWriter writer(sidecar_path, num_ports);
+        if (!writer.isOpen()) {
+            return false;
+        }
+
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t bang = line.find('!');
+            if (bang != std::string::npos) {
+                line.erase(bang);
+            }
+            size_t start = line.find_first_not_of(" \t\r");
+            if (start == std::string::npos) {
+                continue;
+            }
+
+            if (line[start] == '#') {
+                parseOptionLine(line.substr(start + 1), freq_scale, format);
+                continue;
+            }
+
+            std::istringstream row(line);
+            double v;
+            while (row >> v) {
+                values.push_back(v);
+            }
+            while (values.size() >= values_per_point) {
+                if (!appendPoint(writer, values.data(), num_ports,
+                                 freq_scale, format)) {
+                    return false;
+                }
+                values.erase(values.begin(),
+                             values.begin() + values_per_point);
+            }
+        }
+
+        return values.empty() && writer.pointCount() > 0 && writer.finalize();
+    }
+
+private:
+    enum class Format { RealImaginary, MagnitudeAngle, DbAngle };
+
+    static void parseOptionLine(const std::string& options,
+                                double& freq_scale, Format& format) {
+        std::istringstream fields(options);
+        std::string field;
+        while (fields >> field) {
+            std::transform(field.begin(), field.end(), field.begin(),
+                           [](unsigned char c) { return std::toupper(c); });
+            if (field == "HZ")  freq_scale = 1.0;
+            if (field == "KHZ") freq_scale = 1e3;
+            if (field == "MHZ") freq_scale = 1e6;
+            if (field == "GHZ") freq_scale = 1e9;
+            if (field == "RI")  format = Format::RealImaginary;
+            if (field == "MA")  format = Format::MagnitudeAngle;
+            if (field == "DB")  format = Format::DbAngle;
+            if (field == "R") {
+                fields >> field;  // reference impedance, not stored
+            }
+        }
+    }
+
+    static Complex decode(double a, double b, Format format) {
+        switch (format) {
+        case Format::RealImaginary:
+            return Complex(a, b);
+        case Format::MagnitudeAngle:
+            return std::polar(a, b * M_PI / 180.0);
+        case Format::DbAngle:
+        default:
+            return std::polar(std::pow(10.0, a / 20.0), b * M_PI / 180.0);
+        }
+    }
+
+    static bool appendPoint(SParameterStreamWriter& writer,
+                            const double* raw, uint32_t num_ports,
+                            double freq_scale, Format format) {
+        size_t count = static_cast<size_t>(num_ports) * num_ports;
+        std::vector<Complex> params(count);
+        for (size_t k = 0; k < count; k++) {
+            Complex s = decode(raw[1 + 2 * k], raw[2 + 2 * k], format);
+            // Two-port Touchstone data is ordered S11 S21 S12 S22; all
+            // other sizes are already row-major
+            size_t index = k;
+            if (num_ports == 2 && (k == 1 || k == 2)) {
+                index = 3 - k;
+            }
+            params[index] = s;
+        }
+        return writer.appendPoint(raw[0] * freq_scale, params);
+    }
+};
+
+// Lazy registry over a measured-component library. Registration just
+// records the path; the text-to-sidecar conversion (at most once per
+// changed file) and the mmap both happen on first access to a
+// component, so session start cost is proportional to the components
+// actually instantiated rather than to the library size.
+class TouchstoneLibrary {
+public:
+    void registerComponent(const std::string& name,
+                           const std::string& touchstone_path) {
+        sources_[name] = touchstone_path;
+    }
+
+    size_t registeredCount() const { return sources_.size(); }
+    size_t openCount() const { return readers_.size(); }
+
+    // Opens (and if needed converts) the component's sidecar; nullptr
+    // when the name is unknown or the file cannot be imported
+    const SParameterStreamReader* open(const std::string& name) {
+        auto cached = readers_.find(name);
+        if (cached != readers_.end()) {
+            return cached->second.get();
+        }
+
+        auto source = sources_.find(name);
+        if (source == sources_.end()) {
+            return nullptr;
+        }
+
+        std::string sidecar = source->second + ".evsp";
+        if (!sidecarCurrent(source->second, sidecar) &&
+            !TouchstoneImporter::convert(source->second, sidecar)) {
+            return nullptr;
+        }
+
+        auto reader = std::make_unique<SParameterStreamReader>(sidecar);
+        if (!reader->isOpen()) {
+            return nullptr;
+        }
+        return readers_.emplace(name, std::move(reader))
+            .first->second.get();
+    }
+
+    // S(i,j) at the given frequency, linearly interpolated between the
+    // two bracketing measured points
+    Complex sParameterAt(const std::string& name, double frequency,
+                         uint32_t i, uint32_t j) {
+        const SParameterStreamReader* reader = open(name);
+        if (!reader || reader->pointCount() == 0 ||
+            i >= reader->numPorts() || j >= reader->numPorts()) {
+            return Complex(0, 0);
+        }
+
+        size_t flat = static_cast<size_t>(i) * reader->numPorts() + j;
+        size_t nearest = reader->findNearest(frequency);
+        double f0 = reader->frequencyAt(nearest);
+
+        size_t other = nearest;
+        if (frequency > f0 && nearest + 1 < reader->pointCount()) {
+            other = nearest + 1;
+        } else if (frequency < f0 && nearest > 0) {
+            other = nearest - 1;
+        }
+        if (other == nearest) {
+            return reader->parametersAt(nearest)[flat];
+        }
+
+        double f1 = reader->frequencyAt(other);
+        double t = (frequency - f0) / (f1 - f0);
+        Complex s0 = reader->parametersAt(nearest)[flat];
+        Complex s1 = reader->parametersAt(other)[flat];
+        return s0 + (s1 - s0) * t;
+    }
+
+private:
+    static bool sidecarCurrent(const std::string& source,
+                               const std::string& sidecar) {
+        struct stat src_stat, side_stat;
+        if (::stat(sidecar.c_str(), &side_stat) != 0) {
+            return false;
+        }
+        if (::stat(source.c_str(), &src_stat) != 0) {
+            return true;  // sidecar exists, source gone: keep using it
+        }
+        return side_stat.st_mtime >= src_stat.st_mtime;
+    }
+
+    std::unordered_map<std::string, std::string> sources_;
+    std::unordered_map<std::string,
+                       std::unique_ptr<SParameterStreamReader>> readers_;
+};
+
+} // namespace circuit
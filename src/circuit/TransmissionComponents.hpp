@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Component.hpp"
+#include <algorithm>
 #include <complex>
 #include <vector>
 #include <deque>
@@ -210,4 +211,116 @@ private:
     double current_frequency_ = 0.0;
 };
 
+// ABCD matrices for a whole frequency grid, one contiguous array per
+// matrix entry. Keeping the four entries in separate arrays lets the
+// cascade multiply run as flat loops over complex values instead of
+// per-frequency 2x2 objects.
+struct ABCDArray {
+    std::vector<Complex> A, B, C, D;
+
+    void resize(size_t points) {
+        A.resize(points);
+        B.resize(points);
+        C.resize(points);
+        D.resize(points);
+    }
+
+    // Reset to the identity two-port at every frequency
+    void setIdentity() {
+        std::fill(A.begin(), A.end(), Complex(1, 0));
+        std::fill(B.begin(), B.end(), Complex(0, 0));
+        std::fill(C.begin(), C.end(), Complex(0, 0));
+        std::fill(D.begin(), D.end(), Complex(1, 0));
+    }
+
+    size_t size() const { return A.size(); }
+};
+
+// Vectorized frequency response of cascaded transmission-line segments.
+//
+// TransmissionLine evaluates scalar ABCD math per frequency, so a
+// multi-segment line recomputes the whole chain once per point. The
+// cascade engine turns that inside out: each segment's ABCD entries are
+// computed across the full frequency array at once, then folded into a
+// running cascade with batched 2x2 complex multiplies. A 50-segment
+// line over a 100k-point grid is 50 array passes instead of 5M scalar
+// matrix evaluations.
+//
+// Segment parameters and conventions (loss in dB/m scaled by f/1e9,
+// beta from the velocity factor) match TransmissionLine, so a
+// one-segment cascade reproduces its input impedance exactly.
+class ABCDCascade {
+public:
+    struct Segment {
+        double length;           // meters
+        double z0;               // characteristic impedance (ohms)
+        double velocity_factor;  // 0 to 1
+        double loss;             // dB/meter
+    };
+
+    void addSegment(double length, double z0, double velocity_factor = 0.66,
+                    double loss = 0.1) {
+        segments_.push_back({length, z0, velocity_factor, loss});
+    }
+
+    size_t segmentCount() const { return segments_.size(); }
+
+    // Evaluate the cascaded ABCD matrix at every frequency. The result
+    // array is resized once; scratch buffers are reused across calls so
+    // repeated sweeps allocate nothing new.
+    void evaluate(const std::vector<double>& frequencies, ABCDArray& result) {
+        const size_t points = frequencies.size();
+        result.resize(points);
+        result.setIdentity();
+        segment_.resize(points);
+
+        for (const auto& seg : segments_) {
+            // Pass 1: this segment's entries across the whole grid
+            for (size_t i = 0; i < points; i++) {
+                double c = 3e8;
+                double beta = 2 * M_PI * frequencies[i] / (c * seg.velocity_factor);
+                double alpha = seg.loss * frequencies[i] / 1e9;
+                Complex gl = Complex(alpha, beta) * seg.length;
+                Complex ch = std::cosh(gl);
+                Complex sh = std::sinh(gl);
+                segment_.A[i] = ch;
+                segment_.B[i] = sh * seg.z0;
+                segment_.C[i] = sh / seg.z0;
+                segment_.D[i] = ch;
+            }
+
+            // Pass 2: fold into the cascade, result = result * segment
+            for (size_t i = 0; i < points; i++) {
+                Complex a = result.A[i] * segment_.A[i] + result.B[i] * segment_.C[i];
+                Complex b = result.A[i] * segment_.B[i] + result.B[i] * segment_.D[i];
+                Complex c = result.C[i] * segment_.A[i] + result.D[i] * segment_.C[i];
+                Complex d = result.C[i] * segment_.B[i] + result.D[i] * segment_.D[i];
+                result.A[i] = a;
+                result.B[i] = b;
+                result.C[i] = c;
+                result.D[i] = d;
+            }
+        }
+    }
+
+    // Input impedance of the cascade terminated with load_impedance,
+    // Zin = (A*Zl + B) / (C*Zl + D), across the whole grid
+    void inputImpedance(const std::vector<double>& frequencies,
+                        Complex load_impedance,
+                        std::vector<Complex>& result) {
+        evaluate(frequencies, cascade_);
+        const size_t points = frequencies.size();
+        result.resize(points);
+        for (size_t i = 0; i < points; i++) {
+            result[i] = (cascade_.A[i] * load_impedance + cascade_.B[i]) /
+                        (cascade_.C[i] * load_impedance + cascade_.D[i]);
+        }
+    }
+
+private:
+    std::vector<Segment> segments_;
+    ABCDArray segment_;  // scratch reused across evaluate() calls
+    ABCDArray cascade_;  // scratch for inputImpedance
+};
+
 } // namespace circuit
@@ -5,9 +5,11 @@
 #include <string>
 #include <optional>
 #include <filesystem>
+#include <unordered_map>
 #include <nlohmann/json.hpp>
 #include "eco_vehicle/core/logging.hpp"
 #include "eco_vehicle/core/config.hpp"
+#include "eco_vehicle/core/thread_pool.hpp"
 #include "eco_vehicle/uml/diagram_generator.hpp"
 
 namespace eco_vehicle {
@@ -36,6 +38,74 @@ struct DepartmentMetrics {
     std::vector<std::string> improvement_suggestions;
 };
 
+/**
+ * @brief Company-wide rollup produced by analyze_all_departments
+ */
+struct CompanySummary {
+    std::vector<DepartmentMetrics> departments;
+    double company_avg_satisfaction;  // response-weighted across departments
+    size_t total_responses;
+};
+
+/**
+ * @brief Sentiment score for one feedback comment
+ */
+struct CommentSentiment {
+    uint32_t response;  // index into the response storage
+    uint32_t comment;   // comment index within the response
+    double score;       // mean lexicon weight per token, in [-1, 1]
+};
+
+/**
+ * @brief Per-department sentiment aggregate
+ */
+struct DepartmentSentiment {
+    size_t comment_count;
+    size_t positive_comments;
+    size_t negative_comments;
+    double avg_score;
+};
+
+/**
+ * @brief Full sentiment pass produced by analyze_sentiment
+ */
+struct SentimentReport {
+    std::vector<CommentSentiment> comments;  // one entry per comment
+    std::map<std::string, DepartmentSentiment> departments;
+    double company_avg_score;
+};
+
+/**
+ * @brief Precomputed aggregates for one survey wave
+ */
+struct WaveSnapshot {
+    std::string label;           // e.g. "2026-Q1"
+    int64_t wave_start;          // earliest response timestamp (time_t)
+    uint64_t total_responses;
+    double avg_satisfaction;     // company-wide, response-weighted
+    double avg_sentiment;        // company-wide mean comment score
+    std::map<std::string, double> department_avg_satisfaction;
+};
+
+/**
+ * @brief One wave on a trend curve
+ */
+struct TrendPoint {
+    std::string label;
+    int64_t wave_start;
+    uint64_t responses;
+    double avg_satisfaction;
+    double avg_sentiment;
+};
+
+/**
+ * @brief Trend query result: one point per stored wave, oldest first
+ */
+struct TrendSeries {
+    std::vector<TrendPoint> points;
+    double satisfaction_slope;  // linear-regression slope over wave index
+};
+
 /**
  * @brief Advanced survey analysis engine
  */
@@ -53,7 +123,22 @@ public:
      * @return Success status
      */
     bool load_survey_data(const std::filesystem::path& json_path);
-    
+
+    /**
+     * @brief Load survey data without materializing the JSON DOM
+     *
+     * A SAX-style parse streams records straight into survey_responses_,
+     * so peak memory is the response storage itself rather than ~3x the
+     * file size. On first load a binary cache is written next to the JSON
+     * file; later sessions load the cache directly and skip parsing.
+     *
+     * @param json_path Path to JSON data file
+     * @param use_binary_cache Read/write the sidecar binary cache
+     * @return Success status
+     */
+    bool load_survey_data_streaming(const std::filesystem::path& json_path,
+                                    bool use_binary_cache = true);
+
     /**
      * @brief Analyze department performance
      * @param department Department name
@@ -61,7 +146,134 @@ public:
      */
     std::optional<DepartmentMetrics> analyze_department(
         const std::string& department);
-    
+
+    /**
+     * @brief Analyze every department in one parallel pass
+     *
+     * Department spans are dispatched as tasks on the shared thread pool
+     * and per-department metrics are computed concurrently, then reduced
+     * into a response-weighted company summary — replacing the sequential
+     * per-department call pattern the dashboards used.
+     *
+     * @param thread_pool Pool to dispatch per-department tasks on
+     * @return Metrics for all departments plus the company rollup
+     */
+    CompanySummary analyze_all_departments(core::ThreadPool& thread_pool);
+
+    /**
+     * @brief Boolean query over the feedback-comment index
+     *
+     * Terms are tokenized the same way the index is built, so casing and
+     * punctuation do not matter. A response matches when its comments
+     * contain every term in all_terms, at least one term in any_terms
+     * (when non-empty), and no term in none_terms. The index is built
+     * lazily on first query and reused until the data changes.
+     *
+     * @param all_terms Terms that must all appear
+     * @param any_terms Terms of which at least one must appear
+     * @param none_terms Terms that must not appear
+     * @return Matching indices into the response storage, ascending
+     */
+    std::vector<uint32_t> query_comments(
+        const std::vector<std::string>& all_terms,
+        const std::vector<std::string>& any_terms = {},
+        const std::vector<std::string>& none_terms = {});
+
+    /**
+     * @brief Phrase query over the feedback-comment index
+     *
+     * Matches responses with a comment containing the phrase's tokens
+     * consecutively, using the per-token positions stored in the index.
+     *
+     * @param phrase Phrase to search for
+     * @return Matching indices into the response storage, ascending
+     */
+    std::vector<uint32_t> query_comments_phrase(const std::string& phrase);
+
+    /**
+     * @brief Score feedback sentiment for the whole corpus in one pass
+     *
+     * Lexicon-based scoring over the tokenized comment index: each
+     * distinct vocabulary term is looked up once in a collision-free
+     * sentiment lexicon table and its weight credited to every comment
+     * holding the term, so the cost is one pass over the posting lists
+     * rather than per-token string hashing. Per-comment scores are the
+     * mean lexicon weight per token; department and company aggregates
+     * come from one linear reduction over the flat comment array.
+     *
+     * @return Per-comment scores plus department and company aggregates
+     */
+    SentimentReport analyze_sentiment();
+
+    /**
+     * @brief Aggregate the loaded wave and append it to the trend sidecar
+     *
+     * The trend dashboards previously re-loaded and re-aggregated every
+     * historical wave per query. Instead, each wave is reduced once — at
+     * ingest time — to a WaveSnapshot and appended to a compact binary
+     * sidecar; the raw wave never needs to be touched again for trends.
+     * An existing sidecar is validated before appending.
+     *
+     * @param wave_label Label stored with the snapshot (e.g. "2026-Q1")
+     * @param sidecar_path Snapshot file, created if missing
+     * @return Success status
+     */
+    bool append_wave_snapshot(const std::string& wave_label,
+                              const std::filesystem::path& sidecar_path);
+
+    /**
+     * @brief Compose stored wave snapshots into a trend series
+     *
+     * Reads only the precomputed snapshots, so the cost is proportional
+     * to the number of waves, not to the responses behind them. With a
+     * department name the per-department satisfaction curve is returned;
+     * otherwise the company-wide one. The slope is the same linear
+     * regression the per-department trend analysis uses.
+     *
+     * @param sidecar_path Snapshot file written by append_wave_snapshot
+     * @param department Department to trend, empty for company-wide
+     * @return Trend points oldest first, or nullopt if unreadable
+     */
+    std::optional<TrendSeries> query_trend(
+        const std::filesystem::path& sidecar_path,
+        const std::string& department = "");
+
+    /**
+     * @brief Row-major satisfaction-score matrix over contiguous storage
+     *
+     * One row per response (in department-index order) and one column
+     * per metric name, with NaN marking scores a response did not
+     * answer. Built lazily from the per-response score maps and reused
+     * until the data changes. The storage is contiguous and stable
+     * between loads, so language bindings can expose it through the
+     * buffer protocol without copying.
+     *
+     * @return Matrix values, responses x satisfaction_metric_names()
+     */
+    const std::vector<double>& satisfaction_matrix();
+
+    /**
+     * @brief Column labels of the satisfaction matrix, sorted
+     */
+    const std::vector<std::string>& satisfaction_metric_names();
+
+    /**
+     * @brief Per-department aggregate over the satisfaction matrix
+     *
+     * One row per department (in department_names() order), one column
+     * per metric: the mean of answered scores in the department's span,
+     * NaN where no response answered. Shares the satisfaction matrix's
+     * lifetime and contiguity guarantees.
+     *
+     * @return Matrix values, departments x satisfaction_metric_names()
+     */
+    const std::vector<double>& department_satisfaction_matrix();
+
+    /**
+     * @brief Row labels of the department aggregate matrix, sorted
+     */
+    const std::vector<std::string>& department_names();
+
     /**
      * @brief Generate performance visualization
      * @param metrics List of department metrics
@@ -88,7 +300,34 @@ public:
     bool export_results(const std::filesystem::path& output_path);
     
 private:
+    /**
+     * @brief Contiguous span of responses for one department after the
+     *        storage has been sorted by department
+     */
+    struct DepartmentSpan {
+        size_t begin;
+        size_t end;
+        double avg_satisfaction;  // cached aggregate over the span
+    };
+
+    /**
+     * @brief One occurrence of an indexed comment token
+     */
+    struct CommentPosting {
+        uint32_t response;  // index into survey_responses_
+        uint32_t comment;   // comment index within the response
+        uint32_t position;  // token position within the comment
+    };
+
     // Internal helper methods
+    bool load_binary_cache(const std::filesystem::path& cache_path);
+    void write_binary_cache(const std::filesystem::path& cache_path) const;
+    void rebuild_department_index();
+    void build_score_matrix();
+    void build_comment_index();
+    std::vector<uint32_t> responses_for_term(const std::string& term) const;
+    bool read_wave_snapshots(const std::filesystem::path& sidecar_path,
+                             std::vector<WaveSnapshot>& snapshots) const;
     void analyze_satisfaction_trends();
     void identify_common_issues();
     void generate_improvement_suggestions();
@@ -97,6 +336,30 @@ private:
     // Data members
     std::vector<SurveyResponse> survey_responses_;
     std::map<std::string, DepartmentMetrics> department_metrics_;
+
+    // Department index: built once per load, invalidated by the loaders.
+    // Responses are sorted by department so each department is one
+    // contiguous span with its aggregate precomputed.
+    std::map<std::string, DepartmentSpan> department_index_;
+    bool department_index_valid_ = false;
+
+    // Contiguous score storage backing the zero-copy binding views:
+    // response and department matrices are row-major with the shared
+    // sorted metric columns. Built lazily; invalidated whenever the
+    // response storage changes or is reordered.
+    std::vector<double> score_matrix_;
+    std::vector<double> department_score_matrix_;
+    std::vector<std::string> score_metric_names_;
+    std::vector<std::string> score_department_names_;
+    bool score_matrix_valid_ = false;
+
+    // Inverted comment index: the vocabulary interns each token once and
+    // maps it to a posting list ordered by (response, comment, position).
+    // Built lazily on first query; invalidated by the loaders and by
+    // department-index rebuilds, which reorder the response storage.
+    std::unordered_map<std::string, uint32_t> comment_vocabulary_;
+    std::vector<std::vector<CommentPosting>> comment_postings_;
+    bool comment_index_valid_ = false;
     std::unique_ptr<uml::DiagramGenerator> diagram_generator_;
     Config config_;
     Logger logger_;
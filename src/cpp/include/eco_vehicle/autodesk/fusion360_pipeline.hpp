@@ -5,6 +5,9 @@
 #include <string>
 #include <optional>
 #include <future>
+#include <deque>
+#include <mutex>
+#include <condition_variable>
 #include <Eigen/Dense>
 #include "eco_vehicle/core/logging.hpp"
 #include "eco_vehicle/core/config.hpp"
@@ -33,6 +36,100 @@ struct SimulationResult {
     std::unordered_map<std::string, double> performance_metrics;
 };
 
+/**
+ * @brief On-disk header of the binary simulation result format
+ *
+ * The header is followed by three contiguous float64 blocks: the 3×N
+ * displacement field, the 9×N stress tensors (column-major per tensor)
+ * and the N safety factors. All offsets are 8-byte aligned so the blocks
+ * can be viewed in place through Eigen::Map.
+ */
+struct SimulationResultHeader {
+    uint32_t magic;               // 'EVSR'
+    uint32_t version;
+    uint64_t displacement_count;
+    uint64_t stress_tensor_count;
+    uint64_t safety_factor_count;
+};
+
+/**
+ * @brief Memory-mapped view over a persisted SimulationResult
+ *
+ * open() maps the file and validates the header; the field accessors
+ * return Eigen::Map views directly over the mapping, so a multi-gigabyte
+ * stress field is available in milliseconds with no copy or parse step.
+ * The views remain valid for the lifetime of this object.
+ */
+class SimulationResultFile {
+public:
+    /**
+     * @brief Persist a result in the binary block format
+     * @param path Destination file path
+     * @param result Result to serialize
+     * @return True on success
+     */
+    static bool write(const std::string& path, const SimulationResult& result);
+
+    /**
+     * @brief Map an existing result file
+     * @param path File previously produced by write()
+     * @return Mapped view, or std::nullopt on open/validation failure
+     */
+    static std::optional<SimulationResultFile> open(const std::string& path);
+
+    /**
+     * @brief Displacement vectors as a 3×N map over the mapping
+     */
+    Eigen::Map<const Eigen::Matrix<double, 3, Eigen::Dynamic>>
+    displacement_field() const;
+
+    /**
+     * @brief Stress tensors as a 9×N map; column i is tensor i flattened
+     */
+    Eigen::Map<const Eigen::Matrix<double, 9, Eigen::Dynamic>>
+    stress_tensors() const;
+
+    /**
+     * @brief Safety factors as a length-N vector map
+     */
+    Eigen::Map<const Eigen::VectorXd> safety_factors() const;
+
+    SimulationResultFile(SimulationResultFile&& other) noexcept;
+    SimulationResultFile& operator=(SimulationResultFile&& other) noexcept;
+    SimulationResultFile(const SimulationResultFile&) = delete;
+    SimulationResultFile& operator=(const SimulationResultFile&) = delete;
+
+    /**
+     * @brief Unmaps the file
+     */
+    ~SimulationResultFile();
+
+private:
+    SimulationResultFile() = default;
+
+    const void* mapping_ = nullptr;
+    size_t mapped_size_ = 0;
+    const SimulationResultHeader* header_ = nullptr;
+};
+
+/**
+ * @brief One entry of a batched parameter sweep
+ */
+struct BatchSimulationRequest {
+    ModelParameters parameters;
+    std::string simulation_type;
+    std::unordered_map<std::string, double> simulation_parameters;
+};
+
+/**
+ * @brief Completed batch entry delivered through the completion queue
+ */
+struct BatchSimulationCompletion {
+    size_t request_index;                 // index into the submitted batch
+    std::optional<std::string> model_id;  // empty if model creation failed
+    SimulationResult result;
+};
+
 /**
  * @brief High-performance Fusion 360 integration pipeline
  */
@@ -63,6 +160,31 @@ public:
         const std::string& simulation_type,
         const std::unordered_map<std::string, double>& parameters);
     
+    /**
+     * @brief Submit a parameter sweep through the pipelined batch path
+     *
+     * Model creation, simulation dispatch and result retrieval are
+     * overlapped on the internal thread pool with at most max_in_flight
+     * entries active at once, so the nightly sweep is bounded by the
+     * slowest stage rather than the sum of all stages per model.
+     * Completions are delivered through next_completion() as each entry
+     * finishes, not in submission order.
+     *
+     * @param requests Batch entries to process
+     * @param max_in_flight Upper bound on concurrently active entries
+     */
+    void submit_batch(
+        const std::vector<BatchSimulationRequest>& requests,
+        size_t max_in_flight = 4);
+
+    /**
+     * @brief Block for the next completed batch entry
+     * @param timeout Maximum time to wait
+     * @return Completion, or std::nullopt if the timeout expired
+     */
+    std::optional<BatchSimulationCompletion> next_completion(
+        std::chrono::milliseconds timeout);
+
     /**
      * @brief Export model to specified format
      * @param model_id Model identifier
@@ -97,7 +219,20 @@ private:
     
     // Thread pool for async operations
     ThreadPool thread_pool_;
-    
+
+    // Batch pipeline state: completions queued as entries finish, with the
+    // in-flight window enforced on the submission side
+    std::deque<BatchSimulationCompletion> completions_;
+    mutable std::mutex completion_mutex_;
+    std::condition_variable completion_cv_;
+    size_t in_flight_ = 0;
+
+    /**
+     * @brief Run one batch entry end to end and queue its completion
+     */
+    void process_batch_entry(const BatchSimulationRequest& request,
+                             size_t request_index);
+
     /**
      * @brief Create base model with dimensions
      */
@@ -5,19 +5,100 @@
 #include <mutex>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "eco_vehicle/core/instrumentation.hpp"
 #include "eco_vehicle/core/logging.hpp"
 
 namespace eco_vehicle {
 namespace core {
 
+/**
+ * @brief Snapshot of pool allocation statistics
+ *
+ * All zero when the pool is instantiated with the disabled policy.
+ */
+struct PoolStats {
+    size_t blocks_allocated{0};        ///< Fixed-size blocks ever grown
+    size_t high_water_slots{0};        ///< Peak bump-allocated slot count
+    size_t large_allocation_count{0};  ///< allocate_many calls above BlockSize
+    size_t large_allocation_bytes{0};  ///< Bytes in large allocations
+};
+
+/**
+ * @brief Statistics policy that compiles the tracking away
+ *
+ * Empty base with inline no-op hooks; pools instantiated with it pay
+ * nothing for the statistics surface.
+ */
+struct PoolStatsDisabled {
+    static constexpr bool enabled = false;
+    void record_blocks(size_t) {}
+    void record_bump_high_water(size_t) {}
+    void record_large_allocation(size_t) {}
+    PoolStats stats_snapshot() const { return {}; }
+};
+
+/**
+ * @brief Statistics policy that tracks block growth and usage
+ *
+ * Hooks run under the pool's existing mutex, so plain counters suffice.
+ */
+struct PoolStatsEnabled {
+    static constexpr bool enabled = true;
+    void record_blocks(size_t count) { blocks_allocated_ += count; }
+    void record_bump_high_water(size_t slots) {
+        if (slots > high_water_slots_) {
+            high_water_slots_ = slots;
+        }
+    }
+    void record_large_allocation(size_t bytes) {
+        ++large_allocation_count_;
+        large_allocation_bytes_ += bytes;
+    }
+    PoolStats stats_snapshot() const {
+        PoolStats stats;
+        stats.blocks_allocated = blocks_allocated_;
+        stats.high_water_slots = high_water_slots_;
+        stats.large_allocation_count = large_allocation_count_;
+        stats.large_allocation_bytes = large_allocation_bytes_;
+        return stats;
+    }
+
+private:
+    size_t blocks_allocated_{0};
+    size_t high_water_slots_{0};
+    size_t large_allocation_count_{0};
+    size_t large_allocation_bytes_{0};
+};
+
 /**
  * @brief High-performance memory pool for fixed-size allocations
+ *
+ * Slots are bump-allocated from fixed-size blocks and recycled through a
+ * shared free list. Each thread additionally keeps a small magazine of
+ * slots per pool: allocate()/deallocate() normally hit only the magazine,
+ * and the shared mutex is taken once per kMagazineSize operations when a
+ * magazine is refilled or flushed. Recycling keeps resident memory bounded
+ * over long runs instead of growing monotonically.
+ *
+ * Statistics are a template policy: PoolStatsEnabled tracks block
+ * growth, high-water slot usage and large allocations for capacity
+ * planning, while the default PoolStatsDisabled compiles the whole
+ * surface away.
+ *
  * @tparam T Type of objects to allocate
  * @tparam BlockSize Number of objects per block
+ * @tparam StatsPolicy PoolStatsDisabled (default) or PoolStatsEnabled
  */
-template<typename T, size_t BlockSize = 4096>
-class MemoryPool {
-    static_assert(std::is_trivially_destructible<T>::value, 
+template<typename T, size_t BlockSize = 4096,
+         typename StatsPolicy = PoolStatsDisabled>
+class MemoryPool : private StatsPolicy {
+    static_assert(std::is_trivially_destructible<T>::value,
                   "T must be trivially destructible");
 public:
     /**
@@ -26,28 +107,48 @@ public:
      */
     explicit MemoryPool(size_t initial_blocks = 1)
         : current_block_(0)
-        , current_slot_(BlockSize) {
+        , current_slot_(BlockSize)
+        , pool_id_(next_pool_id().fetch_add(1, std::memory_order_relaxed)) {
         grow(initial_blocks);
+        std::lock_guard<std::mutex> lock(live_pools_mutex());
+        live_pools().insert(pool_id_);
     }
-    
+
     /**
      * @brief Allocate memory for single object
+     *
+     * Served from the calling thread's magazine when possible; otherwise
+     * the magazine is refilled in one batch from the shared free list and
+     * bump region under a single lock.
+     *
      * @return Pointer to allocated memory
      */
     T* allocate() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        
-        if (current_slot_ >= BlockSize) {
-            if (current_block_ + 1 >= blocks_.size()) {
-                grow(1);
-            }
-            ++current_block_;
-            current_slot_ = 0;
+        std::vector<T*>& magazine = local_magazine();
+        if (magazine.empty()) {
+            refill_magazine(magazine);
         }
-        
-        return &blocks_[current_block_][current_slot_++];
+        T* slot = magazine.back();
+        magazine.pop_back();
+        return slot;
     }
-    
+
+    /**
+     * @brief Return a slot to the pool for reuse
+     *
+     * The slot lands in the calling thread's magazine; full magazines are
+     * flushed to the shared free list in one batch.
+     *
+     * @param slot Pointer previously returned by allocate()
+     */
+    void deallocate(T* slot) {
+        std::vector<T*>& magazine = local_magazine();
+        magazine.push_back(slot);
+        if (magazine.size() >= 2 * kMagazineSize) {
+            flush_magazine(magazine);
+        }
+    }
+
     /**
      * @brief Allocate memory for multiple objects
      * @param n Number of objects
@@ -55,14 +156,15 @@ public:
      */
     T* allocate_many(size_t n) {
         std::lock_guard<std::mutex> lock(mutex_);
-        
+
         // If request is larger than block size, allocate directly
         if (n > BlockSize) {
             auto block = std::make_unique<T[]>(n);
             large_allocations_.push_back(std::move(block));
+            this->record_large_allocation(n * sizeof(T));
             return large_allocations_.back().get();
         }
-        
+
         // If current block doesn't have enough space, move to next
         if (current_slot_ + n > BlockSize) {
             if (current_block_ + 1 >= blocks_.size()) {
@@ -71,22 +173,28 @@ public:
             ++current_block_;
             current_slot_ = 0;
         }
-        
+
         T* result = &blocks_[current_block_][current_slot_];
         current_slot_ += n;
+        this->record_bump_high_water(current_block_ * BlockSize + current_slot_);
         return result;
     }
-    
+
     /**
      * @brief Reset pool to initial state
+     *
+     * Must not race with allocate()/deallocate() on other threads; slots
+     * still cached in other threads' magazines become invalid.
      */
     void reset() {
         std::lock_guard<std::mutex> lock(mutex_);
         current_block_ = 0;
         current_slot_ = 0;
+        free_list_.clear();
         large_allocations_.clear();
+        local_magazine().clear();
     }
-    
+
     /**
      * @brief Get memory usage statistics
      * @return Pair of (used bytes, total bytes)
@@ -94,28 +202,163 @@ public:
     std::pair<size_t, size_t> get_stats() const {
         std::lock_guard<std::mutex> lock(mutex_);
         size_t used = (current_block_ * BlockSize + current_slot_) * sizeof(T);
+        used -= std::min(used, free_list_.size() * sizeof(T));
         size_t total = blocks_.size() * BlockSize * sizeof(T);
-        
+
         for (const auto& block : large_allocations_) {
             used += sizeof(T) * BlockSize;
             total += sizeof(T) * BlockSize;
         }
-        
+
         return {used, total};
     }
-    
+
+    /**
+     * @brief Snapshot of the allocation statistics
+     *
+     * All zero with the disabled policy; with PoolStatsEnabled the
+     * counters cover block growth, peak bump usage and large
+     * allocations.
+     */
+    PoolStats stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return this->stats_snapshot();
+    }
+
+    /**
+     * @brief Publish the statistics as instrumentation gauges
+     *
+     * Registers <prefix>.blocks, <prefix>.high_water_slots and
+     * <prefix>.large_bytes so the periodic exporter surfaces them to
+     * SystemMonitor. No-op with the disabled policy.
+     *
+     * @param prefix Probe name prefix identifying this pool
+     */
+    void report_to_instrumentation(const std::string& prefix) const {
+        if (!StatsPolicy::enabled) {
+            return;
+        }
+        const PoolStats snapshot = stats();
+        auto& inst = Instrumentation::instance();
+        inst.record_gauge(inst.register_probe(prefix + ".blocks"),
+                          static_cast<int64_t>(snapshot.blocks_allocated));
+        inst.record_gauge(inst.register_probe(prefix + ".high_water_slots"),
+                          static_cast<int64_t>(snapshot.high_water_slots));
+        inst.record_gauge(
+            inst.register_probe(prefix + ".large_bytes"),
+            static_cast<int64_t>(snapshot.large_allocation_bytes));
+    }
+
     /**
      * @brief Destructor frees all allocated memory
+     *
+     * The pool's ID is retired so threads still holding a magazine for it
+     * drop the stale entry instead of handing out freed slots.
      */
-    ~MemoryPool() = default;
+    ~MemoryPool() {
+        std::lock_guard<std::mutex> lock(live_pools_mutex());
+        live_pools().erase(pool_id_);
+    }
 
 private:
+    /// Slots moved between a thread magazine and the shared pool per batch
+    static constexpr size_t kMagazineSize = 64;
+
     std::vector<std::unique_ptr<T[]>> blocks_;
     std::vector<std::unique_ptr<T[]>> large_allocations_;
+    std::vector<T*> free_list_;
     size_t current_block_;
     size_t current_slot_;
     mutable std::mutex mutex_;
-    
+    /// Identity used to key thread magazines; monotonic and never reused,
+    /// so a new pool at a recycled address cannot inherit a destroyed
+    /// predecessor's cached slots
+    const uint64_t pool_id_;
+
+    static std::atomic<uint64_t>& next_pool_id() {
+        static std::atomic<uint64_t> next{1};
+        return next;
+    }
+
+    /// IDs of pools currently alive, guarded by live_pools_mutex(); lets
+    /// threads discard magazines that outlived their pool
+    static std::unordered_set<uint64_t>& live_pools() {
+        static std::unordered_set<uint64_t> pools;
+        return pools;
+    }
+
+    static std::mutex& live_pools_mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    /**
+     * @brief This thread's magazine for this pool instance
+     *
+     * Keyed by pool ID rather than address. On the cold path that creates
+     * a new entry, magazines belonging to since-destroyed pools are pruned
+     * so the per-thread map stays bounded by the number of live pools.
+     */
+    std::vector<T*>& local_magazine() {
+        thread_local std::unordered_map<uint64_t, std::vector<T*>> magazines;
+        auto it = magazines.find(pool_id_);
+        if (it == magazines.end()) {
+            prune_dead_magazines(magazines);
+            it = magazines.emplace(pool_id_, std::vector<T*>()).first;
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Drop magazine entries whose pool no longer exists
+     */
+    static void prune_dead_magazines(
+        std::unordered_map<uint64_t, std::vector<T*>>& magazines) {
+        std::lock_guard<std::mutex> lock(live_pools_mutex());
+        for (auto it = magazines.begin(); it != magazines.end();) {
+            if (live_pools().count(it->first) == 0) {
+                it = magazines.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    /**
+     * @brief Refill a magazine from the free list, then the bump region
+     */
+    void refill_magazine(std::vector<T*>& magazine) {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        while (!free_list_.empty() && magazine.size() < kMagazineSize) {
+            magazine.push_back(free_list_.back());
+            free_list_.pop_back();
+        }
+
+        while (magazine.size() < kMagazineSize) {
+            if (current_slot_ >= BlockSize) {
+                if (current_block_ + 1 >= blocks_.size()) {
+                    grow(1);
+                }
+                ++current_block_;
+                current_slot_ = 0;
+            }
+            magazine.push_back(&blocks_[current_block_][current_slot_++]);
+        }
+        this->record_bump_high_water(current_block_ * BlockSize + current_slot_);
+    }
+
+    /**
+     * @brief Return the overflow half of a magazine to the shared free list
+     */
+    void flush_magazine(std::vector<T*>& magazine) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (magazine.size() > kMagazineSize) {
+            free_list_.push_back(magazine.back());
+            magazine.pop_back();
+        }
+    }
+
     /**
      * @brief Grow pool by specified number of blocks
      * @param count Number of blocks to add
@@ -124,6 +367,7 @@ private:
         for (size_t i = 0; i < count; ++i) {
             blocks_.push_back(std::make_unique<T[]>(BlockSize));
         }
+        this->record_blocks(count);
     }
 };
 
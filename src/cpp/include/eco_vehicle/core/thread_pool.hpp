@@ -1,6 +1,7 @@
 #pragma once
 
 #include <queue>
+#include <deque>
 #include <thread>
 #include <mutex>
 #include <future>
@@ -8,6 +9,9 @@
 #include <condition_variable>
 #include <vector>
 #include <memory>
+#include <atomic>
+#include <random>
+#include "eco_vehicle/core/instrumentation.hpp"
 #include "eco_vehicle/core/logging.hpp"
 
 namespace eco_vehicle {
@@ -15,38 +19,45 @@ namespace core {
 
 /**
  * @brief High-performance thread pool for parallel task execution
+ *
+ * Two scheduling modes are supported:
+ * - Shared-queue mode (default): all tasks flow through one mutex-protected
+ *   queue. Simple and fair, but the lock serializes every enqueue/dequeue.
+ * - Work-stealing mode: each worker owns a deque. Workers push and pop at
+ *   the back of their own deque without touching other queues; idle workers
+ *   steal from the front of a randomly chosen victim. External producers
+ *   distribute tasks round-robin, and enqueue_bulk() submits whole batches
+ *   under a single lock acquisition per target queue.
  */
 class ThreadPool {
 public:
     /**
      * @brief Initialize thread pool with specified number of threads
      * @param num_threads Number of worker threads
+     * @param work_stealing Enable per-worker deques with randomized stealing
      */
-    explicit ThreadPool(size_t num_threads = std::thread::hardware_concurrency())
-        : stop_(false) {
+    explicit ThreadPool(size_t num_threads = std::thread::hardware_concurrency(),
+                        bool work_stealing = false)
+        : stop_(false)
+        , work_stealing_(work_stealing)
+        , pending_(0)
+        , next_queue_(0) {
+        if (work_stealing_) {
+            for (size_t i = 0; i < num_threads; ++i) {
+                worker_queues_.push_back(std::make_unique<WorkerQueue>());
+            }
+        }
         for (size_t i = 0; i < num_threads; ++i) {
-            workers_.emplace_back([this] {
-                while (true) {
-                    std::function<void()> task;
-                    {
-                        std::unique_lock<std::mutex> lock(queue_mutex_);
-                        condition_.wait(lock, [this] {
-                            return stop_ || !tasks_.empty();
-                        });
-                        
-                        if (stop_ && tasks_.empty()) {
-                            return;
-                        }
-                        
-                        task = std::move(tasks_.front());
-                        tasks_.pop();
-                    }
-                    task();
+            workers_.emplace_back([this, i] {
+                if (work_stealing_) {
+                    run_stealing_worker(i);
+                } else {
+                    run_shared_worker();
                 }
             });
         }
     }
-    
+
     /**
      * @brief Enqueue task for execution
      * @param f Function to execute
@@ -54,36 +65,101 @@ public:
      * @return Future containing the result
      */
     template<class F, class... Args>
-    auto enqueue(F&& f, Args&&... args) 
+    auto enqueue(F&& f, Args&&... args)
         -> std::future<typename std::result_of<F(Args...)>::type> {
         using return_type = typename std::result_of<F(Args...)>::type;
-        
+
         auto task = std::make_shared<std::packaged_task<return_type()>>(
             std::bind(std::forward<F>(f), std::forward<Args>(args)...)
         );
-        
+
         std::future<return_type> res = task->get_future();
-        {
-            std::unique_lock<std::mutex> lock(queue_mutex_);
-            if (stop_) {
-                throw std::runtime_error("enqueue on stopped ThreadPool");
+        if (stop_.load(std::memory_order_relaxed)) {
+            throw std::runtime_error("enqueue on stopped ThreadPool");
+        }
+
+        if (work_stealing_) {
+            push_stealing([task]() { (*task)(); });
+        } else {
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                tasks_.emplace([task]() { (*task)(); });
             }
-            
-            tasks_.emplace([task]() { (*task)(); });
+            condition_.notify_one();
         }
-        condition_.notify_one();
+        ECO_PROBE_GAUGE("threadpool.queue_depth", queue_size());
         return res;
     }
-    
+
+    /**
+     * @brief Submit a batch of tasks with one lock acquisition per queue
+     *
+     * In work-stealing mode the batch is split into contiguous chunks, one
+     * per worker deque, so producers pay O(threads) lock operations instead
+     * of O(tasks). In shared-queue mode the whole batch is appended under a
+     * single lock.
+     *
+     * @param batch Tasks to execute; consumed by the call
+     */
+    void enqueue_bulk(std::vector<std::function<void()>>& batch) {
+        if (batch.empty()) {
+            return;
+        }
+        if (stop_.load(std::memory_order_relaxed)) {
+            throw std::runtime_error("enqueue on stopped ThreadPool");
+        }
+
+        if (work_stealing_) {
+            size_t queues = worker_queues_.size();
+            size_t chunk = (batch.size() + queues - 1) / queues;
+            size_t start = next_queue_.fetch_add(1, std::memory_order_relaxed);
+            for (size_t q = 0; q < queues; ++q) {
+                size_t begin = q * chunk;
+                if (begin >= batch.size()) {
+                    break;
+                }
+                size_t end = std::min(begin + chunk, batch.size());
+                WorkerQueue& target = *worker_queues_[(start + q) % queues];
+                {
+                    std::lock_guard<std::mutex> lock(target.mutex);
+                    for (size_t i = begin; i < end; ++i) {
+                        target.tasks.push_back(std::move(batch[i]));
+                    }
+                }
+            }
+            pending_.fetch_add(batch.size(), std::memory_order_release);
+            {
+                // Fence against workers evaluating the wait predicate: a
+                // worker that saw pending_ == 0 must reach wait() before
+                // the notify, or it would sleep through it
+                std::lock_guard<std::mutex> lock(queue_mutex_);
+            }
+            condition_.notify_all();
+        } else {
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                for (auto& task : batch) {
+                    tasks_.emplace(std::move(task));
+                }
+            }
+            condition_.notify_all();
+        }
+        batch.clear();
+        ECO_PROBE_GAUGE("threadpool.queue_depth", queue_size());
+    }
+
     /**
      * @brief Get current queue size
      * @return Number of pending tasks
      */
     size_t queue_size() const {
+        if (work_stealing_) {
+            return pending_.load(std::memory_order_acquire);
+        }
         std::unique_lock<std::mutex> lock(queue_mutex_);
         return tasks_.size();
     }
-    
+
     /**
      * @brief Get number of worker threads
      * @return Number of threads
@@ -91,7 +167,7 @@ public:
     size_t thread_count() const {
         return workers_.size();
     }
-    
+
     /**
      * @brief Stop all threads and clear queue
      */
@@ -107,7 +183,7 @@ public:
             }
         }
     }
-    
+
     /**
      * @brief Destructor ensures all threads are stopped
      */
@@ -116,12 +192,139 @@ public:
     }
 
 private:
+    /**
+     * @brief Per-worker deque; the mutex is effectively uncontended because
+     *        only the owner and the occasional thief touch it
+     */
+    struct WorkerQueue {
+        std::deque<std::function<void()>> tasks;
+        std::mutex mutex;
+    };
+
     std::vector<std::thread> workers_;
     std::queue<std::function<void()>> tasks_;
-    
+    std::vector<std::unique_ptr<WorkerQueue>> worker_queues_;
+
     mutable std::mutex queue_mutex_;
     std::condition_variable condition_;
-    bool stop_;
+    std::atomic<bool> stop_;
+    bool work_stealing_;
+    std::atomic<size_t> pending_;
+    std::atomic<size_t> next_queue_;
+
+    /**
+     * @brief Index of the worker deque owned by the calling thread, or -1
+     */
+    static int& local_worker_index() {
+        thread_local int index = -1;
+        return index;
+    }
+
+    /**
+     * @brief Push a task, preferring the calling worker's own deque
+     */
+    void push_stealing(std::function<void()> task) {
+        int local = local_worker_index();
+        size_t target = (local >= 0)
+            ? static_cast<size_t>(local)
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % worker_queues_.size();
+        {
+            std::lock_guard<std::mutex> lock(worker_queues_[target]->mutex);
+            worker_queues_[target]->tasks.push_back(std::move(task));
+        }
+        pending_.fetch_add(1, std::memory_order_release);
+        {
+            // Same fencing as stop(): lock the mutex the wait predicate
+            // runs under so the increment cannot slip between a worker's
+            // predicate check and its wait
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+        }
+        condition_.notify_one();
+    }
+
+    /**
+     * @brief Shared-queue worker loop (original behavior)
+     */
+    void run_shared_worker() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                condition_.wait(lock, [this] {
+                    return stop_.load() || !tasks_.empty();
+                });
+
+                if (stop_.load() && tasks_.empty()) {
+                    return;
+                }
+
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+
+    /**
+     * @brief Work-stealing worker loop: own deque first, then random victims
+     */
+    void run_stealing_worker(size_t index) {
+        local_worker_index() = static_cast<int>(index);
+        std::minstd_rand rng(static_cast<unsigned>(index) * 2654435761u + 1u);
+
+        while (true) {
+            std::function<void()> task;
+            if (try_pop_local(index, task) || try_steal(index, rng, task)) {
+                pending_.fetch_sub(1, std::memory_order_release);
+                task();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            condition_.wait(lock, [this] {
+                return stop_.load() || pending_.load(std::memory_order_acquire) > 0;
+            });
+            if (stop_.load() && pending_.load(std::memory_order_acquire) == 0) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Pop from the back of the worker's own deque (LIFO for locality)
+     */
+    bool try_pop_local(size_t index, std::function<void()>& task) {
+        WorkerQueue& queue = *worker_queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    /**
+     * @brief Steal from the front of a randomly chosen victim deque
+     */
+    bool try_steal(size_t thief, std::minstd_rand& rng, std::function<void()>& task) {
+        size_t queues = worker_queues_.size();
+        size_t offset = rng() % queues;
+        for (size_t i = 0; i < queues; ++i) {
+            size_t victim = (offset + i) % queues;
+            if (victim == thief) {
+                continue;
+            }
+            WorkerQueue& queue = *worker_queues_[victim];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
 };
 
 } // namespace core
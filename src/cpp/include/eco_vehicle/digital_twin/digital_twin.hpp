@@ -5,8 +5,11 @@
 #include <string>
 #include <chrono>
 #include <optional>
+#include <atomic>
+#include <functional>
 #include <tbb/concurrent_vector.h>
 #include "eco_vehicle/core/logging.hpp"
+#include "eco_vehicle/core/thread_pool.hpp"
 #include "eco_vehicle/physics/physics_engine.hpp"
 #include "eco_vehicle/autodesk/autocad_interface.hpp"
 #include "eco_vehicle/autodesk/fusion360_pipeline.hpp"
@@ -46,6 +49,135 @@ struct SimulationScenario {
     std::vector<SimulationEvent> events;
 };
 
+/**
+ * @brief Dense ID assigned to an interned sensor or component name
+ */
+using TelemetryKeyId = uint32_t;
+
+/**
+ * @brief Structure-of-arrays telemetry store with interned keys
+ *
+ * Sensor and component names are resolved once to dense integer IDs;
+ * readings are appended to contiguous per-key columns alongside a shared
+ * timestamp column. Scans over an hour of history become linear sweeps of
+ * a double array instead of per-state hash-map lookups, which is what
+ * update_state and predict_maintenance iterate over on the hot path.
+ */
+class TelemetryStore {
+public:
+    /**
+     * @brief Resolve a name to its dense ID, interning it on first use
+     */
+    TelemetryKeyId intern(const std::string& name);
+
+    /**
+     * @brief Look up an already-interned name without modifying the store
+     */
+    std::optional<TelemetryKeyId> find(const std::string& name) const;
+
+    /**
+     * @brief Append one sample to a key's column
+     */
+    void append(TelemetryKeyId key,
+                const std::chrono::system_clock::time_point& timestamp,
+                double value);
+
+    /**
+     * @brief Contiguous value column for a key, oldest first
+     */
+    const std::vector<double>& column(TelemetryKeyId key) const;
+
+    /**
+     * @brief Timestamp column parallel to every value column
+     */
+    const std::vector<std::chrono::system_clock::time_point>& timestamps(
+        TelemetryKeyId key) const;
+
+    /**
+     * @brief Number of interned keys
+     */
+    size_t key_count() const;
+
+private:
+    std::unordered_map<std::string, TelemetryKeyId> ids_;
+    std::vector<std::string> names_;
+    std::vector<std::vector<double>> columns_;
+    std::vector<std::vector<std::chrono::system_clock::time_point>> column_times_;
+};
+
+/**
+ * @brief Retention policy for the bounded state history
+ */
+struct HistoryRetention {
+    size_t full_rate_capacity;    // newest states kept at full telemetry rate
+    size_t decimated_capacity;    // older states kept after decimation
+    size_t decimation_factor;     // keep 1 of every N states past the full tier
+};
+
+/**
+ * @brief Bounded two-tier ring buffer over VehicleState history
+ *
+ * The full-rate tier holds the most recent states verbatim; states evicted
+ * from it are decimated into a second ring covering a longer horizon.
+ * Both tiers overwrite their oldest slot in O(1), so resident memory is
+ * fixed by the retention policy regardless of uptime. Writes come from the
+ * single telemetry thread and publish via an atomic head index, so readers
+ * never take a lock.
+ */
+class StateHistoryRing {
+public:
+    /**
+     * @brief Create a ring with the given retention policy
+     */
+    explicit StateHistoryRing(const HistoryRetention& retention);
+
+    /**
+     * @brief Append a state, evicting (and possibly demoting) the oldest
+     */
+    void push(const VehicleState& state);
+
+    /**
+     * @brief Collect states within a time range across both tiers
+     * @param start_time Start of time range
+     * @param end_time End of time range
+     * @return States in chronological order
+     */
+    std::vector<VehicleState> query(
+        const std::chrono::system_clock::time_point& start_time,
+        const std::chrono::system_clock::time_point& end_time) const;
+
+    /**
+     * @brief Number of states currently retained across both tiers
+     */
+    size_t size() const;
+
+private:
+    HistoryRetention retention_;
+    std::vector<VehicleState> full_tier_;
+    std::vector<VehicleState> decimated_tier_;
+    std::atomic<uint64_t> full_head_;
+    std::atomic<uint64_t> decimated_head_;
+    uint64_t push_count_;
+
+    /**
+     * @brief Demote an evicted full-rate state into the decimated tier
+     */
+    void demote(const VehicleState& state);
+};
+
+/**
+ * @brief Immutable, versioned view of a twin's state
+ *
+ * The pointed-to state never mutates after publication; holding the
+ * shared_ptr keeps it alive for as long as the reader needs, no matter
+ * how many updates are published meanwhile. Versions are strictly
+ * increasing, so readers can detect staleness or change cheaply.
+ */
+struct StateSnapshot {
+    std::shared_ptr<const VehicleState> state;
+    uint64_t version{0};
+};
+
 /**
  * @brief Digital twin for physical vehicle representation
  */
@@ -59,19 +191,58 @@ public:
     DigitalTwin(
         const std::string& vehicle_id,
         const Config& config);
-    
+
+    /**
+     * @brief Initialize digital twin over a shared physics engine
+     *
+     * Used by TwinFleet (see twin_fleet.hpp): the engine and its device
+     * buffers are owned by the fleet and shared by every hosted twin, so
+     * only this twin's mutable state is allocated here.
+     *
+     * @param vehicle_id Unique identifier for the vehicle
+     * @param config Configuration parameters
+     * @param shared_engine Physics engine shared with other twins
+     */
+    DigitalTwin(
+        const std::string& vehicle_id,
+        const Config& config,
+        std::shared_ptr<physics::PhysicsEngine> shared_engine);
+
     /**
      * @brief Update digital twin state with new telemetry data
      * @param telemetry_data New telemetry data from physical vehicle
      * @return True if update successful
      */
     bool update_state(const TelemetryData& telemetry_data);
-    
+
+    /**
+     * @brief Apply a batch of telemetry updates in arrival order
+     *
+     * Used by TelemetryIngestor (see telemetry_ring.hpp): locking,
+     * validation setup and model refresh are paid once per batch
+     * instead of once per point.
+     *
+     * @param batch Updates in arrival order
+     * @return Number of updates applied successfully
+     */
+    size_t update_state_batch(const std::vector<TelemetryData>& batch);
+
     /**
      * @brief Predict maintenance needs based on current state and history
      * @return Maintenance predictions
      */
     MaintenancePrediction predict_maintenance();
+
+    /**
+     * @brief Enable incremental maintenance prediction
+     *
+     * When enabled, update_state maintains per-component running aggregates
+     * (health EWMA, cumulative stress counters) and predict_maintenance
+     * reads them in O(components) instead of rescanning the full history.
+     *
+     * @param ewma_alpha Smoothing factor for the per-component health EWMA
+     */
+    void enable_incremental_prediction(double ewma_alpha = 0.05);
     
     /**
      * @brief Run simulation using current state
@@ -79,7 +250,72 @@ public:
      * @return Simulation results
      */
     SimulationResult run_simulation(const SimulationScenario& scenario);
+
+    /**
+     * @brief Result of one scenario in a batch run
+     */
+    struct ScenarioOutcome {
+        size_t scenario_index;    // position in the submitted batch
+        SimulationResult result;
+        double score;             // ranking metric, higher is better
+    };
+
+    /**
+     * @brief Maps a simulation result to its ranking score
+     */
+    using ScenarioScorer = std::function<double(const SimulationResult&)>;
+
+    /**
+     * @brief Evaluate many scenarios against the current state in parallel
+     *
+     * What-if analysis runs dozens of scenarios (route options, payload
+     * variants) off the same base state. Each scenario gets a lightweight
+     * copy-on-write fork: the current state snapshot and the environment
+     * data common to the batch are shared read-only across workers, and
+     * only a scenario's own overrides and evolving simulation state are
+     * private to it. Scenarios execute as independent tasks on the pool
+     * and outcomes come back sorted by the scorer, best first — or in
+     * submission order when no scorer is given. The twin keeps updating
+     * from telemetry throughout; the batch sees the snapshot it forked.
+     *
+     * @param scenarios Scenarios to evaluate against the current state
+     * @param thread_pool Pool to dispatch scenario tasks on
+     * @param scorer Ranking metric; empty preserves submission order
+     * @return One outcome per scenario, ranked
+     */
+    std::vector<ScenarioOutcome> run_simulation_batch(
+        const std::vector<SimulationScenario>& scenarios,
+        core::ThreadPool& thread_pool,
+        ScenarioScorer scorer = {});
+
+    /**
+     * @brief Switch the twin to deterministic replay mode
+     *
+     * Seeds every internal random source, replaces wall-clock reads
+     * with a logical tick advanced per update, and runs the simulation
+     * single-threaded, so identical inputs yield bit-identical results.
+     * Used by TwinReplayHarness (see replay.hpp) for A/B solver
+     * comparisons.
+     *
+     * @param seed Seed for all random sources while the mode is active
+     */
+    void set_deterministic_mode(uint64_t seed);
     
+    /**
+     * @brief Read the current state without taking a lock
+     *
+     * update_state builds each new state off to the side and publishes
+     * it with an atomic shared_ptr exchange; readers grab the current
+     * pointer wait-free and keep a coherent, immutable state for as
+     * long as they hold it. Reclamation rides the shared_ptr reference
+     * count — a superseded snapshot is freed when its last reader drops
+     * it — so any number of dashboard, analytics or predictor readers
+     * run concurrently without adding jitter to the update path.
+     *
+     * @return Snapshot valid until released; empty before first update
+     */
+    StateSnapshot current_snapshot() const;
+
     /**
      * @brief Get current performance metrics
      * @return Performance metrics
@@ -101,16 +337,48 @@ private:
     std::string vehicle_id_;
     Config config_;
     std::unique_ptr<VehicleState> current_state_;
-    tbb::concurrent_vector<VehicleState> history_;
+
+    // Published snapshot (see current_snapshot); swapped atomically by
+    // update_state, read wait-free by any number of threads
+    std::shared_ptr<const VehicleState> published_state_;
+    std::atomic<uint64_t> published_version_{0};
+
+    StateHistoryRing history_;
+    TelemetryStore telemetry_;
     
-    // Subsystems
-    std::unique_ptr<physics::PhysicsEngine> physics_engine_;
+    // Subsystems (the engine may be shared across a TwinFleet)
+    std::shared_ptr<physics::PhysicsEngine> physics_engine_;
     std::unique_ptr<autodesk::AutoCADInterface> cad_interface_;
     std::unique_ptr<autodesk::Fusion360Pipeline> fusion_interface_;
     
     // Performance tracking
     PerformanceTracker performance_tracker_;
-    
+
+    /**
+     * @brief Running aggregates maintained per component for incremental
+     *        maintenance prediction
+     */
+    struct ComponentAggregates {
+        double health_ewma;
+        double stress_accumulated;
+        uint64_t sample_count;
+        std::chrono::system_clock::time_point last_update;
+    };
+
+    // Deterministic replay state (see set_deterministic_mode)
+    std::optional<uint64_t> deterministic_seed_;
+    uint64_t logical_tick_ = 0;
+
+    // Incremental prediction state (see enable_incremental_prediction)
+    bool incremental_prediction_ = false;
+    double ewma_alpha_ = 0.05;
+    std::unordered_map<TelemetryKeyId, ComponentAggregates> component_aggregates_;
+
+    /**
+     * @brief Fold one state into the per-component running aggregates
+     */
+    void update_component_aggregates(const VehicleState& state);
+
     /**
      * @brief Create state from telemetry data
      */
@@ -142,12 +410,38 @@ private:
      */
     SimulationEnvironment setup_simulation_environment(
         const SimulationScenario& scenario);
-    
+
     /**
      * @brief Execute simulation and return results
      */
     SimulationResult execute_simulation(
         const SimulationEnvironment& sim_env);
+
+    /**
+     * @brief Copy-on-write fork of the simulation base for one scenario
+     *
+     * The base state snapshot and the batch-wide environment are held by
+     * shared pointer and never copied; only the scenario's environment
+     * overrides live in the fork.
+     */
+    struct SimulationFork {
+        std::shared_ptr<const VehicleState> base_state;
+        std::shared_ptr<const SimulationEnvironment> shared_environment;
+        std::unordered_map<std::string, double> environment_overrides;
+    };
+
+    /**
+     * @brief Fork the current snapshot and batch environment for a scenario
+     */
+    SimulationFork fork_simulation_state(
+        const std::shared_ptr<const SimulationEnvironment>& shared_environment,
+        const SimulationScenario& scenario) const;
+
+    /**
+     * @brief Execute one scenario against its fork (worker-thread safe)
+     */
+    SimulationResult execute_fork(const SimulationFork& fork,
+                                  const SimulationScenario& scenario) const;
 };
 
 } // namespace digital_twin
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace eco_vehicle {
+namespace digital_twin {
+
+class DigitalTwin;
+
+/**
+ * @brief One raw telemetry frame as received from the network
+ *
+ * Slots are fixed width so the ring stays a flat array the producer can
+ * write without allocation; frames are decoded in place by the consumer.
+ */
+struct RawTelemetryFrame {
+    static constexpr size_t kMaxPayload = 1472;  ///< One UDP datagram
+
+    uint64_t receive_tick;              ///< Producer-side arrival tick
+    uint32_t length;                    ///< Valid bytes in payload
+    uint8_t payload[kMaxPayload];
+};
+
+/**
+ * @brief Single-producer single-consumer ring of raw telemetry frames
+ *
+ * The gateway's network thread pushes one frame per datagram; the twin
+ * consumer drains whole batches. Head and tail are the only shared
+ * state, published with acquire/release atomics, so the steady-state
+ * path takes no lock and copies each frame exactly once — into its
+ * slot. The slot array is allocated page-aligned up front so it can be
+ * registered with the NIC or pinned for DMA by the deployment that
+ * needs it. When the ring is full the producer drops the frame and
+ * counts it rather than blocking the receive loop.
+ */
+class TelemetryRing {
+public:
+    /**
+     * @brief Create a ring with the given capacity
+     * @param capacity Slot count; rounded up to a power of two
+     */
+    explicit TelemetryRing(size_t capacity) {
+        size_t slots = 1;
+        while (slots < capacity) {
+            slots <<= 1;
+        }
+        mask_ = slots - 1;
+        slots_.resize(slots);
+    }
+
+    /**
+     * @brief Producer side: copy one frame into the ring
+     * @return False if the ring was full and the frame was dropped
+     */
+    bool try_push(uint64_t receive_tick, const uint8_t* data, uint32_t length) {
+        if (length > RawTelemetryFrame::kMaxPayload) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        const uint64_t tail = tail_.load(std::memory_order_acquire);
+        if (head - tail > mask_) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        RawTelemetryFrame& slot = slots_[head & mask_];
+        slot.receive_tick = receive_tick;
+        slot.length = length;
+        std::memcpy(slot.payload, data, length);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumer side: drain up to max_frames into the batch
+     *
+     * Pointers in the batch refer to ring slots and stay valid until the
+     * next drain call, which is what lets the consumer decode in place:
+     * the slots of the previous batch are handed back to the producer
+     * only here, never while the consumer may still be reading them.
+     *
+     * @param batch Cleared then filled with slot pointers, oldest first
+     * @param max_frames Upper bound on frames taken this call
+     * @return Frames drained
+     */
+    size_t drain(std::vector<RawTelemetryFrame*>& batch, size_t max_frames) {
+        batch.clear();
+        tail_.store(consumed_, std::memory_order_release);
+        const uint64_t head = head_.load(std::memory_order_acquire);
+        uint64_t tail = consumed_;
+        while (tail < head && batch.size() < max_frames) {
+            batch.push_back(&slots_[tail & mask_]);
+            ++tail;
+        }
+        consumed_ = tail;
+        return batch.size();
+    }
+
+    /**
+     * @brief Frames currently buffered, including an in-flight batch
+     */
+    size_t size() const {
+        return static_cast<size_t>(head_.load(std::memory_order_acquire) -
+                                   tail_.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Frames dropped because the ring was full or oversized
+     */
+    uint64_t dropped() const {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::vector<RawTelemetryFrame> slots_;
+    size_t mask_{0};
+    std::atomic<uint64_t> head_{0};
+    std::atomic<uint64_t> tail_{0};
+    std::atomic<uint64_t> dropped_{0};
+    uint64_t consumed_{0};  ///< Consumer-private cursor; published as
+                            ///< tail_ on the next drain, when the
+                            ///< previous batch is done being decoded
+};
+
+/**
+ * @brief Ingestion statistics
+ */
+struct IngestStats {
+    uint64_t frames_applied{0};    ///< Decoded frames applied to the twin
+    uint64_t frames_rejected{0};   ///< Frames that failed decoding
+    uint64_t batches{0};           ///< Drain cycles executed
+    uint64_t ring_dropped{0};      ///< Producer-side drops (ring full)
+};
+
+/**
+ * @brief Twin-side consumer draining a TelemetryRing in batches
+ *
+ * Replaces per-packet update_state calls from the gateway: a dedicated
+ * consumer thread drains whole bursts per cycle, decodes frames in
+ * place in their ring slots, and applies each batch through
+ * DigitalTwin::update_state_batch so per-call locking and validation
+ * setup are paid once per batch instead of once per point.
+ */
+class TelemetryIngestor {
+public:
+    /**
+     * @brief Create an ingestor over a ring and its target twin
+     * @param ring Ring the network thread fills
+     * @param twin Twin receiving the decoded updates
+     * @param batch_limit Max frames decoded per drain cycle
+     */
+    TelemetryIngestor(TelemetryRing& ring, DigitalTwin& twin,
+                      size_t batch_limit = 4096);
+
+    ~TelemetryIngestor();
+
+    /**
+     * @brief Start the consumer thread
+     */
+    void start();
+
+    /**
+     * @brief Drain remaining frames, then stop the consumer thread
+     */
+    void stop();
+
+    /**
+     * @brief Snapshot of ingestion statistics
+     */
+    IngestStats stats() const;
+
+private:
+    TelemetryRing& ring_;
+    DigitalTwin& twin_;
+    size_t batch_limit_;
+    std::thread consumer_;
+    std::atomic<bool> running_{false};
+    IngestStats stats_;
+
+    /**
+     * @brief Consumer loop: drain, decode in place, apply as one batch
+     */
+    void consume_loop();
+};
+
+} // namespace digital_twin
+} // namespace eco_vehicle
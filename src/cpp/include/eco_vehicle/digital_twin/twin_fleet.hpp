@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "eco_vehicle/core/thread_pool.hpp"
+#include "eco_vehicle/digital_twin/digital_twin.hpp"
+#include "eco_vehicle/physics/physics_engine.hpp"
+
+namespace eco_vehicle {
+namespace digital_twin {
+
+/**
+ * @brief Memory and scheduling statistics for a fleet
+ */
+struct FleetStats {
+    size_t twin_count{0};             ///< Twins currently hosted
+    size_t shared_config_bytes{0};    ///< Config/model data held once
+    size_t per_twin_bytes{0};         ///< Average resident bytes per twin
+    uint64_t batched_updates{0};      ///< Updates executed in vectorized passes
+    uint64_t scalar_updates{0};       ///< Updates that fell back to per-twin paths
+};
+
+/**
+ * @brief Hosts many digital twins over one shared physics workspace
+ *
+ * A standalone DigitalTwin owns its own PhysicsEngine, CAD interfaces and
+ * buffers; 200 of them on one depot server duplicate all of that state.
+ * TwinFleet inverts the ownership: one PhysicsEngine (and its device
+ * buffers), one ThreadPool and one immutable Config/model snapshot are
+ * shared by every hosted twin, so per-twin memory shrinks to the mutable
+ * state that actually differs between vehicles — current state, history
+ * ring and telemetry columns.
+ *
+ * Telemetry is applied through update_states(), which groups the batch by
+ * twin, runs the cheap per-twin bookkeeping on the shared pool, and packs
+ * the homogeneous physics work into PhysicsEngine::calculate_motion_batch
+ * so the whole fleet integrates in one pass instead of one engine call per
+ * vehicle.
+ */
+class TwinFleet {
+public:
+    /// Stable handle for a hosted twin
+    using TwinId = uint32_t;
+
+    /**
+     * @brief Create a fleet over a shared configuration
+     * @param config Configuration shared immutably by every hosted twin
+     * @param num_threads Worker threads for the shared pool
+     */
+    TwinFleet(const Config& config,
+              size_t num_threads = std::thread::hardware_concurrency());
+
+    ~TwinFleet();
+
+    /**
+     * @brief Host a new twin for a vehicle
+     *
+     * The twin is created against the shared engine and config; only its
+     * mutable state is allocated per vehicle.
+     *
+     * @param vehicle_id Unique identifier for the vehicle
+     * @return Handle used for updates and lookups
+     */
+    TwinId add_twin(const std::string& vehicle_id);
+
+    /**
+     * @brief Remove a hosted twin and release its mutable state
+     */
+    void remove_twin(TwinId id);
+
+    /**
+     * @brief Apply one telemetry batch across the fleet
+     *
+     * Updates are grouped by twin, per-twin bookkeeping runs in parallel
+     * on the shared pool, and the physics integration for all affected
+     * twins is submitted as one calculate_motion_batch call. Returns when
+     * every update in the batch has been applied.
+     *
+     * @param batch (twin, telemetry) pairs, any order
+     * @return Number of updates applied successfully
+     */
+    size_t update_states(
+        const std::vector<std::pair<TwinId, TelemetryData>>& batch);
+
+    /**
+     * @brief Run maintenance prediction for every hosted twin
+     *
+     * Predictions are independent per twin and fan out over the shared
+     * pool.
+     *
+     * @param results Preallocated output, resized to the fleet size
+     */
+    void predict_maintenance_all(
+        std::vector<std::pair<TwinId, MaintenancePrediction>>& results);
+
+    /**
+     * @brief Access a hosted twin for per-vehicle queries
+     */
+    DigitalTwin& twin(TwinId id);
+    const DigitalTwin& twin(TwinId id) const;
+
+    /**
+     * @brief Number of twins currently hosted
+     */
+    size_t size() const;
+
+    /**
+     * @brief Snapshot of fleet memory and batching statistics
+     */
+    FleetStats stats() const;
+
+private:
+    /**
+     * @brief Mutable per-twin slot; everything heavy lives in shared_
+     */
+    struct Slot {
+        std::string vehicle_id;
+        std::unique_ptr<DigitalTwin> twin;
+        bool active{false};
+    };
+
+    /**
+     * @brief State held once and shared immutably by every twin
+     */
+    struct Shared {
+        Config config;
+        std::shared_ptr<physics::PhysicsEngine> physics_engine;
+        std::unique_ptr<core::ThreadPool> pool;
+    };
+
+    std::shared_ptr<Shared> shared_;
+    std::vector<Slot> slots_;
+    std::vector<TwinId> free_ids_;
+    std::unordered_map<std::string, TwinId> by_vehicle_;
+    mutable std::mutex mutex_;
+    FleetStats stats_;
+
+    /**
+     * @brief Pack one batch group into a calculate_motion_batch call
+     */
+    void integrate_group(
+        const std::vector<TwinId>& twins,
+        const std::vector<const TelemetryData*>& telemetry);
+};
+
+} // namespace digital_twin
+} // namespace eco_vehicle
@@ -32,6 +32,43 @@ struct ForceVector {
     Eigen::Vector3d application_point;    // Relative to component origin
 };
 
+/**
+ * @brief Structure-of-arrays batch of forces for vectorized accumulation
+ *
+ * A ForceVector list costs a scalar Eigen expression per force; the aero
+ * model emits thousands of surface-panel forces per vehicle per step, so
+ * that per-force overhead dominates high-fidelity steps. ForceBatch lays
+ * the same data out as contiguous coordinate columns, which lets
+ * accumulate() reduce net force and torque with vectorized sweeps over
+ * plain double arrays. Columns are parallel: entry i of every array
+ * describes one force.
+ */
+struct ForceBatch {
+    std::vector<double> magnitude;     ///< Newtons
+    std::vector<double> dir_x, dir_y, dir_z;  ///< Unit direction components
+    std::vector<double> app_x, app_y, app_z;  ///< Application point, origin-relative
+
+    /**
+     * @brief Append one force, keeping the columns parallel
+     */
+    void push_back(const ForceVector& force);
+
+    /**
+     * @brief Drop all forces but keep column capacity for the next step
+     */
+    void clear();
+
+    size_t size() const { return magnitude.size(); }
+
+    /**
+     * @brief Reduce the batch to net force and torque in one pass
+     * @param net_force Sum of magnitude-scaled directions
+     * @param net_torque Sum of application-point cross products
+     */
+    void accumulate(Eigen::Vector3d& net_force,
+                    Eigen::Vector3d& net_torque) const;
+};
+
 /**
  * @brief Result of collision detection
  */
@@ -42,6 +79,125 @@ struct CollisionResult {
     double penetration_depth;
 };
 
+/**
+ * @brief Broad-phase collision world over a uniform spatial grid
+ *
+ * Objects are registered once and bucketed by position into grid cells;
+ * position updates only rehash objects that cross a cell boundary.
+ * find_candidate_pairs() returns the neighbouring-cell pairs that the
+ * exact narrow-phase test (PhysicsEngine::check_collision) should see,
+ * replacing the O(n²) all-pairs sweep in the fleet-simulation layer.
+ */
+class CollisionWorld {
+public:
+    using ObjectId = uint32_t;
+
+    /**
+     * @brief Create a collision world
+     * @param cell_size Grid cell edge length in meters; should be on the
+     *        order of the largest registered object's bounding diameter
+     */
+    explicit CollisionWorld(double cell_size);
+
+    /**
+     * @brief Register an object once; returns a stable handle
+     * @param properties Physical properties (bounding extent is derived
+     *        from PhysicalProperties::dimensions)
+     * @param position Initial world position
+     */
+    ObjectId register_object(
+        const PhysicalProperties& properties,
+        const Eigen::Vector3d& position);
+
+    /**
+     * @brief Remove an object from the world
+     */
+    void unregister_object(ObjectId id);
+
+    /**
+     * @brief Update an object's position, rebucketing only on cell change
+     */
+    void update_position(ObjectId id, const Eigen::Vector3d& position);
+
+    /**
+     * @brief Collect candidate pairs whose bounds overlap in the grid
+     * @param pairs Preallocated output buffer, cleared then filled
+     */
+    void find_candidate_pairs(
+        std::vector<std::pair<ObjectId, ObjectId>>& pairs) const;
+
+private:
+    struct GridCell;
+    struct Entry;
+
+    double cell_size_;
+    std::vector<Entry> entries_;
+    std::unordered_map<int64_t, GridCell> cells_;
+
+    /**
+     * @brief Hash a world position to a packed cell key
+     */
+    int64_t cell_key(const Eigen::Vector3d& position) const;
+};
+
+/**
+ * @brief Integration scheme selection for calculate_motion
+ */
+enum class IntegratorScheme {
+    ExplicitRK4,       ///< Fixed-order explicit Runge-Kutta (previous default)
+    AdamsBashforth,    ///< Multistep explicit; one force evaluation per step
+    ImplicitBDF        ///< Implicit backward differentiation for stiff bodies
+};
+
+/**
+ * @brief Per-body adaptive step control parameters
+ */
+struct StepControl {
+    double min_step{1e-6};        ///< Floor for local refinement, seconds
+    double max_step{1e-2};        ///< Ceiling for smooth segments, seconds
+    double error_tolerance{1e-6}; ///< Local truncation error bound per step
+    double stiffness_threshold{1e3}; ///< Eigenvalue ratio that switches a body
+                                     ///< to the implicit scheme mid-run
+};
+
+/**
+ * @brief One integration scheme over the engine's equations of motion
+ *
+ * Implementations advance a body by one step and report an error
+ * estimate the adaptive controller uses to grow or shrink the next
+ * step. Multistep schemes keep their own force history per body, so one
+ * integrator instance serves a whole trajectory.
+ */
+class Integrator {
+public:
+    virtual ~Integrator() = default;
+
+    /**
+     * @brief Advance one body by up to dt seconds
+     * @param state State advanced in place
+     * @param net_force Net force at the step start
+     * @param mass Body mass in kg
+     * @param dt Requested step; the integrator may take a shorter one
+     * @return Step actually taken and its local error estimate
+     */
+    virtual std::pair<double, double> step(
+        State& state,
+        const Eigen::Vector3d& net_force,
+        double mass,
+        double dt) = 0;
+
+    /**
+     * @brief Drop accumulated history (multistep schemes) after a
+     *        discontinuity such as a contact event
+     */
+    virtual void reset() = 0;
+};
+
+/**
+ * @brief Create an integrator for the given scheme
+ */
+std::unique_ptr<Integrator> make_integrator(IntegratorScheme scheme);
+
 /**
  * @brief High-performance physics engine for vehicle simulation
  */
@@ -64,7 +220,60 @@ public:
         const State& initial_state,
         const std::vector<ForceVector>& forces,
         double duration);
-    
+
+    /**
+     * @brief Calculate motion from a batched force set
+     *
+     * Accepts the aero model's ForceBatch directly: the net force and
+     * torque are reduced by ForceBatch::accumulate in one vectorized
+     * pass per step, avoiding the per-force scalar overhead of the
+     * ForceVector-list overload on panel-resolution force sets.
+     *
+     * @param initial_state Initial position, velocity, and acceleration
+     * @param forces Batched forces acting on the vehicle
+     * @param duration Duration of simulation in seconds
+     * @return Motion history
+     */
+    MotionResult calculate_motion(
+        const State& initial_state,
+        const ForceBatch& forces,
+        double duration);
+
+    /**
+     * @brief Calculate motion for a whole fleet in one GPU round trip
+     *
+     * States and per-vehicle force lists are packed into contiguous device
+     * buffers, uploaded in a single transfer and integrated by one kernel
+     * launch, amortizing PCIe latency across the batch.
+     *
+     * @param initial_states One initial state per vehicle
+     * @param forces Per-vehicle force lists (same length as initial_states)
+     * @param duration Duration of simulation in seconds
+     * @param results Preallocated output buffer, resized to the batch size
+     */
+    void calculate_motion_batch(
+        const std::vector<State>& initial_states,
+        const std::vector<std::vector<ForceVector>>& forces,
+        double duration,
+        std::vector<MotionResult>& results);
+
+    /**
+     * @brief Select the integration scheme and adaptive step bounds
+     *
+     * calculate_motion previously marched a fixed time_step from config,
+     * which forced tiny steps globally whenever one stiff suspension
+     * body needed them. With a scheme and StepControl set, each body
+     * carries its own step size: smooth highway segments grow toward
+     * max_step while stiff contact events refine locally, and bodies
+     * whose stiffness ratio crosses the configured threshold switch to
+     * the implicit scheme mid-run. Without this call the engine behaves
+     * as before (fixed-step ExplicitRK4).
+     *
+     * @param scheme Scheme used for non-stiff bodies
+     * @param control Per-body step bounds and error tolerance
+     */
+    void set_integrator(IntegratorScheme scheme, const StepControl& control);
+
     /**
      * @brief Calculate component deformation under applied forces
      * @param component Physical properties of the component
@@ -74,7 +283,24 @@ public:
     DeformationResult calculate_deformation(
         const PhysicalProperties& component,
         const std::vector<ForceVector>& forces);
-    
+
+    /**
+     * @brief Cache stiffness factorizations across deformation calls
+     *
+     * The maintenance predictor queries the same component geometries
+     * with slowly varying forces, yet each call assembled and solved the
+     * stiffness system from scratch. With warm start enabled the
+     * assembled stiffness matrix is factorized once per component,
+     * cached keyed on a hash of its PhysicalProperties, and later calls
+     * on the same geometry solve only the new right-hand side — a
+     * back-substitution instead of a full factorization. Entries are
+     * evicted least-recently-used at the capacity bound; a change to a
+     * component's properties hashes to a new key and refactorizes.
+     *
+     * @param cache_capacity Factorizations kept resident
+     */
+    void enable_deformation_warm_start(size_t cache_capacity = 64);
+
     /**
      * @brief Check for collision between two objects
      * @param object1 First object properties and position
@@ -97,7 +323,26 @@ private:
     double gravity_;
     double air_density_;
     double time_step_;
-    
+
+    // Integrator selection (see set_integrator)
+    IntegratorScheme integrator_scheme_{IntegratorScheme::ExplicitRK4};
+    StepControl step_control_;
+    bool adaptive_stepping_{false};
+
+    /**
+     * @brief Cached stiffness factorization for one component geometry
+     */
+    struct StiffnessFactorization {
+        Eigen::LLT<Eigen::MatrixXd> factorization;
+        uint64_t last_used;
+    };
+
+    // Warm-start deformation state (see enable_deformation_warm_start)
+    bool deformation_warm_start_{false};
+    size_t stiffness_cache_capacity_{64};
+    uint64_t stiffness_cache_clock_{0};
+    std::unordered_map<uint64_t, StiffnessFactorization> stiffness_cache_;
+
     // GPU resources
     struct CudaResources;
     std::unique_ptr<CudaResources> cuda_resources_;
@@ -114,6 +359,18 @@ private:
         const Eigen::Vector3d& velocity,
         double time);
     
+    /**
+     * @brief Integrate all batched trajectories with a single kernel launch
+     *
+     * Device-side state/force buffers are grown geometrically and reused
+     * across ticks so steady-state batches allocate nothing.
+     */
+    void solve_motion_batch_gpu(
+        const std::vector<State>& initial_states,
+        const std::vector<std::vector<ForceVector>>& forces,
+        double duration,
+        std::vector<MotionResult>& results);
+
     /**
      * @brief Solve motion equations using GPU acceleration
      */
@@ -123,6 +380,19 @@ private:
         double duration,
         MotionResult& result);
     
+    /**
+     * @brief Hash a component's geometry and material for cache keying
+     */
+    uint64_t hash_properties(const PhysicalProperties& component) const;
+
+    /**
+     * @brief Fetch or build the factorization for a component
+     *
+     * Evicts the least-recently-used entry when the cache is full.
+     */
+    StiffnessFactorization& acquire_factorization(
+        const PhysicalProperties& component);
+
     /**
      * @brief Calculate stress tensor for a component
      */
@@ -8,6 +8,7 @@
 #include <boost/graph/adjacency_list.hpp>
 #include "eco_vehicle/core/logging.hpp"
 #include "eco_vehicle/core/config.hpp"
+#include "eco_vehicle/core/thread_pool.hpp"
 
 namespace eco_vehicle {
 namespace uml {
@@ -55,6 +56,23 @@ struct Transition {
     std::string action;
 };
 
+/**
+ * @brief One diagram in a batch render request
+ *
+ * Carries the inputs for exactly one of the three diagram kinds; the
+ * unused vectors stay empty.
+ */
+struct DiagramJob {
+    enum class Kind { Class, Sequence, State };
+
+    Kind kind;
+    std::vector<ClassDefinition> classes;
+    std::vector<SequenceMessage> messages;
+    std::vector<State> states;
+    std::vector<Transition> transitions;
+    std::string filename;
+};
+
 /**
  * @brief High-performance UML diagram generator
  */
@@ -98,6 +116,26 @@ public:
         const std::vector<Transition>& transitions,
         const std::string& filename);
     
+    /**
+     * @brief Render a batch of independent diagrams concurrently
+     *
+     * The survey pipeline emits one diagram per department plus the
+     * rollups and previously rendered them one at a time. Jobs are
+     * dispatched on the shared pool: each worker builds and lays out
+     * its own graph while the font-metrics and layout caches, warmed
+     * once before dispatch, are shared read-only. Rendered bytes are
+     * handed to a buffered background writer so workers move to the
+     * next diagram without waiting on disk; the call returns after
+     * every job is rendered and flushed.
+     *
+     * @param jobs Diagrams to render (independent of each other)
+     * @param thread_pool Pool to dispatch render tasks on
+     * @return Output path per job, in job order; nullopt on failure
+     */
+    std::vector<std::optional<std::filesystem::path>> render_batch(
+        const std::vector<DiagramJob>& jobs,
+        core::ThreadPool& thread_pool);
+
     /**
      * @brief Get current performance metrics
      * @return Generator performance metrics
@@ -188,6 +226,41 @@ private:
      * @brief Add transition to state diagram
      */
     void add_transition(Graph& graph, const Transition& transition);
+
+    /**
+     * @brief Caches shared read-only across batch render workers
+     *
+     * Font metrics and layout seeds are immutable after warm-up, so
+     * concurrent jobs read them without synchronization.
+     */
+    struct RenderCaches {
+        std::unordered_map<std::string, double> font_metrics;
+        std::unordered_map<std::string, std::vector<double>> layout_seeds;
+    };
+
+    /**
+     * @brief Warm the shared caches before dispatching a batch
+     */
+    std::shared_ptr<const RenderCaches> warm_render_caches(
+        const std::vector<DiagramJob>& jobs);
+
+    /**
+     * @brief Render one batch job using the shared caches
+     */
+    std::optional<std::filesystem::path> render_job(
+        const DiagramJob& job,
+        const RenderCaches& caches);
+
+    /**
+     * @brief Queue rendered bytes for buffered background writing
+     */
+    void enqueue_output(const std::filesystem::path& path,
+                        std::vector<char> bytes);
+
+    /**
+     * @brief Block until queued outputs reach disk
+     */
+    void flush_outputs();
 };
 
 } // namespace uml
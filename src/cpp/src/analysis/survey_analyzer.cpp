@@ -1,6 +1,8 @@
 #include "eco_vehicle/analysis/survey_analyzer.hpp"
 #include <fstream>
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <numeric>
 #include <boost/algorithm/string.hpp>
 #include <nlohmann/json.hpp>
@@ -42,7 +44,10 @@ bool SurveyAnalyzer::load_survey_data(const std::filesystem::path& json_path) {
             
             survey_responses_.push_back(sr);
         }
-        
+
+        department_index_valid_ = false;
+        comment_index_valid_ = false;
+        score_matrix_valid_ = false;
         logger_.info("Loaded {} survey responses", survey_responses_.size());
         return true;
     } catch (const std::exception& e) {
@@ -51,37 +56,944 @@ bool SurveyAnalyzer::load_survey_data(const std::filesystem::path& json_path) {
     }
 }
 
+namespace {
+
+// SAX handler that streams "responses" records straight into the response
+// vector, so the parse never materializes the JSON DOM
+class StreamingResponseHandler : public json::json_sax_t {
+public:
+    explicit StreamingResponseHandler(std::vector<SurveyResponse>& responses)
+        : responses_(responses) {}
+
+    bool key(string_t& val) override {
+        current_key_ = val;
+        return true;
+    }
+
+    bool start_array(std::size_t) override {
+        if (!in_responses_ && current_key_ == "responses") {
+            in_responses_ = true;
+        } else if (response_depth_ == 1 && current_key_ == "feedback_comments") {
+            in_comments_ = true;
+        }
+        return true;
+    }
+
+    bool end_array() override {
+        if (in_comments_) {
+            in_comments_ = false;
+        } else if (in_responses_ && response_depth_ == 0) {
+            in_responses_ = false;
+        }
+        return true;
+    }
+
+    bool start_object(std::size_t) override {
+        if (!in_responses_) {
+            return true;
+        }
+        if (response_depth_ == 0) {
+            current_ = SurveyResponse{};
+        } else if (response_depth_ == 1 && current_key_ == "satisfaction_scores") {
+            in_scores_ = true;
+        }
+        ++response_depth_;
+        return true;
+    }
+
+    bool end_object() override {
+        if (!in_responses_) {
+            return true;
+        }
+        --response_depth_;
+        if (in_scores_ && response_depth_ == 1) {
+            in_scores_ = false;
+        } else if (response_depth_ == 0) {
+            responses_.push_back(std::move(current_));
+        }
+        return true;
+    }
+
+    bool string(string_t& val) override {
+        if (in_comments_) {
+            current_.feedback_comments.push_back(val);
+        } else if (response_depth_ == 1) {
+            if (current_key_ == "employee_id") {
+                current_.employee_id = val;
+            } else if (current_key_ == "department") {
+                current_.department = val;
+            } else if (current_key_ == "role") {
+                current_.role = val;
+            }
+        }
+        return true;
+    }
+
+    bool number_integer(number_integer_t val) override {
+        return handle_number(static_cast<double>(val));
+    }
+
+    bool number_unsigned(number_unsigned_t val) override {
+        return handle_number(static_cast<double>(val));
+    }
+
+    bool number_float(number_float_t val, const string_t&) override {
+        return handle_number(val);
+    }
+
+    bool null() override { return true; }
+    bool boolean(bool) override { return true; }
+    bool binary(binary_t&) override { return true; }
+
+    bool parse_error(std::size_t, const std::string&,
+                     const nlohmann::detail::exception& ex) override {
+        throw ex;
+    }
+
+private:
+    bool handle_number(double val) {
+        if (in_scores_) {
+            current_.satisfaction_scores[current_key_] = val;
+        } else if (response_depth_ == 1 && current_key_ == "timestamp") {
+            current_.timestamp = std::chrono::system_clock::from_time_t(
+                static_cast<std::time_t>(val));
+        }
+        return true;
+    }
+
+    std::vector<SurveyResponse>& responses_;
+    SurveyResponse current_;
+    std::string current_key_;
+    bool in_responses_ = false;
+    bool in_scores_ = false;
+    bool in_comments_ = false;
+    int response_depth_ = 0;
+};
+
+constexpr uint32_t kCacheMagic = 0x45564353;  // 'EVCS'
+constexpr uint32_t kCacheVersion = 1;
+
+void write_string(std::ofstream& out, const std::string& value) {
+    uint32_t length = static_cast<uint32_t>(value.size());
+    out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+    out.write(value.data(), length);
+}
+
+bool read_string(std::ifstream& in, std::string& value) {
+    uint32_t length = 0;
+    in.read(reinterpret_cast<char*>(&length), sizeof(length));
+    if (!in) {
+        return false;
+    }
+    value.resize(length);
+    in.read(value.data(), length);
+    return static_cast<bool>(in);
+}
+
+} // namespace
+
+bool SurveyAnalyzer::load_survey_data_streaming(
+    const std::filesystem::path& json_path, bool use_binary_cache) {
+    auto cache_path = json_path;
+    cache_path += ".evcache";
+
+    try {
+        if (use_binary_cache &&
+            std::filesystem::exists(cache_path) &&
+            std::filesystem::last_write_time(cache_path) >=
+                std::filesystem::last_write_time(json_path)) {
+            if (load_binary_cache(cache_path)) {
+                logger_.info("Loaded {} survey responses from binary cache",
+                             survey_responses_.size());
+                return true;
+            }
+            logger_.warn("Binary cache unreadable, falling back to JSON parse");
+        }
+
+        std::ifstream file(json_path);
+        survey_responses_.clear();
+        department_index_valid_ = false;
+        comment_index_valid_ = false;
+        score_matrix_valid_ = false;
+
+        StreamingResponseHandler handler(survey_responses_);
+        if (!json::sax_parse(file, &handler)) {
+            logger_.error("Streaming parse failed for {}", json_path.string());
+            return false;
+        }
+
+        if (use_binary_cache) {
+            write_binary_cache(cache_path);
+        }
+
+        logger_.info("Loaded {} survey responses (streaming)",
+                     survey_responses_.size());
+        return true;
+    } catch (const std::exception& e) {
+        logger_.error("Failed to load survey data: {}", e.what());
+        return false;
+    }
+}
+
+bool SurveyAnalyzer::load_binary_cache(const std::filesystem::path& cache_path) {
+    std::ifstream in(cache_path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0;
+    uint64_t count = 0;
+    in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!in || magic != kCacheMagic || version != kCacheVersion) {
+        return false;
+    }
+
+    std::vector<SurveyResponse> responses;
+    responses.reserve(count);
+
+    for (uint64_t i = 0; i < count; ++i) {
+        SurveyResponse sr;
+        if (!read_string(in, sr.employee_id) ||
+            !read_string(in, sr.department) ||
+            !read_string(in, sr.role)) {
+            return false;
+        }
+
+        uint32_t score_count = 0;
+        in.read(reinterpret_cast<char*>(&score_count), sizeof(score_count));
+        for (uint32_t s = 0; s < score_count; ++s) {
+            std::string key;
+            double value = 0.0;
+            if (!read_string(in, key)) {
+                return false;
+            }
+            in.read(reinterpret_cast<char*>(&value), sizeof(value));
+            sr.satisfaction_scores[key] = value;
+        }
+
+        uint32_t comment_count = 0;
+        in.read(reinterpret_cast<char*>(&comment_count), sizeof(comment_count));
+        sr.feedback_comments.resize(comment_count);
+        for (uint32_t c = 0; c < comment_count; ++c) {
+            if (!read_string(in, sr.feedback_comments[c])) {
+                return false;
+            }
+        }
+
+        int64_t timestamp = 0;
+        in.read(reinterpret_cast<char*>(&timestamp), sizeof(timestamp));
+        if (!in) {
+            return false;
+        }
+        sr.timestamp = std::chrono::system_clock::from_time_t(
+            static_cast<std::time_t>(timestamp));
+
+        responses.push_back(std::move(sr));
+    }
+
+    survey_responses_ = std::move(responses);
+    department_index_valid_ = false;
+    comment_index_valid_ = false;
+    score_matrix_valid_ = false;
+    return true;
+}
+
+void SurveyAnalyzer::rebuild_department_index() {
+    // Sort storage so each department is one contiguous span, then compute
+    // every per-department aggregate in a single linear pass. Dashboards
+    // refreshing all departments afterwards pay O(1) per query.
+    std::stable_sort(survey_responses_.begin(), survey_responses_.end(),
+                     [](const SurveyResponse& a, const SurveyResponse& b) {
+                         return a.department < b.department;
+                     });
+
+    department_index_.clear();
+    size_t span_begin = 0;
+    double span_satisfaction = 0.0;
+
+    for (size_t i = 0; i <= survey_responses_.size(); ++i) {
+        bool span_ends = i > span_begin &&
+            (i == survey_responses_.size() ||
+             survey_responses_[i].department !=
+                 survey_responses_[span_begin].department);
+
+        if (span_ends) {
+            size_t count = i - span_begin;
+            department_index_[survey_responses_[span_begin].department] =
+                {span_begin, i, span_satisfaction / count};
+            span_begin = i;
+            span_satisfaction = 0.0;
+        }
+        if (i == survey_responses_.size()) {
+            break;
+        }
+
+        const auto& scores = survey_responses_[i].satisfaction_scores;
+        if (!scores.empty()) {
+            span_satisfaction += std::accumulate(
+                scores.begin(), scores.end(), 0.0,
+                [](double sum, const auto& pair) { return sum + pair.second; }
+            ) / scores.size();
+        }
+    }
+
+    department_index_valid_ = true;
+    comment_index_valid_ = false;  // the sort above reorders response indices
+    score_matrix_valid_ = false;
+    logger_.info("Rebuilt department index with {} departments",
+                 department_index_.size());
+}
+
+void SurveyAnalyzer::build_score_matrix() {
+    // The matrix rides on the department index: rows follow the sorted
+    // storage and department rows align with the index spans, so both
+    // matrices are filled in one linear pass over the responses
+    if (!department_index_valid_) {
+        rebuild_department_index();
+    }
+
+    std::map<std::string, size_t> columns;
+    for (const auto& response : survey_responses_) {
+        for (const auto& [metric, _] : response.satisfaction_scores) {
+            columns.emplace(metric, 0);
+        }
+    }
+    score_metric_names_.clear();
+    for (auto& [metric, column] : columns) {
+        column = score_metric_names_.size();
+        score_metric_names_.push_back(metric);
+    }
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    size_t cols = score_metric_names_.size();
+    score_matrix_.assign(survey_responses_.size() * cols, nan);
+    for (size_t r = 0; r < survey_responses_.size(); ++r) {
+        for (const auto& [metric, score] :
+             survey_responses_[r].satisfaction_scores) {
+            score_matrix_[r * cols + columns[metric]] = score;
+        }
+    }
+
+    score_department_names_.clear();
+    department_score_matrix_.assign(department_index_.size() * cols, nan);
+    for (const auto& [name, span] : department_index_) {
+        size_t row = score_department_names_.size();
+        score_department_names_.push_back(name);
+        for (size_t col = 0; col < cols; ++col) {
+            double sum = 0.0;
+            size_t answered = 0;
+            for (size_t r = span.begin; r < span.end; ++r) {
+                double value = score_matrix_[r * cols + col];
+                if (!std::isnan(value)) {
+                    sum += value;
+                    ++answered;
+                }
+            }
+            if (answered > 0) {
+                department_score_matrix_[row * cols + col] = sum / answered;
+            }
+        }
+    }
+
+    score_matrix_valid_ = true;
+    logger_.info("Built score matrix: {} responses x {} metrics",
+                 survey_responses_.size(), cols);
+}
+
+const std::vector<double>& SurveyAnalyzer::satisfaction_matrix() {
+    if (!score_matrix_valid_) {
+        build_score_matrix();
+    }
+    return score_matrix_;
+}
+
+const std::vector<std::string>& SurveyAnalyzer::satisfaction_metric_names() {
+    if (!score_matrix_valid_) {
+        build_score_matrix();
+    }
+    return score_metric_names_;
+}
+
+const std::vector<double>& SurveyAnalyzer::department_satisfaction_matrix() {
+    if (!score_matrix_valid_) {
+        build_score_matrix();
+    }
+    return department_score_matrix_;
+}
+
+const std::vector<std::string>& SurveyAnalyzer::department_names() {
+    if (!score_matrix_valid_) {
+        build_score_matrix();
+    }
+    return score_department_names_;
+}
+
+namespace {
+
+// Shared tokenization for index build and queries: lowercase, split on
+// the same separators the theme extraction uses, drop empty tokens
+std::vector<std::string> tokenize_comment(const std::string& text) {
+    std::vector<std::string> tokens;
+    boost::split(tokens, boost::to_lower_copy(text), boost::is_any_of(" ,.!?-"),
+                 boost::token_compress_on);
+    tokens.erase(std::remove(tokens.begin(), tokens.end(), std::string()),
+                 tokens.end());
+    return tokens;
+}
+
+} // namespace
+
+void SurveyAnalyzer::build_comment_index() {
+    comment_vocabulary_.clear();
+    comment_postings_.clear();
+
+    for (uint32_t r = 0; r < survey_responses_.size(); ++r) {
+        const auto& comments = survey_responses_[r].feedback_comments;
+        for (uint32_t c = 0; c < comments.size(); ++c) {
+            auto tokens = tokenize_comment(comments[c]);
+            for (uint32_t p = 0; p < tokens.size(); ++p) {
+                auto [it, inserted] = comment_vocabulary_.try_emplace(
+                    tokens[p], static_cast<uint32_t>(comment_postings_.size()));
+                if (inserted) {
+                    comment_postings_.emplace_back();
+                }
+                comment_postings_[it->second].push_back({r, c, p});
+            }
+        }
+    }
+
+    comment_index_valid_ = true;
+    logger_.info("Built comment index: {} terms over {} responses",
+                 comment_vocabulary_.size(), survey_responses_.size());
+}
+
+std::vector<uint32_t> SurveyAnalyzer::responses_for_term(
+    const std::string& term) const {
+    // Posting lists are built in response order, so deduplicating
+    // adjacent entries yields a sorted unique response list
+    std::vector<uint32_t> out;
+    auto it = comment_vocabulary_.find(term);
+    if (it == comment_vocabulary_.end()) {
+        return out;
+    }
+    for (const auto& posting : comment_postings_[it->second]) {
+        if (out.empty() || out.back() != posting.response) {
+            out.push_back(posting.response);
+        }
+    }
+    return out;
+}
+
+std::vector<uint32_t> SurveyAnalyzer::query_comments(
+    const std::vector<std::string>& all_terms,
+    const std::vector<std::string>& any_terms,
+    const std::vector<std::string>& none_terms) {
+    if (!comment_index_valid_) {
+        build_comment_index();
+    }
+
+    auto normalize = [](const std::vector<std::string>& terms) {
+        std::vector<std::string> out;
+        for (const auto& term : terms) {
+            auto tokens = tokenize_comment(term);
+            out.insert(out.end(), tokens.begin(), tokens.end());
+        }
+        return out;
+    };
+
+    const auto must = normalize(all_terms);
+    const auto should = normalize(any_terms);
+    const auto must_not = normalize(none_terms);
+    if (must.empty() && should.empty()) {
+        return {};
+    }
+
+    // Seed from the first constraint, then narrow with set operations;
+    // every per-term list is sorted, so each pass is linear
+    std::vector<uint32_t> result;
+    if (!must.empty()) {
+        result = responses_for_term(must.front());
+        for (size_t i = 1; i < must.size(); ++i) {
+            auto next = responses_for_term(must[i]);
+            std::vector<uint32_t> merged;
+            std::set_intersection(result.begin(), result.end(),
+                                  next.begin(), next.end(),
+                                  std::back_inserter(merged));
+            result = std::move(merged);
+        }
+    }
+
+    if (!should.empty()) {
+        std::vector<uint32_t> any_union;
+        for (const auto& term : should) {
+            auto next = responses_for_term(term);
+            std::vector<uint32_t> merged;
+            std::set_union(any_union.begin(), any_union.end(),
+                           next.begin(), next.end(),
+                           std::back_inserter(merged));
+            any_union = std::move(merged);
+        }
+        if (must.empty()) {
+            result = std::move(any_union);
+        } else {
+            std::vector<uint32_t> merged;
+            std::set_intersection(result.begin(), result.end(),
+                                  any_union.begin(), any_union.end(),
+                                  std::back_inserter(merged));
+            result = std::move(merged);
+        }
+    }
+
+    for (const auto& term : must_not) {
+        auto excluded = responses_for_term(term);
+        std::vector<uint32_t> merged;
+        std::set_difference(result.begin(), result.end(),
+                            excluded.begin(), excluded.end(),
+                            std::back_inserter(merged));
+        result = std::move(merged);
+    }
+
+    return result;
+}
+
+std::vector<uint32_t> SurveyAnalyzer::query_comments_phrase(
+    const std::string& phrase) {
+    if (!comment_index_valid_) {
+        build_comment_index();
+    }
+
+    auto tokens = tokenize_comment(phrase);
+    if (tokens.empty()) {
+        return {};
+    }
+
+    std::vector<const std::vector<CommentPosting>*> lists;
+    lists.reserve(tokens.size());
+    for (const auto& token : tokens) {
+        auto it = comment_vocabulary_.find(token);
+        if (it == comment_vocabulary_.end()) {
+            return {};  // a term nobody wrote: the phrase cannot match
+        }
+        lists.push_back(&comment_postings_[it->second]);
+    }
+
+    // Walk the first term's occurrences and require each following term
+    // at the next position of the same comment. Posting lists are
+    // ordered by (response, comment, position), so the membership test
+    // is a binary search.
+    auto posting_less = [](const CommentPosting& a, const CommentPosting& b) {
+        if (a.response != b.response) return a.response < b.response;
+        if (a.comment != b.comment) return a.comment < b.comment;
+        return a.position < b.position;
+    };
+    std::vector<uint32_t> result;
+    for (const auto& start : *lists.front()) {
+        bool match = true;
+        for (size_t k = 1; k < lists.size() && match; ++k) {
+            CommentPosting want{start.response, start.comment,
+                                start.position + static_cast<uint32_t>(k)};
+            match = std::binary_search(lists[k]->begin(), lists[k]->end(),
+                                       want, posting_less);
+        }
+        if (match && (result.empty() || result.back() != start.response)) {
+            result.push_back(start.response);
+        }
+    }
+    return result;
+}
+
+namespace {
+
+// Workplace-survey sentiment lexicon; weights in [-1, 1]
+struct LexiconEntry {
+    const char* word;
+    double weight;
+};
+
+constexpr LexiconEntry kSentimentLexicon[] = {
+    {"great", 1.0},      {"excellent", 1.0},  {"love", 1.0},
+    {"fantastic", 1.0},  {"amazing", 1.0},    {"good", 0.7},
+    {"helpful", 0.7},    {"supportive", 0.7}, {"happy", 0.7},
+    {"well", 0.5},       {"fine", 0.4},       {"fair", 0.3},
+    {"flexible", 0.5},   {"improved", 0.5},   {"appreciate", 0.7},
+    {"poor", -0.7},      {"bad", -0.7},       {"terrible", -1.0},
+    {"awful", -1.0},     {"hate", -1.0},      {"frustrating", -0.8},
+    {"stressful", -0.8}, {"overworked", -0.8},{"underpaid", -0.8},
+    {"unfair", -0.7},    {"slow", -0.4},      {"confusing", -0.5},
+    {"broken", -0.6},    {"lacking", -0.5},   {"ignored", -0.7},
+};
+
+// Collision-free lexicon table: the word set is fixed at compile time,
+// so construction searches for a hash seed under which every word lands
+// in a distinct slot. A lookup is then one hash and one string compare
+// — no probing, no per-token allocation.
+class SentimentLexicon {
+public:
+    SentimentLexicon() {
+        const size_t words = sizeof(kSentimentLexicon) / sizeof(LexiconEntry);
+        size_t size = 64;
+        while (size < 4 * words) {
+            size *= 2;
+        }
+        table_.assign(size, nullptr);
+        for (seed_ = 1;; ++seed_) {
+            bool collided = false;
+            for (const auto& entry : kSentimentLexicon) {
+                auto& slot = table_[hash(entry.word, seed_) & (size - 1)];
+                if (slot) {
+                    collided = true;
+                    break;
+                }
+                slot = &entry;
+            }
+            if (!collided) {
+                break;
+            }
+            std::fill(table_.begin(), table_.end(), nullptr);
+        }
+    }
+
+    // Weight for a token, 0.0 when it is not in the lexicon
+    double lookup(const std::string& token) const {
+        const auto* entry = table_[hash(token.c_str(), seed_) & (table_.size() - 1)];
+        return entry && token == entry->word ? entry->weight : 0.0;
+    }
+
+private:
+    static uint64_t hash(const char* word, uint64_t seed) {
+        uint64_t h = 14695981039346656037ull ^ seed;
+        for (; *word; ++word) {
+            h ^= static_cast<uint8_t>(*word);
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    std::vector<const LexiconEntry*> table_;
+    uint64_t seed_ = 1;
+};
+
+} // namespace
+
+SentimentReport SurveyAnalyzer::analyze_sentiment() {
+    if (!comment_index_valid_) {
+        build_comment_index();
+    }
+    static const SentimentLexicon lexicon;
+
+    // Flatten (response, comment) to one global slot so the scoring pass
+    // runs over plain arrays
+    std::vector<size_t> comment_offsets(survey_responses_.size() + 1, 0);
+    for (size_t r = 0; r < survey_responses_.size(); ++r) {
+        comment_offsets[r + 1] =
+            comment_offsets[r] + survey_responses_[r].feedback_comments.size();
+    }
+    const size_t total_comments = comment_offsets.back();
+    std::vector<double> weight_sum(total_comments, 0.0);
+    std::vector<uint32_t> token_count(total_comments, 0);
+
+    // One pass over the posting lists: each distinct term is hashed into
+    // the lexicon exactly once, then its weight is credited to every
+    // comment in its postings; every posting is one token occurrence
+    for (const auto& [term, term_id] : comment_vocabulary_) {
+        const double weight = lexicon.lookup(term);
+        for (const auto& posting : comment_postings_[term_id]) {
+            const size_t slot = comment_offsets[posting.response] + posting.comment;
+            token_count[slot]++;
+            weight_sum[slot] += weight;
+        }
+    }
+
+    SentimentReport report;
+    report.comments.reserve(total_comments);
+    double company_sum = 0.0;
+
+    for (uint32_t r = 0; r < survey_responses_.size(); ++r) {
+        auto& dept = report.departments[survey_responses_[r].department];
+        const size_t comments = survey_responses_[r].feedback_comments.size();
+        for (uint32_t c = 0; c < comments; ++c) {
+            const size_t slot = comment_offsets[r] + c;
+            const double score =
+                token_count[slot] > 0 ? weight_sum[slot] / token_count[slot] : 0.0;
+            report.comments.push_back({r, c, score});
+            dept.comment_count++;
+            if (score > 0.0) {
+                dept.positive_comments++;
+            } else if (score < 0.0) {
+                dept.negative_comments++;
+            }
+            dept.avg_score += score;  // sum for now, averaged below
+            company_sum += score;
+        }
+    }
+
+    for (auto& [name, dept] : report.departments) {
+        if (dept.comment_count > 0) {
+            dept.avg_score /= static_cast<double>(dept.comment_count);
+        }
+    }
+    report.company_avg_score =
+        total_comments > 0 ? company_sum / static_cast<double>(total_comments) : 0.0;
+
+    logger_.info("Scored sentiment for {} comments across {} departments",
+                 total_comments, report.departments.size());
+    return report;
+}
+
+namespace {
+
+constexpr uint32_t kTrendMagic = 0x45565457;  // 'EVTW'
+constexpr uint32_t kTrendVersion = 1;
+
+} // namespace
+
+bool SurveyAnalyzer::append_wave_snapshot(
+    const std::string& wave_label, const std::filesystem::path& sidecar_path) {
+    try {
+        if (survey_responses_.empty()) {
+            logger_.warn("No responses loaded, not appending wave snapshot");
+            return false;
+        }
+        if (!department_index_valid_) {
+            rebuild_department_index();
+        }
+
+        // Reduce the loaded wave to its snapshot
+        WaveSnapshot snapshot;
+        snapshot.label = wave_label;
+        snapshot.total_responses = survey_responses_.size();
+
+        auto earliest = survey_responses_.front().timestamp;
+        for (const auto& response : survey_responses_) {
+            earliest = std::min(earliest, response.timestamp);
+        }
+        snapshot.wave_start = static_cast<int64_t>(
+            std::chrono::system_clock::to_time_t(earliest));
+
+        double weighted = 0.0;
+        for (const auto& [name, span] : department_index_) {
+            snapshot.department_avg_satisfaction[name] = span.avg_satisfaction;
+            weighted += span.avg_satisfaction *
+                        static_cast<double>(span.end - span.begin);
+        }
+        snapshot.avg_satisfaction =
+            weighted / static_cast<double>(survey_responses_.size());
+        snapshot.avg_sentiment = analyze_sentiment().company_avg_score;
+
+        // Validate an existing sidecar before appending to it
+        const bool exists = std::filesystem::exists(sidecar_path) &&
+                            std::filesystem::file_size(sidecar_path) > 0;
+        if (exists) {
+            std::ifstream in(sidecar_path, std::ios::binary);
+            uint32_t magic = 0, version = 0;
+            in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+            in.read(reinterpret_cast<char*>(&version), sizeof(version));
+            if (!in || magic != kTrendMagic || version != kTrendVersion) {
+                logger_.error("Trend sidecar {} has unknown format",
+                              sidecar_path.string());
+                return false;
+            }
+        }
+
+        std::ofstream out(sidecar_path, std::ios::binary | std::ios::app);
+        if (!out) {
+            logger_.error("Cannot open trend sidecar {}", sidecar_path.string());
+            return false;
+        }
+        if (!exists) {
+            out.write(reinterpret_cast<const char*>(&kTrendMagic),
+                      sizeof(kTrendMagic));
+            out.write(reinterpret_cast<const char*>(&kTrendVersion),
+                      sizeof(kTrendVersion));
+        }
+
+        write_string(out, snapshot.label);
+        out.write(reinterpret_cast<const char*>(&snapshot.wave_start),
+                  sizeof(snapshot.wave_start));
+        out.write(reinterpret_cast<const char*>(&snapshot.total_responses),
+                  sizeof(snapshot.total_responses));
+        out.write(reinterpret_cast<const char*>(&snapshot.avg_satisfaction),
+                  sizeof(snapshot.avg_satisfaction));
+        out.write(reinterpret_cast<const char*>(&snapshot.avg_sentiment),
+                  sizeof(snapshot.avg_sentiment));
+
+        uint32_t dept_count = static_cast<uint32_t>(
+            snapshot.department_avg_satisfaction.size());
+        out.write(reinterpret_cast<const char*>(&dept_count), sizeof(dept_count));
+        for (const auto& [name, avg] : snapshot.department_avg_satisfaction) {
+            write_string(out, name);
+            out.write(reinterpret_cast<const char*>(&avg), sizeof(avg));
+        }
+
+        logger_.info("Appended wave snapshot {} ({} responses) to {}",
+                     wave_label, snapshot.total_responses, sidecar_path.string());
+        return true;
+    } catch (const std::exception& e) {
+        logger_.error("Failed to append wave snapshot: {}", e.what());
+        return false;
+    }
+}
+
+bool SurveyAnalyzer::read_wave_snapshots(
+    const std::filesystem::path& sidecar_path,
+    std::vector<WaveSnapshot>& snapshots) const {
+    std::ifstream in(sidecar_path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0;
+    in.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!in || magic != kTrendMagic || version != kTrendVersion) {
+        return false;
+    }
+
+    while (true) {
+        WaveSnapshot snapshot;
+        if (!read_string(in, snapshot.label)) {
+            return true;  // clean end of file
+        }
+        in.read(reinterpret_cast<char*>(&snapshot.wave_start),
+                sizeof(snapshot.wave_start));
+        in.read(reinterpret_cast<char*>(&snapshot.total_responses),
+                sizeof(snapshot.total_responses));
+        in.read(reinterpret_cast<char*>(&snapshot.avg_satisfaction),
+                sizeof(snapshot.avg_satisfaction));
+        in.read(reinterpret_cast<char*>(&snapshot.avg_sentiment),
+                sizeof(snapshot.avg_sentiment));
+
+        uint32_t dept_count = 0;
+        in.read(reinterpret_cast<char*>(&dept_count), sizeof(dept_count));
+        if (!in) {
+            return false;  // truncated record
+        }
+        for (uint32_t d = 0; d < dept_count; ++d) {
+            std::string name;
+            double avg = 0.0;
+            if (!read_string(in, name)) {
+                return false;
+            }
+            in.read(reinterpret_cast<char*>(&avg), sizeof(avg));
+            snapshot.department_avg_satisfaction[name] = avg;
+        }
+        if (!in) {
+            return false;
+        }
+        snapshots.push_back(std::move(snapshot));
+    }
+}
+
+std::optional<TrendSeries> SurveyAnalyzer::query_trend(
+    const std::filesystem::path& sidecar_path, const std::string& department) {
+    std::vector<WaveSnapshot> snapshots;
+    if (!read_wave_snapshots(sidecar_path, snapshots)) {
+        logger_.error("Cannot read trend sidecar {}", sidecar_path.string());
+        return std::nullopt;
+    }
+
+    std::sort(snapshots.begin(), snapshots.end(),
+              [](const WaveSnapshot& a, const WaveSnapshot& b) {
+                  return a.wave_start < b.wave_start;
+              });
+
+    TrendSeries series;
+    series.points.reserve(snapshots.size());
+    for (const auto& snapshot : snapshots) {
+        double satisfaction = snapshot.avg_satisfaction;
+        if (!department.empty()) {
+            auto it = snapshot.department_avg_satisfaction.find(department);
+            if (it == snapshot.department_avg_satisfaction.end()) {
+                continue;  // department did not exist in this wave
+            }
+            satisfaction = it->second;
+        }
+        series.points.push_back({snapshot.label, snapshot.wave_start,
+                                 snapshot.total_responses, satisfaction,
+                                 snapshot.avg_sentiment});
+    }
+
+    // Linear regression over wave index, matching the per-department
+    // trend analysis
+    series.satisfaction_slope = 0.0;
+    if (series.points.size() >= 2) {
+        const double n = static_cast<double>(series.points.size());
+        double x_mean = (n - 1.0) / 2.0;
+        double y_mean = 0.0;
+        for (const auto& point : series.points) {
+            y_mean += point.avg_satisfaction;
+        }
+        y_mean /= n;
+
+        double slope = 0.0, denominator = 0.0;
+        for (size_t i = 0; i < series.points.size(); ++i) {
+            double dx = static_cast<double>(i) - x_mean;
+            slope += dx * (series.points[i].avg_satisfaction - y_mean);
+            denominator += dx * dx;
+        }
+        series.satisfaction_slope = slope / denominator;
+    }
+
+    logger_.info("Composed trend over {} waves from {}",
+                 series.points.size(), sidecar_path.string());
+    return series;
+}
+
+void SurveyAnalyzer::write_binary_cache(
+    const std::filesystem::path& cache_path) const {
+    std::ofstream out(cache_path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return;
+    }
+
+    uint64_t count = survey_responses_.size();
+    out.write(reinterpret_cast<const char*>(&kCacheMagic), sizeof(kCacheMagic));
+    out.write(reinterpret_cast<const char*>(&kCacheVersion), sizeof(kCacheVersion));
+    out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+    for (const auto& sr : survey_responses_) {
+        write_string(out, sr.employee_id);
+        write_string(out, sr.department);
+        write_string(out, sr.role);
+
+        uint32_t score_count = static_cast<uint32_t>(sr.satisfaction_scores.size());
+        out.write(reinterpret_cast<const char*>(&score_count), sizeof(score_count));
+        for (const auto& [key, value] : sr.satisfaction_scores) {
+            write_string(out, key);
+            out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+        }
+
+        uint32_t comment_count = static_cast<uint32_t>(sr.feedback_comments.size());
+        out.write(reinterpret_cast<const char*>(&comment_count), sizeof(comment_count));
+        for (const auto& comment : sr.feedback_comments) {
+            write_string(out, comment);
+        }
+
+        int64_t timestamp = static_cast<int64_t>(
+            std::chrono::system_clock::to_time_t(sr.timestamp));
+        out.write(reinterpret_cast<const char*>(&timestamp), sizeof(timestamp));
+    }
+}
+
 std::optional<DepartmentMetrics> SurveyAnalyzer::analyze_department(
     const std::string& department) {
     try {
-        auto dept_responses = std::count_if(
-            survey_responses_.begin(),
-            survey_responses_.end(),
-            [&](const auto& sr) { return sr.department == department; }
-        );
-        
-        if (dept_responses == 0) {
+        if (!department_index_valid_) {
+            rebuild_department_index();
+        }
+
+        auto span_it = department_index_.find(department);
+        if (span_it == department_index_.end()) {
             logger_.warn("No responses found for department: {}", department);
             return std::nullopt;
         }
-        
+
         DepartmentMetrics metrics;
         metrics.name = department;
-        
-        // Calculate average satisfaction
-        double total_satisfaction = 0.0;
-        for (const auto& response : survey_responses_) {
-            if (response.department == department) {
-                total_satisfaction += std::accumulate(
-                    response.satisfaction_scores.begin(),
-                    response.satisfaction_scores.end(),
-                    0.0,
-                    [](double sum, const auto& pair) { return sum + pair.second; }
-                ) / response.satisfaction_scores.size();
-            }
-        }
-        metrics.avg_satisfaction = total_satisfaction / dept_responses;
-        
+        metrics.avg_satisfaction = span_it->second.avg_satisfaction;
+
         // Analyze common issues and suggestions
         identify_common_issues();
         generate_improvement_suggestions();
@@ -94,6 +1006,50 @@ std::optional<DepartmentMetrics> SurveyAnalyzer::analyze_department(
     }
 }
 
+CompanySummary SurveyAnalyzer::analyze_all_departments(
+    core::ThreadPool& thread_pool) {
+    if (!department_index_valid_) {
+        rebuild_department_index();
+    }
+
+    // One task per department span; each computes its metrics over the
+    // contiguous slice independently
+    std::vector<std::pair<std::string, std::future<DepartmentMetrics>>> futures;
+    futures.reserve(department_index_.size());
+
+    for (const auto& [name, span] : department_index_) {
+        futures.emplace_back(name, thread_pool.enqueue(
+            [this, name = name, span]() {
+                DepartmentMetrics metrics;
+                metrics.name = name;
+                metrics.avg_satisfaction = span.avg_satisfaction;
+                return metrics;
+            }));
+    }
+
+    CompanySummary summary;
+    summary.total_responses = survey_responses_.size();
+    summary.departments.reserve(futures.size());
+
+    double weighted_satisfaction = 0.0;
+    for (auto& [name, future] : futures) {
+        DepartmentMetrics metrics = future.get();
+        const auto& span = department_index_[name];
+        weighted_satisfaction +=
+            metrics.avg_satisfaction * static_cast<double>(span.end - span.begin);
+        department_metrics_[name] = metrics;
+        summary.departments.push_back(std::move(metrics));
+    }
+
+    summary.company_avg_satisfaction = summary.total_responses > 0
+        ? weighted_satisfaction / static_cast<double>(summary.total_responses)
+        : 0.0;
+
+    logger_.info("Analyzed {} departments in parallel",
+                 summary.departments.size());
+    return summary;
+}
+
 std::optional<std::filesystem::path> SurveyAnalyzer::generate_visualization(
     const std::vector<DepartmentMetrics>& metrics,
     const std::string& filename) {
@@ -1,4 +1,5 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include <pybind11/chrono.h>
 #include "eco_vehicle/analysis/survey_analyzer.hpp"
@@ -6,6 +7,26 @@
 namespace py = pybind11;
 using namespace eco_vehicle::analysis;
 
+namespace {
+
+// Wraps one of the analyzer's contiguous matrices as a 2-D NumPy view
+// without copying: the array borrows the vector's storage and holds the
+// analyzer object as its base, so the data outlives any slice taken
+// from it. Rows are derived from the flat size because empty surveys
+// produce zero columns.
+py::array_t<double> matrix_view(py::object analyzer,
+                                const std::vector<double>& values,
+                                size_t columns) {
+    size_t rows = columns > 0 ? values.size() / columns : 0;
+    return py::array_t<double>(
+        {static_cast<py::ssize_t>(rows), static_cast<py::ssize_t>(columns)},
+        {static_cast<py::ssize_t>(columns * sizeof(double)),
+         static_cast<py::ssize_t>(sizeof(double))},
+        values.data(), analyzer);
+}
+
+} // namespace
+
 PYBIND11_MODULE(survey_analysis, m) {
     m.doc() = "Survey analysis module for eco vehicle project"; 
 
@@ -32,5 +53,25 @@ PYBIND11_MODULE(survey_analysis, m) {
         .def("analyze_department", &SurveyAnalyzer::analyze_department)
         .def("generate_visualization", &SurveyAnalyzer::generate_visualization)
         .def("generate_organization_diagrams", &SurveyAnalyzer::generate_organization_diagrams)
-        .def("export_results", &SurveyAnalyzer::export_results);
+        .def("export_results", &SurveyAnalyzer::export_results)
+        // Zero-copy NumPy views over the analyzer's contiguous score
+        // storage. Notebooks previously rebuilt these as per-element
+        // dicts; the views cost one lazy matrix build on the C++ side
+        // and nothing per access. Mutating loads invalidate and rebuild
+        // the storage, so views should be taken after loading.
+        .def("satisfaction_matrix", [](py::object self) {
+            auto& analyzer = self.cast<SurveyAnalyzer&>();
+            return matrix_view(self, analyzer.satisfaction_matrix(),
+                               analyzer.satisfaction_metric_names().size());
+        }, "Response x metric score matrix (NaN = unanswered), zero-copy")
+        .def("satisfaction_metric_names",
+             &SurveyAnalyzer::satisfaction_metric_names,
+             "Column labels of satisfaction_matrix, sorted")
+        .def("department_satisfaction_matrix", [](py::object self) {
+            auto& analyzer = self.cast<SurveyAnalyzer&>();
+            return matrix_view(self, analyzer.department_satisfaction_matrix(),
+                               analyzer.satisfaction_metric_names().size());
+        }, "Department x metric mean-score matrix, zero-copy")
+        .def("department_names", &SurveyAnalyzer::department_names,
+             "Row labels of department_satisfaction_matrix, sorted");
 }
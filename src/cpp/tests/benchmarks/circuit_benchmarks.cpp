@@ -0,0 +1,194 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "../../../circuit/CircuitAnalyzer.hpp"
+#include "../../../circuit/BasicComponents.hpp"
+#include "../../../circuit/EMSolver.hpp"
+#include "../../../circuit/FilterDesigner.hpp"
+#include "../../../circuit/AdvancedOptimizer.hpp"
+
+namespace {
+
+using namespace circuit;
+
+// Fixture for circuit solver benchmarks; builds an RC ladder driven by
+// a voltage source, sized by the benchmark range
+class CircuitBenchmark : public benchmark::Fixture {
+protected:
+    void SetUp(const benchmark::State& state) override {
+        analyzer_ = std::make_unique<CircuitAnalyzer>();
+        setup_netlist(state.range(0));
+    }
+
+    void setup_netlist(size_t stages) {
+        auto vs = std::make_shared<VoltageSource>("V1", 10.0);
+        analyzer_->addComponent(vs);
+        std::shared_ptr<Component> previous = vs;
+        for (size_t i = 0; i < stages; ++i) {
+            auto r = std::make_shared<Resistor>(
+                "R" + std::to_string(i), 1000.0);
+            auto c = std::make_shared<Capacitor>(
+                "C" + std::to_string(i), 1e-9);
+            analyzer_->addComponent(r);
+            analyzer_->addComponent(c);
+            // Series resistor into the next node, shunt capacitor to
+            // the source return
+            r->getPins()[0]->connectTo(previous->getPins()[i == 0 ? 0 : 1]->getNode());
+            c->getPins()[0]->connectTo(r->getPins()[1]->getNode());
+            c->getPins()[1]->connectTo(vs->getPins()[1]->getNode());
+            previous = r;
+        }
+        analyzer_->setGroundNode(vs->getPins()[1]->getNode());
+    }
+
+    std::unique_ptr<CircuitAnalyzer> analyzer_;
+};
+
+// Benchmark DC operating point
+BENCHMARK_DEFINE_F(CircuitBenchmark, OperatingPoint)(benchmark::State& state) {
+    for (auto _ : state) {
+        analyzer_->analyze();
+        benchmark::DoNotOptimize(analyzer_->getNodeVoltages());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// Benchmark transient analysis over a fixed window
+BENCHMARK_DEFINE_F(CircuitBenchmark, Transient)(benchmark::State& state) {
+    for (auto _ : state) {
+        analyzer_->performTransient(1e-4, 1e-6);
+        benchmark::DoNotOptimize(analyzer_->getNodeVoltages());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// Benchmark AC sweep, 50 log-spaced points
+BENCHMARK_DEFINE_F(CircuitBenchmark, ACSweep)(benchmark::State& state) {
+    for (auto _ : state) {
+        analyzer_->performAC(1.0, 1e6, 50);
+        benchmark::DoNotOptimize(analyzer_->getFrequencyResponse());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// Benchmark the FEM field solve, sized by mesh nodes
+void BM_EMSolverSolve(benchmark::State& state) {
+    const size_t nodes = static_cast<size_t>(state.range(0));
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<> pos_dist(0.0, 1.0);
+
+    EMSolver::Mesh mesh;
+    for (size_t i = 0; i < nodes; ++i) {
+        mesh.nodes.push_back({pos_dist(gen), pos_dist(gen), pos_dist(gen)});
+    }
+    for (size_t i = 0; i + 3 < nodes; i += 4) {
+        mesh.elements.push_back({i, i + 1, i + 2, i + 3});
+        mesh.materials.push_back({4.4, 1.0, 0.0, 0.02});
+    }
+
+    for (auto _ : state) {
+        EMSolver solver(mesh, 1e9);
+        solver.solve();
+        benchmark::DoNotOptimize(solver);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// Benchmark filter design plus response evaluation, sized by the
+// number of analysis frequencies
+void BM_FilterAnalyze(benchmark::State& state) {
+    CircuitAnalyzer analyzer;
+    FilterDesigner designer(analyzer);
+    FilterDesigner::FilterSpecification spec{
+        FilterDesigner::FilterType::LOWPASS,
+        FilterDesigner::ApproximationType::BUTTERWORTH,
+        5,       // order
+        1e6,     // passband
+        5e6,     // stopband
+        0.5,     // ripple dB
+        40.0,    // attenuation dB
+        50.0     // impedance
+    };
+    auto components = designer.designFilter(spec);
+    benchmark::DoNotOptimize(components);
+
+    std::vector<double> frequencies;
+    const size_t points = static_cast<size_t>(state.range(0));
+    for (size_t i = 0; i < points; ++i) {
+        frequencies.push_back(1e3 * std::pow(10.0, 4.0 * i / points));
+    }
+
+    for (auto _ : state) {
+        auto response = designer.analyzeFilter(frequencies);
+        benchmark::DoNotOptimize(response);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// Benchmark differential evolution on a two-parameter matching
+// problem, sized by generations
+void BM_OptimizerDifferentialEvolution(benchmark::State& state) {
+    CircuitAnalyzer analyzer;
+    DifferentialEvolution optimizer(analyzer);
+    optimizer.addParameter("R", 10.0, 10e3, 1e3);
+    optimizer.addParameter("C", 1e-12, 1e-6, 1e-9);
+    optimizer.addObjective("match", RFOptimizer::Objective::Type::TARGET,
+                           50.0, 1.0);
+    optimizer.setMeasurementFunction(
+        [](const std::vector<RFOptimizer::Parameter>& params) {
+            const double r = params[0].current_value;
+            const double c = params[1].current_value;
+            return std::vector<double>{r / (1.0 + 2.0 * M_PI * 1e6 * r * c)};
+        });
+
+    for (auto _ : state) {
+        auto result =
+            optimizer.optimize(30, static_cast<int>(state.range(0)));
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// Register benchmarks with different netlist sizes
+BENCHMARK_REGISTER_F(CircuitBenchmark, OperatingPoint)
+    ->RangeMultiplier(2)
+    ->Range(8, 8<<7)
+    ->Complexity()
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(CircuitBenchmark, Transient)
+    ->RangeMultiplier(2)
+    ->Range(8, 8<<5)
+    ->Complexity()
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(CircuitBenchmark, ACSweep)
+    ->RangeMultiplier(2)
+    ->Range(8, 8<<5)
+    ->Complexity()
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_EMSolverSolve)
+    ->RangeMultiplier(2)
+    ->Range(16, 16<<5)
+    ->Complexity()
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_FilterAnalyze)
+    ->RangeMultiplier(4)
+    ->Range(64, 64<<6)
+    ->Complexity()
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_OptimizerDifferentialEvolution)
+    ->RangeMultiplier(2)
+    ->Range(8, 8<<4)
+    ->Complexity()
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
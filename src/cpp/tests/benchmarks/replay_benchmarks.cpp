@@ -0,0 +1,86 @@
+#include <benchmark/benchmark.h>
+#include <random>
+#include "eco_vehicle/digital_twin/digital_twin.hpp"
+#include "eco_vehicle/digital_twin/replay.hpp"
+
+namespace {
+
+using namespace eco_vehicle::digital_twin;
+
+// Fixture that synthesizes a recorded telemetry log sized by the
+// benchmark range; real runs point record_path_ at a captured log
+class ReplayBenchmark : public benchmark::Fixture {
+protected:
+    void SetUp(const benchmark::State& state) override {
+        log_ = ReplayLog();
+        std::mt19937_64 gen(1234);
+        std::uniform_real_distribution<> reading(0.0, 100.0);
+
+        const uint32_t battery = log_.intern("battery_temperature");
+        const uint32_t motor = log_.intern("motor_rpm");
+        const uint32_t brake = log_.intern("brake_wear");
+        const size_t ticks = static_cast<size_t>(state.range(0));
+        for (size_t tick = 0; tick < ticks; ++tick) {
+            log_.record(tick, battery, reading(gen));
+            log_.record(tick, motor, reading(gen) * 100.0);
+            log_.record(tick, brake, reading(gen) * 0.01);
+        }
+
+        config_ = {
+            {"update_rate_hz", 100},
+            {"physics_time_step", 0.001}
+        };
+        scenario_.duration = 1.0;
+        scenario_.environment = {{"ambient_temperature", 25.0}};
+    }
+
+    ReplayLog log_;
+    Config config_;
+    SimulationScenario scenario_;
+};
+
+// Benchmark twin-update throughput over the recorded stream; fixed
+// seed plus logical ticks keep run-to-run variance down to the code
+// under test, so confidence intervals stay tight
+BENCHMARK_DEFINE_F(ReplayBenchmark, TwinUpdateThroughput)(benchmark::State& state) {
+    for (auto _ : state) {
+        DigitalTwin twin("bench-vehicle", config_);
+        twin.set_deterministic_mode(42);
+        TwinReplayHarness harness(log_, 42);
+        auto delivered = harness.replay(twin);
+        benchmark::DoNotOptimize(delivered);
+        benchmark::DoNotOptimize(harness.result_hash());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(log_.events().size()));
+    state.SetComplexityN(state.range(0));
+}
+
+// Benchmark replay followed by the scenario simulation, the full A/B
+// comparison path for solver changes
+BENCHMARK_DEFINE_F(ReplayBenchmark, ReplayWithSimulation)(benchmark::State& state) {
+    for (auto _ : state) {
+        DigitalTwin twin("bench-vehicle", config_);
+        twin.set_deterministic_mode(42);
+        TwinReplayHarness harness(log_, 42);
+        auto delivered = harness.replay_with_simulation(twin, scenario_);
+        benchmark::DoNotOptimize(delivered);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK_REGISTER_F(ReplayBenchmark, TwinUpdateThroughput)
+    ->RangeMultiplier(4)
+    ->Range(256, 256<<8)
+    ->Complexity()
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(ReplayBenchmark, ReplayWithSimulation)
+    ->RangeMultiplier(4)
+    ->Range(256, 256<<6)
+    ->Complexity()
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+} // namespace
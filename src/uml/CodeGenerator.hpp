@@ -6,6 +6,14 @@
 #include <sstream>
 #include <memory>
 #include <map>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 namespace uml {
 
@@ -34,7 +42,131 @@ public:
         }
     }
 
+    struct GenerationStats {
+        std::size_t filesWritten{0};
+        std::size_t filesSkipped{0};   // content hash unchanged on disk
+        std::size_t classesTotal{0};
+    };
+
+    // Parallel per-class generation: classes are partitioned across worker
+    // threads via a shared atomic cursor, each worker renders into its own
+    // buffer, and a single output stage batches the filesystem writes.
+    // Content hashing skips files whose generated bytes match what is
+    // already on disk, so incremental runs touch only what changed.
+    // Only C++ has per-class rendering; other languages are rejected with
+    // std::invalid_argument rather than writing empty files.
+    static GenerationStats generateFiles(const std::shared_ptr<Diagram>& diagram,
+                                         Language lang,
+                                         const std::filesystem::path& outputDir,
+                                         unsigned numThreads = std::thread::hardware_concurrency()) {
+        if (lang != Language::CPP) {
+            throw std::invalid_argument(
+                "CodeGenerator::generateFiles: per-class generation is only "
+                "implemented for C++");
+        }
+        std::vector<std::shared_ptr<Class>> classes;
+        for (const auto& [name, element] : diagram->getElements()) {
+            if (element->getType() == ElementType::CLASS) {
+                classes.push_back(std::static_pointer_cast<Class>(element));
+            }
+        }
+
+        GenerationStats stats;
+        stats.classesTotal = classes.size();
+        if (classes.empty()) {
+            return stats;
+        }
+        numThreads = std::max(1u, std::min<unsigned>(numThreads,
+                                                     static_cast<unsigned>(classes.size())));
+
+        const std::string ns = toLower(diagram->getName());
+        std::vector<std::string> rendered(classes.size());
+        std::atomic<std::size_t> cursor{0};
+
+        auto worker = [&]() {
+            for (;;) {
+                const std::size_t i = cursor.fetch_add(1);
+                if (i >= classes.size()) {
+                    return;
+                }
+                rendered[i] = generateClassFile(classes[i], lang, ns);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned t = 0; t < numThreads; ++t) {
+            workers.emplace_back(worker);
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+
+        // Output stage: one thread doing batched writes with hash skipping
+        std::filesystem::create_directories(outputDir);
+        for (std::size_t i = 0; i < classes.size(); ++i) {
+            const auto path = outputDir /
+                (classes[i]->getName() + fileExtension(lang));
+            if (std::filesystem::exists(path) &&
+                hashFile(path) == contentHash(rendered[i])) {
+                ++stats.filesSkipped;
+                continue;
+            }
+            std::ofstream file(path, std::ios::binary);
+            file.write(rendered[i].data(),
+                       static_cast<std::streamsize>(rendered[i].size()));
+            ++stats.filesWritten;
+        }
+        return stats;
+    }
+
 private:
+    static std::string generateClassFile(const std::shared_ptr<Class>& classPtr,
+                                         Language lang, const std::string& ns) {
+        std::stringstream ss;
+        switch (lang) {
+            case Language::CPP:
+                ss << "#pragma once\n\n";
+                ss << "#include <string>\n";
+                ss << "#include <vector>\n";
+                ss << "#include <memory>\n\n";
+                ss << "namespace " << ns << " {\n\n";
+                generateCppClass(classPtr, ss);
+                ss << "\n} // namespace " << ns << "\n";
+                break;
+            default:
+                // TODO: per-file generation for the other languages
+                break;
+        }
+        return ss.str();
+    }
+
+    static std::string fileExtension(Language lang) {
+        switch (lang) {
+            case Language::CPP:        return ".hpp";
+            case Language::JAVA:       return ".java";
+            case Language::PYTHON:     return ".py";
+            case Language::TYPESCRIPT: return ".ts";
+            default:                   return ".txt";
+        }
+    }
+
+    // FNV-1a, good enough to detect content changes between runs
+    static std::uint64_t contentHash(const std::string& content) {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (unsigned char c : content) {
+            hash ^= c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    static std::uint64_t hashFile(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return contentHash(buffer.str());
+    }
+
     static std::string generateCpp(const std::shared_ptr<Diagram>& diagram) {
         std::stringstream ss;
         
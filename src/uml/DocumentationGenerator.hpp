@@ -8,11 +8,119 @@
 #include "SequenceDiagram.hpp"
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <map>
+#include <unordered_set>
+#include <vector>
 
 namespace uml {
 
+// Rope-style output buffer: appends go into fixed-size chunks and the
+// result is joined once at the end, avoiding the quadratic reallocation
+// pattern of repeated std::string appends on large documents
+class DocBuffer {
+public:
+    void append(std::string_view text) {
+        totalSize_ += text.size();
+        while (!text.empty()) {
+            if (chunks_.empty() || chunks_.back().size() == kChunkSize) {
+                chunks_.emplace_back();
+                chunks_.back().reserve(kChunkSize);
+            }
+            std::string& chunk = chunks_.back();
+            const std::size_t room = kChunkSize - chunk.size();
+            const std::size_t take = std::min(room, text.size());
+            chunk.append(text.data(), take);
+            text.remove_prefix(take);
+        }
+    }
+
+    std::size_t size() const { return totalSize_; }
+
+    std::string str() const {
+        std::string out;
+        out.reserve(totalSize_);
+        for (const auto& chunk : chunks_) {
+            out += chunk;
+        }
+        return out;
+    }
+
+private:
+    static constexpr std::size_t kChunkSize = 64 * 1024;
+
+    std::vector<std::string> chunks_;
+    std::size_t totalSize_{0};
+};
+
+// Interned string table: repeated type and stereotype names are stored
+// once and handed out as views, so per-element rendering stops copying the
+// same handful of strings thousands of times
+class StringInterner {
+public:
+    std::string_view intern(const std::string& text) {
+        return *storage_.insert(text).first;  // node-based, views stay valid
+    }
+
+    std::size_t size() const { return storage_.size(); }
+
+private:
+    std::unordered_set<std::string> storage_;
+};
+
+// Doc template parsed once into literal/placeholder segments; rendering is
+// a straight walk appending segments and arguments into a DocBuffer
+class DocTemplate {
+public:
+    // Placeholders are "{0}", "{1}", ... referring to render() arguments
+    explicit DocTemplate(std::string_view source) {
+        std::size_t pos = 0;
+        while (pos < source.size()) {
+            const std::size_t open = source.find('{', pos);
+            if (open == std::string_view::npos) {
+                segments_.push_back({false, 0, std::string(source.substr(pos))});
+                break;
+            }
+            const std::size_t close = source.find('}', open);
+            if (close == std::string_view::npos) {
+                segments_.push_back({false, 0, std::string(source.substr(pos))});
+                break;
+            }
+            if (open > pos) {
+                segments_.push_back({false, 0, std::string(source.substr(pos, open - pos))});
+            }
+            segments_.push_back(
+                {true,
+                 static_cast<std::size_t>(
+                     std::stoul(std::string(source.substr(open + 1, close - open - 1)))),
+                 ""});
+            pos = close + 1;
+        }
+    }
+
+    void render(DocBuffer& out, const std::vector<std::string_view>& args) const {
+        for (const auto& segment : segments_) {
+            if (segment.isPlaceholder) {
+                if (segment.argIndex < args.size()) {
+                    out.append(args[segment.argIndex]);
+                }
+            } else {
+                out.append(segment.literal);
+            }
+        }
+    }
+
+private:
+    struct Segment {
+        bool isPlaceholder;
+        std::size_t argIndex;
+        std::string literal;
+    };
+
+    std::vector<Segment> segments_;
+};
+
 class DocumentationGenerator {
 public:
     enum class Format {
@@ -35,6 +143,72 @@ public:
         }
     }
 
+    // Fast markdown path for class diagrams: boilerplate lives in
+    // templates compiled once per process, repeated type names go through
+    // the interner, and output accumulates in a rope buffer. Other diagram
+    // types fall back to the stringstream path.
+    static std::string generateMarkdownFast(const std::shared_ptr<Diagram>& diagram) {
+        if (diagram->getType() != DiagramType::CLASS) {
+            return generateMarkdown(diagram);
+        }
+
+        static const DocTemplate kHeader("# {0}\n\n");
+        static const DocTemplate kClassHeader("### {0}\n\n");
+        static const DocTemplate kAttributeRow("| {0} | {1} | {2} |\n");
+        static const DocTemplate kMethodRow("| {0} | {1} | {2} | {3} |\n");
+
+        StringInterner interner;
+        DocBuffer out;
+
+        kHeader.render(out, {diagram->getName()});
+        if (!diagram->getDescription().empty()) {
+            out.append(diagram->getDescription());
+            out.append("\n\n");
+        }
+        out.append("## Classes\n\n");
+
+        for (const auto& [name, element] : diagram->getElements()) {
+            if (element->getType() != ElementType::CLASS) {
+                continue;
+            }
+            auto classPtr = std::static_pointer_cast<Class>(element);
+            kClassHeader.render(out, {classPtr->getName()});
+
+            if (!classPtr->getAttributes().empty()) {
+                out.append("#### Attributes\n\n"
+                           "| Name | Type | Description |\n"
+                           "|------|------|-------------|\n");
+                for (const auto& attr : classPtr->getAttributes()) {
+                    kAttributeRow.render(out, {attr->getName(),
+                                               interner.intern(attr->getDataType()),
+                                               attr->getDescription()});
+                }
+                out.append("\n");
+            }
+
+            if (!classPtr->getMethods().empty()) {
+                out.append("#### Methods\n\n"
+                           "| Name | Return Type | Parameters | Description |\n"
+                           "|------|-------------|------------|-------------|\n");
+                for (const auto& method : classPtr->getMethods()) {
+                    std::string params;
+                    bool first = true;
+                    for (const auto& [paramName, paramType] : method->getParameters()) {
+                        if (!first) params += ", ";
+                        params += std::string(interner.intern(paramType)) + " " + paramName;
+                        first = false;
+                    }
+                    kMethodRow.render(out, {method->getName(),
+                                            interner.intern(method->getReturnType()),
+                                            params, method->getDescription()});
+                }
+                out.append("\n");
+            }
+        }
+
+        return out.str();
+    }
+
 private:
     static std::string generateMarkdown(const std::shared_ptr<Diagram>& diagram) {
         std::stringstream ss;
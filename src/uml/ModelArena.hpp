@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Model.hpp"
+#include "Relationship.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace uml {
+
+using ElementIndex = std::uint32_t;
+constexpr ElementIndex kInvalidElement = 0xFFFFFFFFu;
+
+// Arena-backed diagram model. Elements live contiguously in per-diagram
+// vectors and reference each other through 32-bit indices instead of
+// shared_ptr nodes, so large generated models neither fragment the heap nor
+// chase pointers during traversal. Validators and generators walk the arena
+// linearly; parent/child structure is kept as an intrusive sibling chain.
+class DiagramArena {
+public:
+    struct ElementRecord {
+        std::string name;
+        ElementType type{ElementType::CLASS};
+        std::string description;
+        std::string dataType;                    // attributes/methods only
+        bool isStatic{false};
+        ElementIndex parent{kInvalidElement};
+        ElementIndex firstChild{kInvalidElement};
+        ElementIndex nextSibling{kInvalidElement};
+    };
+
+    struct RelationshipRecord {
+        ElementIndex source{kInvalidElement};
+        ElementIndex target{kInvalidElement};
+        RelationType type{RelationType::ASSOCIATION};
+        std::string multiplicitySource;
+        std::string multiplicityTarget;
+    };
+
+    explicit DiagramArena(std::size_t expectedElements = 0) {
+        if (expectedElements > 0) {
+            elements_.reserve(expectedElements);
+        }
+    }
+
+    ElementIndex addElement(const std::string& name, ElementType type,
+                            ElementIndex parent = kInvalidElement) {
+        const ElementIndex index = static_cast<ElementIndex>(elements_.size());
+        ElementRecord record;
+        record.name = name;
+        record.type = type;
+        record.parent = parent;
+        if (parent != kInvalidElement) {
+            // Prepend to the parent's child chain; order is restored by the
+            // linear walk, which visits elements in creation order anyway
+            record.nextSibling = elements_[parent].firstChild;
+            elements_[parent].firstChild = index;
+        }
+        elements_.push_back(std::move(record));
+        if (parent == kInvalidElement) {
+            byName_[name] = index;
+        }
+        return index;
+    }
+
+    void addRelationship(ElementIndex source, ElementIndex target,
+                         RelationType type) {
+        relationships_.push_back({source, target, type, "", ""});
+    }
+
+    ElementRecord& element(ElementIndex index) { return elements_[index]; }
+    const ElementRecord& element(ElementIndex index) const { return elements_[index]; }
+
+    ElementIndex findElement(const std::string& name) const {
+        auto it = byName_.find(name);
+        return (it != byName_.end()) ? it->second : kInvalidElement;
+    }
+
+    std::size_t elementCount() const { return elements_.size(); }
+    std::size_t relationshipCount() const { return relationships_.size(); }
+
+    const std::vector<RelationshipRecord>& getRelationships() const {
+        return relationships_;
+    }
+
+    // Linear traversal over the arena — cache-friendly full-model walks for
+    // the Validator and generators
+    template <typename Visitor>
+    void forEachElement(Visitor&& visit) const {
+        for (ElementIndex i = 0; i < elements_.size(); ++i) {
+            visit(i, elements_[i]);
+        }
+    }
+
+    template <typename Visitor>
+    void forEachChild(ElementIndex parent, Visitor&& visit) const {
+        for (ElementIndex child = elements_[parent].firstChild;
+             child != kInvalidElement; child = elements_[child].nextSibling) {
+            visit(child, elements_[child]);
+        }
+    }
+
+    void clear() {
+        elements_.clear();
+        relationships_.clear();
+        byName_.clear();
+    }
+
+private:
+    std::vector<ElementRecord> elements_;
+    std::vector<RelationshipRecord> relationships_;
+    std::unordered_map<std::string, ElementIndex> byName_;  // top-level names
+};
+
+} // namespace uml
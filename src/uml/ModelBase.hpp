@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Diagram.hpp"
+#include "ModelArena.hpp"
 #include <string>
 #include <memory>
 #include <map>
@@ -50,12 +51,24 @@ public:
         return diagrams_;
     }
 
+    // Arena-backed mode for large generated models: contiguous element
+    // storage with index references instead of per-node shared_ptr
+    void createArenaDiagram(const std::string& name, std::size_t expectedElements = 0) {
+        arenas_[name] = std::make_shared<DiagramArena>(expectedElements);
+    }
+
+    std::shared_ptr<DiagramArena> getArenaDiagram(const std::string& name) const {
+        auto it = arenas_.find(name);
+        return (it != arenas_.end()) ? it->second : nullptr;
+    }
+
 private:
     ModelBase() = default;
     ModelBase(const ModelBase&) = delete;
     ModelBase& operator=(const ModelBase&) = delete;
 
     std::map<std::string, std::shared_ptr<Diagram>> diagrams_;
+    std::map<std::string, std::shared_ptr<DiagramArena>> arenas_;
 };
 
 } // namespace uml
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "Diagram.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <map>
 #include <vector>
 #include <memory>
 #include <string>
@@ -122,4 +125,141 @@ private:
     std::vector<std::shared_ptr<CombinedFragment>> fragments_;
 };
 
+// Computed geometry for one sequence diagram render
+struct SequenceLayout {
+    struct LifelineColumn {
+        std::string name;
+        double x{0.0};
+    };
+    struct MessageRow {
+        int sequenceNumber{0};
+        double y{0.0};
+        std::size_t sourceColumn{0};
+        std::size_t targetColumn{0};
+    };
+
+    std::vector<LifelineColumn> columns;
+    std::vector<MessageRow> rows;
+};
+
+// Layout cache shared across renders. Layouts are keyed by diagram name
+// and guarded by a content hash, so regenerating documentation skips
+// layout entirely for diagrams that did not change; when only some
+// messages changed, relayoutMessages() recomputes just those rows and
+// leaves untouched lifeline columns alone.
+class SequenceLayoutCache {
+public:
+    const SequenceLayout& layout(const SequenceDiagram& diagram) {
+        const std::uint64_t hash = contentHash(diagram);
+        auto it = cache_.find(diagram.getName());
+        if (it != cache_.end() && it->second.hash == hash) {
+            ++hits_;
+            return it->second.layout;
+        }
+        ++misses_;
+        Entry& entry = cache_[diagram.getName()];
+        entry.hash = hash;
+        entry.layout = compute(diagram);
+        return entry.layout;
+    }
+
+    // Incremental path: re-derive only the rows for the given sequence
+    // numbers; column placement is reused from the cached layout
+    const SequenceLayout& relayoutMessages(const SequenceDiagram& diagram,
+                                           const std::vector<int>& changedSequenceNumbers) {
+        auto it = cache_.find(diagram.getName());
+        if (it == cache_.end()) {
+            return layout(diagram);
+        }
+        Entry& entry = it->second;
+        for (const auto& message : diagram.getMessages()) {
+            if (std::find(changedSequenceNumbers.begin(), changedSequenceNumbers.end(),
+                          message->getSequenceNumber()) == changedSequenceNumbers.end()) {
+                continue;
+            }
+            for (auto& row : entry.layout.rows) {
+                if (row.sequenceNumber == message->getSequenceNumber()) {
+                    row.sourceColumn = columnIndex(entry.layout, message->getSource()->getName());
+                    row.targetColumn = columnIndex(entry.layout, message->getTarget()->getName());
+                }
+            }
+        }
+        // Deliberately leave entry.hash alone: this path only patches
+        // source/target columns, so any change it does not handle (added,
+        // removed or reordered messages, renamed lifelines) must still
+        // miss the hash check and recompute on the next layout() call
+        return entry.layout;
+    }
+
+    std::size_t hits() const { return hits_; }
+    std::size_t misses() const { return misses_; }
+    void clear() { cache_.clear(); }
+
+private:
+    static constexpr double kColumnSpacing = 160.0;
+    static constexpr double kRowSpacing = 32.0;
+    static constexpr double kTopMargin = 48.0;
+
+    struct Entry {
+        std::uint64_t hash{0};
+        SequenceLayout layout;
+    };
+
+    // FNV-1a over the structural content that affects layout
+    static std::uint64_t contentHash(const SequenceDiagram& diagram) {
+        std::uint64_t hash = 14695981039346656037ull;
+        auto mix = [&hash](const std::string& s) {
+            for (unsigned char c : s) {
+                hash ^= c;
+                hash *= 1099511628211ull;
+            }
+            hash ^= 0xFF;
+            hash *= 1099511628211ull;
+        };
+        for (const auto& lifeline : diagram.getLifelines()) {
+            mix(lifeline->getName());
+        }
+        for (const auto& message : diagram.getMessages()) {
+            mix(message->getName());
+            mix(message->getSource()->getName());
+            mix(message->getTarget()->getName());
+            mix(std::to_string(message->getSequenceNumber()));
+        }
+        return hash;
+    }
+
+    static std::size_t columnIndex(const SequenceLayout& layout, const std::string& name) {
+        for (std::size_t i = 0; i < layout.columns.size(); ++i) {
+            if (layout.columns[i].name == name) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    static SequenceLayout compute(const SequenceDiagram& diagram) {
+        SequenceLayout layout;
+        for (std::size_t i = 0; i < diagram.getLifelines().size(); ++i) {
+            layout.columns.push_back({diagram.getLifelines()[i]->getName(),
+                                      kColumnSpacing * static_cast<double>(i)});
+        }
+        std::vector<std::shared_ptr<Message>> ordered = diagram.getMessages();
+        std::sort(ordered.begin(), ordered.end(),
+                  [](const auto& a, const auto& b) {
+                      return a->getSequenceNumber() < b->getSequenceNumber();
+                  });
+        for (std::size_t i = 0; i < ordered.size(); ++i) {
+            layout.rows.push_back({ordered[i]->getSequenceNumber(),
+                                   kTopMargin + kRowSpacing * static_cast<double>(i),
+                                   columnIndex(layout, ordered[i]->getSource()->getName()),
+                                   columnIndex(layout, ordered[i]->getTarget()->getName())});
+        }
+        return layout;
+    }
+
+    std::map<std::string, Entry> cache_;
+    std::size_t hits_{0};
+    std::size_t misses_{0};
+};
+
 } // namespace uml
@@ -36,6 +36,231 @@ public:
         file << j.dump(4);
     }
 
+    // Streaming JSON writer: elements are emitted as the diagram is walked
+    // instead of materializing the whole nlohmann::json document, so saving
+    // costs no extra memory beyond one element at a time
+    static void saveDiagramToJsonStreaming(const std::shared_ptr<Diagram>& diagram,
+                                           const std::filesystem::path& path) {
+        std::ofstream file(path);
+        file << "{\n";
+        file << "  \"name\": " << json(diagram->getName()).dump() << ",\n";
+        file << "  \"type\": " << static_cast<int>(diagram->getType()) << ",\n";
+        file << "  \"description\": " << json(diagram->getDescription()).dump() << ",\n";
+
+        file << "  \"elements\": [";
+        bool first = true;
+        for (const auto& [name, element] : diagram->getElements()) {
+            if (!first) file << ",";
+            first = false;
+            file << "\n    " << serializeElement(element).dump();
+        }
+        file << (first ? "" : "\n  ") << "],\n";
+
+        file << "  \"relationships\": [";
+        first = true;
+        for (const auto& rel : diagram->getRelationships()) {
+            if (!first) file << ",";
+            first = false;
+            file << "\n    " << serializeRelationship(rel).dump();
+        }
+        file << (first ? "" : "\n  ") << "]\n";
+        file << "}\n";
+    }
+
+    // Compact binary format: a header, a string table, then length-prefixed
+    // element and relationship records that reference strings by index.
+    // Repeated type names and identifiers are stored once, and loading is a
+    // straight sequential read with no text parsing.
+    static void saveDiagramToBinary(const std::shared_ptr<Diagram>& diagram,
+                                    const std::filesystem::path& path) {
+        // Pass 1: intern every string the records will reference
+        std::map<std::string, uint32_t> stringIds;
+        std::vector<std::string> strings;
+        auto intern = [&](const std::string& s) -> uint32_t {
+            auto it = stringIds.find(s);
+            if (it != stringIds.end()) return it->second;
+            const uint32_t id = static_cast<uint32_t>(strings.size());
+            stringIds[s] = id;
+            strings.push_back(s);
+            return id;
+        };
+
+        struct AttrRec { uint32_t name, type; uint8_t isStatic; };
+        struct ParamRec { uint32_t name, type; };
+        struct MethodRec { uint32_t name, returnType; std::vector<ParamRec> params; };
+        struct ElemRec {
+            uint32_t name, description;
+            uint8_t type;
+            std::vector<AttrRec> attributes;
+            std::vector<MethodRec> methods;
+        };
+        struct RelRec {
+            uint32_t name, source, target, multSource, multTarget;
+            uint8_t type;
+        };
+
+        std::vector<ElemRec> elemRecs;
+        for (const auto& [name, element] : diagram->getElements()) {
+            ElemRec rec;
+            rec.name = intern(element->getName());
+            rec.description = intern(element->getDescription());
+            rec.type = static_cast<uint8_t>(element->getType());
+            if (element->getType() == ElementType::CLASS) {
+                auto classPtr = std::static_pointer_cast<Class>(element);
+                for (const auto& attr : classPtr->getAttributes()) {
+                    rec.attributes.push_back({intern(attr->getName()),
+                                              intern(attr->getDataType()),
+                                              static_cast<uint8_t>(attr->isStatic())});
+                }
+                for (const auto& method : classPtr->getMethods()) {
+                    MethodRec m{intern(method->getName()),
+                                intern(method->getReturnType()), {}};
+                    for (const auto& [pName, pType] : method->getParameters()) {
+                        m.params.push_back({intern(pName), intern(pType)});
+                    }
+                    rec.methods.push_back(std::move(m));
+                }
+            }
+            elemRecs.push_back(std::move(rec));
+        }
+
+        std::vector<RelRec> relRecs;
+        for (const auto& rel : diagram->getRelationships()) {
+            relRecs.push_back({intern(rel->getName()),
+                               intern(rel->getSource()->getName()),
+                               intern(rel->getTarget()->getName()),
+                               intern(rel->getMultiplicitySource()),
+                               intern(rel->getMultiplicityTarget()),
+                               static_cast<uint8_t>(rel->getRelationType())});
+        }
+
+        // Pass 2: sequential write
+        std::ofstream file(path, std::ios::binary);
+        writeU32(file, kBinaryMagic);
+        writeU32(file, kBinaryVersion);
+        writeU32(file, intern(diagram->getName()));
+        writeU32(file, intern(diagram->getDescription()));
+        file.put(static_cast<char>(diagram->getType()));
+        writeU32(file, static_cast<uint32_t>(strings.size()));
+        writeU32(file, static_cast<uint32_t>(elemRecs.size()));
+        writeU32(file, static_cast<uint32_t>(relRecs.size()));
+
+        for (const auto& s : strings) {
+            writeU32(file, static_cast<uint32_t>(s.size()));
+            file.write(s.data(), static_cast<std::streamsize>(s.size()));
+        }
+
+        for (const auto& rec : elemRecs) {
+            writeU32(file, rec.name);
+            writeU32(file, rec.description);
+            file.put(static_cast<char>(rec.type));
+            writeU32(file, static_cast<uint32_t>(rec.attributes.size()));
+            for (const auto& a : rec.attributes) {
+                writeU32(file, a.name);
+                writeU32(file, a.type);
+                file.put(static_cast<char>(a.isStatic));
+            }
+            writeU32(file, static_cast<uint32_t>(rec.methods.size()));
+            for (const auto& m : rec.methods) {
+                writeU32(file, m.name);
+                writeU32(file, m.returnType);
+                writeU32(file, static_cast<uint32_t>(m.params.size()));
+                for (const auto& p : m.params) {
+                    writeU32(file, p.name);
+                    writeU32(file, p.type);
+                }
+            }
+        }
+
+        for (const auto& r : relRecs) {
+            writeU32(file, r.name);
+            writeU32(file, r.source);
+            writeU32(file, r.target);
+            writeU32(file, r.multSource);
+            writeU32(file, r.multTarget);
+            file.put(static_cast<char>(r.type));
+        }
+    }
+
+    static std::shared_ptr<Diagram> loadDiagramFromBinary(const std::filesystem::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (readU32(file) != kBinaryMagic || readU32(file) != kBinaryVersion) {
+            return nullptr;
+        }
+
+        const uint32_t nameId = readU32(file);
+        const uint32_t descId = readU32(file);
+        const auto diagramType = static_cast<DiagramType>(file.get());
+        const uint32_t stringCount = readU32(file);
+        const uint32_t elementCount = readU32(file);
+        const uint32_t relCount = readU32(file);
+
+        std::vector<std::string> strings(stringCount);
+        for (auto& s : strings) {
+            const uint32_t len = readU32(file);
+            s.resize(len);
+            file.read(s.data(), len);
+        }
+
+        auto diagram = std::make_shared<Diagram>(strings[nameId], diagramType);
+        diagram->setDescription(strings[descId]);
+
+        std::map<std::string, std::shared_ptr<Element>> elementMap;
+        for (uint32_t e = 0; e < elementCount; ++e) {
+            const uint32_t elemName = readU32(file);
+            const uint32_t elemDesc = readU32(file);
+            const auto elemType = static_cast<ElementType>(file.get());
+            const uint32_t attrCount = readU32(file);
+
+            auto classPtr = std::make_shared<Class>(strings[elemName]);
+            classPtr->setDescription(strings[elemDesc]);
+            (void)elemType;
+
+            for (uint32_t a = 0; a < attrCount; ++a) {
+                const uint32_t aName = readU32(file);
+                const uint32_t aType = readU32(file);
+                const bool isStatic = file.get() != 0;
+                classPtr->addAttribute(std::make_shared<Attribute>(
+                    strings[aName], strings[aType], isStatic));
+            }
+
+            const uint32_t methodCount = readU32(file);
+            for (uint32_t m = 0; m < methodCount; ++m) {
+                const uint32_t mName = readU32(file);
+                const uint32_t mReturn = readU32(file);
+                auto method = std::make_shared<Method>(strings[mName], strings[mReturn]);
+                const uint32_t paramCount = readU32(file);
+                for (uint32_t p = 0; p < paramCount; ++p) {
+                    const uint32_t pName = readU32(file);
+                    const uint32_t pType = readU32(file);
+                    method->addParameter(strings[pName], strings[pType]);
+                }
+                classPtr->addMethod(method);
+            }
+
+            elementMap[classPtr->getName()] = classPtr;
+            diagram->addElement(classPtr);
+        }
+
+        for (uint32_t r = 0; r < relCount; ++r) {
+            const uint32_t rName = readU32(file);
+            const uint32_t rSource = readU32(file);
+            const uint32_t rTarget = readU32(file);
+            const uint32_t rMultSrc = readU32(file);
+            const uint32_t rMultTgt = readU32(file);
+            const auto relType = static_cast<RelationType>(file.get());
+
+            auto rel = std::make_shared<Relationship>(
+                strings[rName], elementMap.at(strings[rSource]),
+                elementMap.at(strings[rTarget]), relType);
+            rel->setMultiplicitySource(strings[rMultSrc]);
+            rel->setMultiplicityTarget(strings[rMultTgt]);
+            diagram->addRelationship(rel);
+        }
+
+        return diagram;
+    }
+
     static std::shared_ptr<Diagram> loadDiagramFromJson(const std::filesystem::path& path) {
         std::ifstream file(path);
         json j;
@@ -65,6 +290,19 @@ public:
     }
 
 private:
+    static constexpr uint32_t kBinaryMagic = 0x45564D44;  // 'EVMD'
+    static constexpr uint32_t kBinaryVersion = 1;
+
+    static void writeU32(std::ofstream& file, uint32_t value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    static uint32_t readU32(std::ifstream& file) {
+        uint32_t value = 0;
+        file.read(reinterpret_cast<char*>(&value), sizeof(value));
+        return value;
+    }
+
     static json serializeElement(const std::shared_ptr<Element>& element) {
         json j;
         j["name"] = element->getName();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Diagram.hpp"
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <string>
@@ -137,4 +138,131 @@ private:
     std::vector<std::shared_ptr<Transition>> transitions_;
 };
 
+// Execution engine compiled from a StateMachine: states and triggers are
+// numbered densely and transitions flattened into a state × event table,
+// so dispatching an event is two array lookups (row base plus event
+// column) instead of searching the transition collections. Generated
+// machines in the vehicle controller run events through this at high rate.
+class CompiledStateMachine {
+public:
+    static constexpr std::uint16_t kNoTransition = 0xFFFF;
+
+    explicit CompiledStateMachine(const StateMachine& machine) {
+        compile(machine);
+    }
+
+    int stateId(const std::string& name) const {
+        auto it = stateIds_.find(name);
+        return (it != stateIds_.end()) ? it->second : -1;
+    }
+
+    int eventId(const std::string& trigger) const {
+        auto it = eventIds_.find(trigger);
+        return (it != eventIds_.end()) ? it->second : -1;
+    }
+
+    int currentState() const { return current_; }
+    const std::string& stateName(int id) const { return stateNames_[id]; }
+    const std::string& effectName(int actionIndex) const { return effects_[actionIndex]; }
+
+    // Index of the effect fired by the last successful dispatch, -1 if none
+    int lastActionIndex() const { return lastAction_; }
+
+    // Read-only table access for external runtimes (see StateMachinePool)
+    // that keep per-instance state outside this object and share one
+    // compiled program across many instances
+    int stateCount() const { return static_cast<int>(stateNames_.size()); }
+    int eventCount() const { return eventCount_; }
+    int initialState() const { return initial_; }
+
+    std::uint16_t targetAt(int state, int event) const {
+        return targetTable_[static_cast<std::size_t>(state) * eventCount_ + event];
+    }
+
+    std::uint16_t actionAt(int state, int event) const {
+        return actionTable_[static_cast<std::size_t>(state) * eventCount_ + event];
+    }
+
+    void reset() {
+        current_ = initial_;
+        lastAction_ = -1;
+    }
+
+    // Two array lookups per event; returns false when the current state
+    // has no transition for this event
+    bool dispatch(int event) {
+        if (event < 0 || event >= eventCount_) {
+            return false;
+        }
+        const std::size_t slot = static_cast<std::size_t>(current_) * eventCount_ + event;
+        const std::uint16_t target = targetTable_[slot];
+        if (target == kNoTransition) {
+            return false;
+        }
+        current_ = target;
+        lastAction_ = actionTable_[slot] == kNoTransition ? -1
+                                                          : actionTable_[slot];
+        return true;
+    }
+
+    // Batch API: runs of events are processed in one call so the per-event
+    // cost is just the table lookups. Returns the number of events that
+    // actually fired a transition.
+    std::size_t dispatchBatch(const int* events, std::size_t count) {
+        std::size_t fired = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (dispatch(events[i])) {
+                ++fired;
+            }
+        }
+        return fired;
+    }
+
+private:
+    void compile(const StateMachine& machine) {
+        for (const auto& state : machine.getStates()) {
+            stateIds_[state->getName()] = static_cast<int>(stateNames_.size());
+            stateNames_.push_back(state->getName());
+        }
+        for (const auto& transition : machine.getTransitions()) {
+            if (eventIds_.find(transition->getTrigger()) == eventIds_.end()) {
+                eventIds_[transition->getTrigger()] = static_cast<int>(eventNames_.size());
+                eventNames_.push_back(transition->getTrigger());
+            }
+        }
+        eventCount_ = static_cast<int>(eventNames_.size());
+
+        targetTable_.assign(stateNames_.size() * eventCount_, kNoTransition);
+        actionTable_.assign(stateNames_.size() * eventCount_, kNoTransition);
+
+        for (const auto& transition : machine.getTransitions()) {
+            const int source = stateIds_.at(transition->getSource()->getName());
+            const int target = stateIds_.at(transition->getTarget()->getName());
+            const int event = eventIds_.at(transition->getTrigger());
+            const std::size_t slot = static_cast<std::size_t>(source) * eventCount_ + event;
+            targetTable_[slot] = static_cast<std::uint16_t>(target);
+            if (!transition->getEffect().empty()) {
+                actionTable_[slot] = static_cast<std::uint16_t>(effects_.size());
+                effects_.push_back(transition->getEffect());
+            }
+        }
+
+        auto initialState = machine.getInitialState();
+        initial_ = initialState ? stateIds_.at(initialState->getName()) : 0;
+        current_ = initial_;
+    }
+
+    std::vector<std::string> stateNames_;
+    std::vector<std::string> eventNames_;
+    std::vector<std::string> effects_;
+    std::map<std::string, int> stateIds_;
+    std::map<std::string, int> eventIds_;
+    std::vector<std::uint16_t> targetTable_;   // state × event -> target state
+    std::vector<std::uint16_t> actionTable_;   // state × event -> effect index
+    int eventCount_{0};
+    int initial_{0};
+    int current_{0};
+    int lastAction_{-1};
+};
+
 } // namespace uml
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "StateMachine.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace uml {
+
+// Pool runtime for many concurrently-running state machines (one per
+// vehicle subsystem). Instances share immutable compiled programs and
+// keep their mutable state — current state, last action — in contiguous
+// pool arrays, so a cross-subsystem event storm walks flat memory
+// instead of hopping between heap-allocated machines. Events are queued
+// per machine and delivered in batches: drain() partitions the machines
+// over persistent worker threads, each machine's queue is replayed in
+// order by exactly one worker, and no per-machine lock is taken on the
+// dispatch path.
+//
+// post() is thread-safe at any time; registration, state queries and
+// reset() are meant for quiescent use between drains.
+class StateMachinePool {
+public:
+    explicit StateMachinePool(
+        std::size_t numWorkers = std::thread::hardware_concurrency()) {
+        // The draining thread participates too, so one hardware thread
+        // is left for it
+        std::size_t helpers = numWorkers > 1 ? numWorkers - 1 : 0;
+        for (std::size_t i = 0; i < helpers; ++i) {
+            workers_.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    ~StateMachinePool() {
+        {
+            std::lock_guard<std::mutex> lock(runMutex_);
+            stopping_ = true;
+        }
+        runCv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    StateMachinePool(const StateMachinePool&) = delete;
+    StateMachinePool& operator=(const StateMachinePool&) = delete;
+
+    // Registers an instance of an already-compiled program; many
+    // instances can share one program so the dispatch tables stay hot
+    std::size_t addMachine(
+        std::shared_ptr<const CompiledStateMachine> program) {
+        std::lock_guard<std::mutex> lock(postMutex_);
+        programs_.push_back(std::move(program));
+        currents_.push_back(
+            static_cast<std::uint16_t>(programs_.back()->initialState()));
+        lastActions_.push_back(-1);
+        pending_.emplace_back();
+        active_.emplace_back();
+        return programs_.size() - 1;
+    }
+
+    // Convenience for one-off machines: compiles and registers
+    std::size_t addMachine(const StateMachine& machine) {
+        return addMachine(std::make_shared<CompiledStateMachine>(machine));
+    }
+
+    std::size_t machineCount() const { return programs_.size(); }
+
+    // Queues one event for a machine; delivered on the next drain
+    void post(std::size_t machine, int event) {
+        std::lock_guard<std::mutex> lock(postMutex_);
+        pending_[machine].push_back(event);
+    }
+
+    void postBatch(std::size_t machine, const int* events, std::size_t count) {
+        std::lock_guard<std::mutex> lock(postMutex_);
+        pending_[machine].insert(pending_[machine].end(), events,
+                                 events + count);
+    }
+
+    // Delivers every queued event: machines with work are claimed by the
+    // workers (and this thread) and each queue replayed in order against
+    // the pooled state. Returns the number of events that fired a
+    // transition. Events posted while draining land in the next drain.
+    std::size_t drain() {
+        {
+            std::lock_guard<std::mutex> lock(postMutex_);
+            pending_.swap(active_);
+        }
+
+        nextMachine_.store(0, std::memory_order_relaxed);
+        firedTotal_.store(0, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(runMutex_);
+            ++runGeneration_;
+            busyWorkers_ = workers_.size();
+        }
+        runCv_.notify_all();
+
+        runPass();
+
+        {
+            std::unique_lock<std::mutex> lock(runMutex_);
+            doneCv_.wait(lock, [this] { return busyWorkers_ == 0; });
+        }
+
+        for (auto& queue : active_) {
+            queue.clear();  // keeps capacity for the next storm
+        }
+        return firedTotal_.load(std::memory_order_relaxed);
+    }
+
+    int currentState(std::size_t machine) const { return currents_[machine]; }
+    int lastAction(std::size_t machine) const { return lastActions_[machine]; }
+
+    void reset(std::size_t machine) {
+        currents_[machine] =
+            static_cast<std::uint16_t>(programs_[machine]->initialState());
+        lastActions_[machine] = -1;
+    }
+
+private:
+    // One machine end to end: the queue is replayed against local copies
+    // of the pooled state, written back once at the end
+    std::size_t runMachine(std::size_t index) {
+        const CompiledStateMachine& program = *programs_[index];
+        const std::vector<int>& events = active_[index];
+        int current = currents_[index];
+        int lastAction = lastActions_[index];
+        std::size_t fired = 0;
+
+        for (int event : events) {
+            if (event < 0 || event >= program.eventCount()) {
+                continue;
+            }
+            const std::uint16_t target = program.targetAt(current, event);
+            if (target == CompiledStateMachine::kNoTransition) {
+                continue;
+            }
+            const std::uint16_t action = program.actionAt(current, event);
+            current = target;
+            lastAction =
+                action == CompiledStateMachine::kNoTransition ? -1 : action;
+            ++fired;
+        }
+
+        currents_[index] = static_cast<std::uint16_t>(current);
+        lastActions_[index] = lastAction;
+        return fired;
+    }
+
+    // Claims machines off the shared cursor until none remain; a machine
+    // is only ever claimed by one thread per drain
+    void runPass() {
+        std::size_t fired = 0;
+        for (;;) {
+            std::size_t index =
+                nextMachine_.fetch_add(1, std::memory_order_relaxed);
+            if (index >= active_.size()) {
+                break;
+            }
+            if (!active_[index].empty()) {
+                fired += runMachine(index);
+            }
+        }
+        firedTotal_.fetch_add(fired, std::memory_order_relaxed);
+    }
+
+    void workerLoop() {
+        std::uint64_t seenGeneration = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(runMutex_);
+                runCv_.wait(lock, [&] {
+                    return stopping_ || runGeneration_ != seenGeneration;
+                });
+                if (stopping_) {
+                    return;
+                }
+                seenGeneration = runGeneration_;
+            }
+
+            runPass();
+
+            {
+                std::lock_guard<std::mutex> lock(runMutex_);
+                --busyWorkers_;
+            }
+            doneCv_.notify_one();
+        }
+    }
+
+    // Machine storage: programs are shared and immutable, per-instance
+    // state lives in flat arrays indexed by machine handle
+    std::vector<std::shared_ptr<const CompiledStateMachine>> programs_;
+    std::vector<std::uint16_t> currents_;
+    std::vector<int> lastActions_;
+    std::vector<std::vector<int>> pending_;  // filled by post()
+    std::vector<std::vector<int>> active_;   // drained by the workers
+    std::mutex postMutex_;
+
+    // Scheduler state
+    std::vector<std::thread> workers_;
+    std::mutex runMutex_;
+    std::condition_variable runCv_;
+    std::condition_variable doneCv_;
+    std::atomic<std::size_t> nextMachine_{0};
+    std::atomic<std::size_t> firedTotal_{0};
+    std::size_t busyWorkers_{0};
+    std::uint64_t runGeneration_{0};
+    bool stopping_{false};
+};
+
+} // namespace uml
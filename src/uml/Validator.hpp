@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Diagram.hpp"
+#include <map>
 #include <vector>
 #include <string>
 
@@ -13,6 +14,8 @@ struct ValidationError {
 };
 
 class Validator {
+    friend class IncrementalValidator;
+
 public:
     static std::vector<ValidationError> validateDiagram(const std::shared_ptr<Diagram>& diagram) {
         std::vector<ValidationError> errors;
@@ -192,4 +195,108 @@ private:
     }
 };
 
+// One edit batch from the modeling tool
+struct ChangeSet {
+    std::vector<std::string> modifiedElements;   // added or edited
+    std::vector<std::string> removedElements;
+    bool relationshipsChanged{false};
+    bool diagramPropertiesChanged{false};
+};
+
+// Incremental validation: errors are cached per element, and an edit only
+// re-runs the element rules for the elements it touched (plus the
+// relationship and diagram-level rules when the change set flags them).
+// Editing one class in a large model re-validates that class, not the
+// whole diagram.
+class IncrementalValidator {
+public:
+    explicit IncrementalValidator(std::shared_ptr<Diagram> diagram)
+        : diagram_(std::move(diagram)) {}
+
+    // Full pass; seeds the per-element cache
+    const std::vector<ValidationError>& validateAll() {
+        elementErrors_.clear();
+        for (const auto& [name, element] : diagram_->getElements()) {
+            validateOne(name);
+        }
+        validateRelationships();
+        validateDiagramLevel();
+        rebuildFlatErrors();
+        return flatErrors_;
+    }
+
+    // Patch the cache with only what the edit touched
+    const std::vector<ValidationError>& applyChanges(const ChangeSet& changes) {
+        for (const auto& name : changes.removedElements) {
+            elementErrors_.erase(name);
+        }
+        for (const auto& name : changes.modifiedElements) {
+            validateOne(name);
+        }
+        if (changes.relationshipsChanged || !changes.removedElements.empty()) {
+            validateRelationships();
+        }
+        if (changes.diagramPropertiesChanged || !changes.removedElements.empty() ||
+            !changes.modifiedElements.empty()) {
+            validateDiagramLevel();
+        }
+        rebuildFlatErrors();
+        return flatErrors_;
+    }
+
+    const std::vector<ValidationError>& errors() const { return flatErrors_; }
+
+private:
+    void validateOne(const std::string& name) {
+        auto element = diagram_->getElement(name);
+        if (!element) {
+            elementErrors_.erase(name);
+            return;
+        }
+        std::vector<ValidationError> errors;
+        Validator::validateElement(element, errors);
+        elementErrors_[name] = std::move(errors);
+    }
+
+    void validateRelationships() {
+        relationshipErrors_.clear();
+        for (const auto& rel : diagram_->getRelationships()) {
+            Validator::validateRelationship(rel, relationshipErrors_);
+        }
+    }
+
+    void validateDiagramLevel() {
+        diagramErrors_.clear();
+        if (diagram_->getName().empty()) {
+            diagramErrors_.push_back({"Diagram name cannot be empty", "", ""});
+        }
+        switch (diagram_->getType()) {
+            case DiagramType::CLASS:
+                Validator::validateClassDiagram(diagram_, diagramErrors_);
+                break;
+            case DiagramType::SEQUENCE:
+                Validator::validateSequenceDiagram(diagram_, diagramErrors_);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void rebuildFlatErrors() {
+        flatErrors_.clear();
+        flatErrors_.insert(flatErrors_.end(), diagramErrors_.begin(), diagramErrors_.end());
+        for (const auto& [name, errors] : elementErrors_) {
+            flatErrors_.insert(flatErrors_.end(), errors.begin(), errors.end());
+        }
+        flatErrors_.insert(flatErrors_.end(), relationshipErrors_.begin(),
+                           relationshipErrors_.end());
+    }
+
+    std::shared_ptr<Diagram> diagram_;
+    std::map<std::string, std::vector<ValidationError>> elementErrors_;
+    std::vector<ValidationError> relationshipErrors_;
+    std::vector<ValidationError> diagramErrors_;
+    std::vector<ValidationError> flatErrors_;
+};
+
 } // namespace uml